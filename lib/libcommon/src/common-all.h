@@ -64,6 +64,11 @@
     # include "common.h"
     # include "common-stdap.h"
     # include "common-method.h"
+    # include "common-jpeg.h"
+    # include "common-png.h"
+    # include "common-tiff.h"
+    # include "common-canvas.h"
+    # include "common-cache.h"
     # include "common-opencv.h"
 
 /* 
@@ -0,0 +1,342 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-cache.h"
+
+/*
+    Source - Cache entry path
+ */
+
+    int lc_cache_entry( char const * const lcPath, int const lcFlag, char * const lcEntry ) {
+
+        /* Cache directory variables */
+        char const * lcDirectory = getenv( LC_CACHE_PATH );
+
+        /* Extension pointer variables */
+        char const * lcExt = strrchr( lcPath, '.' );
+
+        /* Real path variables */
+        char lcReal[PATH_MAX];
+
+        /* Entry key variables */
+        char lcKey[PATH_MAX + 128];
+
+        /* Key hash variables - FNV-1a */
+        uint64_t lcHash = 14695981039346656037ULL;
+
+        /* File status variables */
+        struct stat lcStat;
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* Check cache activation */
+        if ( ( lcDirectory == NULL ) || ( lcDirectory[0] == '\0' ) ) return( LC_FALSE );
+
+        /* Check raw canvas - already decoded */
+        if ( ( lcExt != NULL ) && ( strcasecmp( lcExt + 1, "nrc" ) == 0 ) ) return( LC_FALSE );
+
+        /* Resolve image path - shared by all processes */
+        if ( realpath( lcPath, lcReal ) == NULL ) return( LC_FALSE );
+
+        /* Check image file */
+        if ( ( stat( lcReal, & lcStat ) != 0 ) || ( ! S_ISREG( lcStat.st_mode ) ) ) return( LC_FALSE );
+
+        /* Compose entry key */
+        snprintf( lcKey, PATH_MAX + 128, "%s\n%lld\n%lld.%09ld\n%d", lcReal, ( long long ) lcStat.st_size, ( long long ) lcStat.st_mtim.tv_sec, ( long ) lcStat.st_mtim.tv_nsec, lcFlag );
+
+        /* Compute key hash */
+        for ( lcParse = 0; lcKey[lcParse] != '\0'; lcParse ++ ) {
+
+            /* Accumulate key character */
+            lcHash = ( lcHash ^ ( unsigned char ) lcKey[lcParse] ) * 1099511628211ULL;
+
+        }
+
+        /* Compose entry path */
+        return( snprintf( lcEntry, PATH_MAX, "%s/%016" PRIx64 LC_CACHE_EXTENSION, lcDirectory, lcHash ) < PATH_MAX ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Cache entry importation
+ */
+
+    IplImage * lc_cache_read( char const * const lcEntry ) {
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Map cache entry */
+        if ( ( lcImage = lc_canvas_attach( lcEntry, 0 ) ) != NULL ) {
+
+            /* Update entry use time */
+            utimensat( AT_FDCWD, lcEntry, NULL, 0 );
+
+        }
+
+        /* Return mapped image */
+        return( lcImage );
+
+    }
+
+/*
+    Source - Cache entry exportation
+ */
+
+    int lc_cache_write( char const * const lcEntry, IplImage const * const lcImage ) {
+
+        /* Cache budget variables */
+        off_t lcBudget = lc_cache_budget();
+
+        /* Entry size variables */
+        off_t lcSize = ( off_t ) LC_CANVAS_HEADER + ( off_t ) lcImage->width * lcImage->height * lcImage->nChannels;
+
+        /* Cache paths variables */
+        char lcDirectory[PATH_MAX];
+        char lcTemp[PATH_MAX];
+
+        /* Directory separator variables */
+        char * lcSlash = NULL;
+
+        /* Lock file variables */
+        int lcLock = -1;
+
+        /* Temporary entry variables */
+        int lcFile = -1;
+
+        /* Status variables */
+        int lcStatus = LC_FALSE;
+
+        /* Check entry size */
+        if ( lcSize > lcBudget ) return( LC_FALSE );
+
+        /* Extract cache directory */
+        strcpy( lcDirectory, lcEntry );
+
+        /* Search directory separator */
+        if ( ( lcSlash = strrchr( lcDirectory, '/' ) ) == NULL ) return( LC_FALSE );
+
+        /* Terminate cache directory */
+        * lcSlash = '\0';
+
+        /* Create cache directory - existing directory kept */
+        mkdir( lcDirectory, 0755 );
+
+        /* Compose lock path */
+        if ( snprintf( lcTemp, PATH_MAX, "%s/%s", lcDirectory, LC_CACHE_LOCK ) >= PATH_MAX ) return( LC_FALSE );
+
+        /* Open lock file */
+        if ( ( lcLock = open( lcTemp, O_RDWR | O_CREAT, 0644 ) ) < 0 ) return( LC_FALSE );
+
+        /* Serialize eviction and publication between writers */
+        if ( flock( lcLock, LOCK_EX ) == 0 ) {
+
+            /* Evict least recently used entries */
+            lc_cache_evict( lcDirectory, lcSize, lcBudget );
+
+            /* Compose temporary path - unique among threads and processes */
+            if ( snprintf( lcTemp, PATH_MAX, "%s.XXXXXX", lcEntry ) < PATH_MAX ) {
+
+                /* Create temporary entry */
+                if ( ( lcFile = mkstemp( lcTemp ) ) >= 0 ) {
+
+                    /* Align temporary entry permissions on entries */
+                    fchmod( lcFile, 0644 );
+
+                    /* Close temporary entry */
+                    close( lcFile );
+
+                    /* Write and publish entry */
+                    if ( ( lc_canvas_write( lcTemp, lcImage ) != 0 ) && ( rename( lcTemp, lcEntry ) == 0 ) ) {
+
+                        /* Update status */
+                        lcStatus = LC_TRUE;
+
+                    } else {
+
+                        /* Remove temporary entry */
+                        unlink( lcTemp );
+
+                    }
+
+                }
+
+            }
+
+            /* Release lock - entry published within budget */
+            flock( lcLock, LOCK_UN );
+
+        }
+
+        /* Close lock file */
+        close( lcLock );
+
+        /* Return status */
+        return( lcStatus );
+
+    }
+
+/*
+    Source - Cache budget
+ */
+
+    off_t lc_cache_budget( void ) {
+
+        /* Cache budget environment variables */
+        char const * lcLimit = getenv( LC_CACHE_SIZE );
+
+        /* Return cache budget */
+        return( ( off_t ) ( lcLimit != NULL ? atol( lcLimit ) : LC_CACHE_BUDGET ) << 20 );
+
+    }
+
+/*
+    Source - Cache eviction
+ */
+
+    void lc_cache_evict( char const * const lcDirectory, off_t const lcRequired, off_t const lcBudget ) {
+
+        /* Directory stream variables */
+        DIR * lcStream = NULL;
+
+        /* Directory entry variables */
+        struct dirent * lcFile = NULL;
+
+        /* File status variables */
+        struct stat lcStat;
+
+        /* Cache entries variables */
+        lc_Entry_t * lcEntry = NULL;
+        lc_Entry_t * lcSwap  = NULL;
+
+        /* Cache entries count variables */
+        size_t lcCount = 0;
+        size_t lcAlloc = 0;
+
+        /* Cache size variables */
+        off_t lcTotal = 0;
+
+        /* Entry path variables */
+        char lcPath[PATH_MAX];
+
+        /* Name length variables */
+        size_t lcLength = 0;
+
+        /* Parsing variables */
+        size_t lcParse = 0;
+
+        /* Open cache directory */
+        if ( ( lcStream = opendir( lcDirectory ) ) == NULL ) return;
+
+        /* Enumerate cache entries */
+        while ( ( lcFile = readdir( lcStream ) ) != NULL ) {
+
+            /* Compute name length */
+            lcLength = strlen( lcFile->d_name );
+
+            /* Check entry extension - temporary entries ignored */
+            if ( ( lcLength <= strlen( LC_CACHE_EXTENSION ) ) || ( strcmp( lcFile->d_name + lcLength - strlen( LC_CACHE_EXTENSION ), LC_CACHE_EXTENSION ) != 0 ) ) continue;
+
+            /* Compose entry path */
+            if ( snprintf( lcPath, PATH_MAX, "%s/%s", lcDirectory, lcFile->d_name ) >= PATH_MAX ) continue;
+
+            /* Retrieve entry status */
+            if ( stat( lcPath, & lcStat ) != 0 ) continue;
+
+            /* Check entries array */
+            if ( lcCount == lcAlloc ) {
+
+                /* Enlarge entries array */
+                if ( ( lcSwap = realloc( lcEntry, ( lcAlloc = lcAlloc * 2 + 64 ) * sizeof( lc_Entry_t ) ) ) == NULL ) break;
+
+                /* Assign entries array */
+                lcEntry = lcSwap;
+
+            }
+
+            /* Assign entry descriptor */
+            strcpy( lcEntry[lcCount].enName, lcFile->d_name );
+
+            /* Assign entry size and use time */
+            lcEntry[lcCount].enSize = lcStat.st_size;
+            lcEntry[lcCount].enUsed = lcStat.st_mtime;
+
+            /* Accumulate cache size */
+            lcTotal += lcEntry[lcCount ++].enSize;
+
+        }
+
+        /* Close cache directory */
+        closedir( lcStream );
+
+        /* Sort entries - least recently used first */
+        if ( lcCount > 0 ) qsort( lcEntry, lcCount, sizeof( lc_Entry_t ), lc_cache_compare );
+
+        /* Evict entries until required size fits */
+        for ( lcParse = 0; ( lcParse < lcCount ) && ( lcTotal + lcRequired > lcBudget ); lcParse ++ ) {
+
+            /* Compose entry path */
+            snprintf( lcPath, PATH_MAX, "%s/%s", lcDirectory, lcEntry[lcParse].enName );
+
+            /* Remove entry - mapped pixels kept until last unmapping */
+            if ( unlink( lcPath ) == 0 ) lcTotal -= lcEntry[lcParse].enSize;
+
+        }
+
+        /* Release entries array */
+        free( lcEntry );
+
+    }
+
+/*
+    Source - Cache entries comparison
+ */
+
+    int lc_cache_compare( void const * lcA, void const * lcB ) {
+
+        /* Compare entries use time */
+        return( ( ( lc_Entry_t const * ) lcA )->enUsed > ( ( lc_Entry_t const * ) lcB )->enUsed ? 1 : ( ( ( lc_Entry_t const * ) lcA )->enUsed < ( ( lc_Entry_t const * ) lcB )->enUsed ? -1 : 0 ) );
+
+    }
+
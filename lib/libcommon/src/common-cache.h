@@ -0,0 +1,231 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-cache.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Decoded images cache
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_CACHE__
+    # define __LC_CACHE__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.h"
+    # include "common-canvas.h"
+    # include <stdint.h>
+    # include <inttypes.h>
+    # include <limits.h>
+    # include <dirent.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/file.h>
+    # include <sys/stat.h>
+    # include <opencv/cv.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define cache directory environment variable */
+    # define LC_CACHE_PATH      "NORAMA_CACHE"
+
+    /* Define cache budget environment variable - in megabytes */
+    # define LC_CACHE_SIZE      "NORAMA_CACHE_SIZE"
+
+    /* Define default cache budget - in megabytes */
+    # define LC_CACHE_BUDGET    4096
+
+    /* Define cache entries extension */
+    # define LC_CACHE_EXTENSION ".nrc"
+
+    /* Define cache lock file name */
+    # define LC_CACHE_LOCK      ".lock"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Entry_struct
+     *  \brief Cache entry descriptor
+     *
+     *  This structure describes a cache entry during eviction.
+     *
+     *  \var lc_Entry_struct::enName
+     *  Entry file name
+     *  \var lc_Entry_struct::enSize
+     *  Entry size, in bytes
+     *  \var lc_Entry_struct::enUsed
+     *  Entry last use time
+     */
+
+    typedef struct lc_Entry_struct {
+
+        char   enName[NAME_MAX + 1];
+        off_t  enSize;
+        time_t enUsed;
+
+    } lc_Entry_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Cache entry path
+     *
+     *  This function composes the path of the cache entry of the provided
+     *  image. The cache is enabled by the LC_CACHE_PATH environment variable,
+     *  giving the cache directory, usually on a memory file system. The entry
+     *  is keyed by the real path, the size and the modification time of the
+     *  image file, and by the importation flag.
+     *
+     *  \param  lcPath  Image path
+     *  \param  lcFlag  OpenCV importation flag
+     *  \param  lcEntry Returned entry path, of PATH_MAX bytes
+     *
+     *  \return Returns LC_TRUE if the image is cacheable, LC_FALSE otherwise
+     */
+
+    int lc_cache_entry ( char const * const lcPath, int const lcFlag, char * const lcEntry );
+
+    /*! \brief Cache entry importation
+     *
+     *  This function maps the provided cache entry in memory, in private mode,
+     *  the decoded pixels being neither decoded nor copied. The entry use time
+     *  is updated for the least recently used eviction. The returned image has
+     *  to be released using lc_imrelease.
+     *
+     *  \param  lcEntry Entry path
+     *
+     *  \return Returns mapped image, NULL if the entry is missing
+     */
+
+    IplImage * lc_cache_read ( char const * const lcEntry );
+
+    /*! \brief Cache entry exportation
+     *
+     *  This function stores the provided decoded image in the provided cache
+     *  entry. The least recently used entries are first evicted to keep the
+     *  cache under its budget, returned by lc_cache_budget. The entry is
+     *  written in a unique temporary file renamed once complete, processes
+     *  never mapping a partial entry. The cache lock is held from eviction to
+     *  publication, so that concurrent writers cannot exceed the budget.
+     *
+     *  \param  lcEntry Entry path
+     *  \param  lcImage Decoded image
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_cache_write ( char const * const lcEntry, IplImage const * const lcImage );
+
+    /*! \brief Cache budget
+     *
+     *  This function returns the cache budget, given in megabytes by the
+     *  LC_CACHE_SIZE environment variable or LC_CACHE_BUDGET by default.
+     *
+     *  \return Returns cache budget, in bytes
+     */
+
+    off_t lc_cache_budget ( void );
+
+    /*! \brief Cache eviction
+     *
+     *  This function removes the least recently used entries of the provided
+     *  cache directory until the required size fits in the budget. Removed
+     *  entries stay valid for the processes mapping them, their memory being
+     *  released by the system with their last mapping - removal only drops
+     *  the reference of the cache.
+     *
+     *  \param  lcDirectory Cache directory
+     *  \param  lcRequired  Required size, in bytes
+     *  \param  lcBudget    Cache budget, in bytes
+     */
+
+    void lc_cache_evict ( char const * const lcDirectory, off_t const lcRequired, off_t const lcBudget );
+
+    /*! \brief Cache entries comparison
+     *
+     *  This function compares two cache entries according to their last use
+     *  time, for qsort.
+     *
+     *  \param  lcA First entry
+     *  \param  lcB Second entry
+     *
+     *  \return Returns comparison value
+     */
+
+    int lc_cache_compare ( void const * lcA, void const * lcB );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,583 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-canvas.h"
+
+/*
+    Source - Canvas mapping
+ */
+
+    IplImage * lc_canvas_create( char const * const lcPath, int const lcWidth, int const lcHeight, int const lcLayers ) {
+
+        /* Canvas header variables */
+        lc_Canvas_t lcCanvas;
+
+        /* Canvas page variables */
+        char lcPage[LC_CANVAS_HEADER];
+
+        /* Canvas file variables */
+        int lcFile = -1;
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Compose header page */
+        if ( lc_canvas_page( lcPage, & lcCanvas, lcWidth, lcHeight, lcLayers ) == LC_FALSE ) return( NULL );
+
+        /* Create canvas file */
+        if ( ( lcFile = lc_canvas_file( lcPath, O_RDWR | O_CREAT | O_TRUNC ) ) < 0 ) return( NULL );
+
+        /* Write header page and extend canvas file - sparse pixels */
+        if ( ( write( lcFile, lcPage, LC_CANVAS_HEADER ) == LC_CANVAS_HEADER ) && ( ftruncate( lcFile, ( off_t ) LC_CANVAS_HEADER + ( off_t ) lcWidth * lcHeight * lcLayers ) == 0 ) ) {
+
+            /* Map canvas file */
+            lcImage = lc_canvas_map( lcFile, & lcCanvas, MAP_SHARED );
+
+        }
+
+        /* Close canvas file - mapping persistent */
+        close( lcFile );
+
+        /* Return mapped canvas */
+        return( lcImage );
+
+    }
+
+    IplImage * lc_canvas_open( char const * const lcPath ) {
+
+        /* Canvas header variables */
+        lc_Canvas_t lcCanvas;
+
+        /* Canvas file variables */
+        int lcFile = -1;
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Open canvas file */
+        if ( ( lcFile = lc_canvas_file( lcPath, O_RDWR ) ) < 0 ) return( NULL );
+
+        /* Read canvas header */
+        if ( lc_canvas_header( lcFile, & lcCanvas ) == LC_TRUE ) {
+
+            /* Map canvas file */
+            lcImage = lc_canvas_map( lcFile, & lcCanvas, MAP_SHARED );
+
+        }
+
+        /* Close canvas file - mapping persistent */
+        close( lcFile );
+
+        /* Return mapped canvas */
+        return( lcImage );
+
+    }
+
+    IplImage * lc_canvas_attach( char const * const lcPath, int const lcLayers ) {
+
+        /* Canvas header variables */
+        lc_Canvas_t lcCanvas;
+
+        /* Canvas file variables */
+        int lcFile = -1;
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Open canvas file */
+        if ( ( lcFile = lc_canvas_file( lcPath, O_RDONLY ) ) < 0 ) return( NULL );
+
+        /* Read canvas header and verify layers */
+        if ( ( lc_canvas_header( lcFile, & lcCanvas ) == LC_TRUE ) && ( ( lcLayers == 0 ) || ( lcLayers == ( int ) lcCanvas.cnLayers ) ) ) {
+
+            /* Map canvas file - copy on write */
+            lcImage = lc_canvas_map( lcFile, & lcCanvas, MAP_PRIVATE );
+
+        }
+
+        /* Close canvas file - mapping persistent */
+        close( lcFile );
+
+        /* Return mapped canvas */
+        return( lcImage );
+
+    }
+
+    int lc_canvas_sync( IplImage const * const lcImage, CvRect const lcRegion ) {
+
+        /* Page size variables */
+        size_t lcPage = sysconf( _SC_PAGESIZE );
+
+        /* Synchronized rows variables */
+        int lcTop    = lcRegion.y < 0 ? 0 : lcRegion.y;
+        int lcBottom = lcRegion.y + lcRegion.height > lcImage->height ? lcImage->height : lcRegion.y + lcRegion.height;
+
+        /* Synchronized range variables */
+        size_t lcBegin = 0;
+        size_t lcEnd   = 0;
+
+        /* Check synchronized rows */
+        if ( lcTop >= lcBottom ) return( LC_TRUE );
+
+        /* Compute synchronized range - page aligned from mapping beginning */
+        lcBegin = ( LC_CANVAS_HEADER + ( size_t ) lcTop    * lcImage->widthStep ) / lcPage * lcPage;
+        lcEnd   = ( LC_CANVAS_HEADER + ( size_t ) lcBottom * lcImage->widthStep );
+
+        /* Write modified pages */
+        return( msync( lcImage->imageDataOrigin + lcBegin, lcEnd - lcBegin, MS_SYNC ) == 0 ? LC_TRUE : LC_FALSE );
+
+    }
+
+    void lc_canvas_close( IplImage ** const lcImage ) {
+
+        /* Check image */
+        if ( ( * lcImage ) == NULL ) return;
+
+        /* Check mapped canvas - regular image */
+        if ( lc_canvas_mapped( * lcImage ) == LC_FALSE ) {
+
+            /* Release image memory */
+            cvReleaseImage( lcImage );
+
+            /* Abort unmapping */
+            return;
+
+        }
+
+        /* Unmap canvas file */
+        munmap( ( * lcImage )->imageDataOrigin, LC_CANVAS_HEADER + ( size_t ) ( * lcImage )->height * ( * lcImage )->widthStep );
+
+        /* Detach mapped pixels */
+        ( * lcImage )->imageData = ( * lcImage )->imageDataOrigin = NULL;
+
+        /* Release image header */
+        cvReleaseImageHeader( lcImage );
+
+    }
+
+    int lc_canvas_mapped( IplImage const * const lcImage ) {
+
+        /* Check mapping tag - not inherited by clones */
+        return( ( lcImage != NULL ) && ( lcImage->imageId == ( void * ) lcImage ) ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Canvas importation
+ */
+
+    IplImage * lc_canvas_read( char const * const lcPath, int const lcLayers, CvRect const * const lcRegion ) {
+
+        /* Canvas header variables */
+        lc_Canvas_t lcCanvas;
+
+        /* Canvas file variables */
+        int lcFile = -1;
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Imported region variables */
+        CvRect lcKeep;
+
+        /* Row variables */
+        size_t lcStep = 0;
+        size_t lcSpan = 0;
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* Open canvas file */
+        if ( ( lcFile = lc_canvas_file( lcPath, O_RDONLY ) ) < 0 ) return( NULL );
+
+        /* Read canvas header and verify layers */
+        if ( ( lc_canvas_header( lcFile, & lcCanvas ) == LC_FALSE ) || ( ( lcLayers != 0 ) && ( lcLayers != ( int ) lcCanvas.cnLayers ) ) ) {
+
+            /* Close canvas file */
+            close( lcFile );
+
+            /* Send message */
+            return( NULL );
+
+        }
+
+        /* Create image - memory untouched out of imported region */
+        if ( ( lcImage = cvCreateImage( cvSize( lcCanvas.cnWidth, lcCanvas.cnHeight ), IPL_DEPTH_8U, lcCanvas.cnLayers ) ) == NULL ) {
+
+            /* Close canvas file */
+            close( lcFile );
+
+            /* Send message */
+            return( NULL );
+
+        }
+
+        /* Assign imported region - entire image */
+        lcKeep = cvRect( 0, 0, lcImage->width, lcImage->height );
+
+        /* Check imported region */
+        if ( lcRegion != NULL ) {
+
+            /* Clamp imported region on image */
+            lcKeep.x      = lcRegion->x < 0 ? 0 : ( lcRegion->x > lcImage->width  ? lcImage->width  : lcRegion->x );
+            lcKeep.y      = lcRegion->y < 0 ? 0 : ( lcRegion->y > lcImage->height ? lcImage->height : lcRegion->y );
+            lcKeep.width  = ( lcRegion->x + lcRegion->width  > lcImage->width  ? lcImage->width  : lcRegion->x + lcRegion->width  ) - lcKeep.x;
+            lcKeep.height = ( lcRegion->y + lcRegion->height > lcImage->height ? lcImage->height : lcRegion->y + lcRegion->height ) - lcKeep.y;
+
+            /* Check empty region - entire image imported */
+            if ( ( lcKeep.width <= 0 ) || ( lcKeep.height <= 0 ) ) lcKeep = cvRect( 0, 0, lcImage->width, lcImage->height );
+
+        }
+
+        /* Compute canvas row step and imported span */
+        lcStep = ( size_t ) lcCanvas.cnWidth * lcCanvas.cnLayers;
+        lcSpan = ( size_t ) lcKeep.width     * lcCanvas.cnLayers;
+
+        /* Import region rows */
+        for ( lcParse = lcKeep.y; lcParse < lcKeep.y + lcKeep.height; lcParse ++ ) {
+
+            /* Read region row */
+            if ( pread( lcFile, lcImage->imageData + ( size_t ) lcParse * lcImage->widthStep + ( size_t ) lcKeep.x * lcCanvas.cnLayers, lcSpan, ( off_t ) LC_CANVAS_HEADER + ( off_t ) lcParse * lcStep + ( off_t ) lcKeep.x * lcCanvas.cnLayers ) != ( ssize_t ) lcSpan ) {
+
+                /* Release image */
+                cvReleaseImage( & lcImage );
+
+                /* Abort importation */
+                break;
+
+            }
+
+        }
+
+        /* Close canvas file */
+        close( lcFile );
+
+        /* Return imported image */
+        return( lcImage );
+
+    }
+
+    IplImage * lc_canvas_pull( FILE * const lcStream, int const lcLayers ) {
+
+        /* Canvas header variables */
+        lc_Canvas_t lcCanvas;
+
+        /* Canvas page variables */
+        char lcPage[LC_CANVAS_HEADER];
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Row size variables */
+        size_t lcSpan = 0;
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* Read header page */
+        if ( fread( lcPage, 1, LC_CANVAS_HEADER, lcStream ) != LC_CANVAS_HEADER ) return( NULL );
+
+        /* Extract canvas header */
+        memcpy( & lcCanvas, lcPage, sizeof( lc_Canvas_t ) );
+
+        /* Verify canvas header and layers */
+        if ( ( lc_canvas_verify( & lcCanvas ) == LC_FALSE ) || ( ( lcLayers != 0 ) && ( lcLayers != ( int ) lcCanvas.cnLayers ) ) ) return( NULL );
+
+        /* Create image */
+        if ( ( lcImage = cvCreateImage( cvSize( lcCanvas.cnWidth, lcCanvas.cnHeight ), IPL_DEPTH_8U, lcCanvas.cnLayers ) ) == NULL ) return( NULL );
+
+        /* Compute row size */
+        lcSpan = ( size_t ) lcImage->width * lcImage->nChannels;
+
+        /* Import canvas rows */
+        for ( lcParse = 0; lcParse < lcImage->height; lcParse ++ ) {
+
+            /* Read canvas row */
+            if ( fread( lcImage->imageData + ( size_t ) lcParse * lcImage->widthStep, 1, lcSpan, lcStream ) != lcSpan ) {
+
+                /* Release image */
+                cvReleaseImage( & lcImage );
+
+                /* Abort importation */
+                break;
+
+            }
+
+        }
+
+        /* Return imported image */
+        return( lcImage );
+
+    }
+
+/*
+    Source - Canvas exportation
+ */
+
+    int lc_canvas_write( char const * const lcPath, IplImage const * const lcImage ) {
+
+        /* Image variables */
+        IplImage * lcCanvas = NULL;
+
+        /* Row size variables */
+        size_t lcSpan = ( size_t ) lcImage->width * lcImage->nChannels;
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* Check image format */
+        if ( ( lcImage->depth != IPL_DEPTH_8U ) || ( lcImage->origin != IPL_ORIGIN_TL ) || ( lcImage->roi != NULL ) ) return( 0 );
+
+        /* Create canvas */
+        if ( ( lcCanvas = lc_canvas_create( lcPath, lcImage->width, lcImage->height, lcImage->nChannels ) ) == NULL ) return( 0 );
+
+        /* Copy image rows */
+        for ( lcParse = 0; lcParse < lcImage->height; lcParse ++ ) {
+
+            /* Copy image row */
+            memcpy( lcCanvas->imageData + ( size_t ) lcParse * lcCanvas->widthStep, lcImage->imageData + ( size_t ) lcParse * lcImage->widthStep, lcSpan );
+
+        }
+
+        /* Write canvas pixels */
+        lcParse = lc_canvas_sync( lcCanvas, cvRect( 0, 0, lcCanvas->width, lcCanvas->height ) );
+
+        /* Unmap canvas */
+        lc_canvas_close( & lcCanvas );
+
+        /* Return status */
+        return( lcParse == LC_TRUE ? 1 : 0 );
+
+    }
+
+    int lc_canvas_push( FILE * const lcStream, IplImage const * const lcImage ) {
+
+        /* Canvas header variables */
+        lc_Canvas_t lcCanvas;
+
+        /* Canvas page variables */
+        char lcPage[LC_CANVAS_HEADER];
+
+        /* Row size variables */
+        size_t lcSpan = ( size_t ) lcImage->width * lcImage->nChannels;
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* Check image format */
+        if ( ( lcImage->depth != IPL_DEPTH_8U ) || ( lcImage->origin != IPL_ORIGIN_TL ) || ( lcImage->roi != NULL ) ) return( 0 );
+
+        /* Compose header page */
+        if ( lc_canvas_page( lcPage, & lcCanvas, lcImage->width, lcImage->height, lcImage->nChannels ) == LC_FALSE ) return( 0 );
+
+        /* Write header page */
+        if ( fwrite( lcPage, 1, LC_CANVAS_HEADER, lcStream ) != LC_CANVAS_HEADER ) return( 0 );
+
+        /* Export image rows */
+        for ( lcParse = 0; lcParse < lcImage->height; lcParse ++ ) {
+
+            /* Write image row */
+            if ( fwrite( lcImage->imageData + ( size_t ) lcParse * lcImage->widthStep, 1, lcSpan, lcStream ) != lcSpan ) return( 0 );
+
+        }
+
+        /* Flush stream - following tool waiting */
+        return( fflush( lcStream ) == 0 ? 1 : 0 );
+
+    }
+
+/*
+    Source - Canvas header
+ */
+
+    int lc_canvas_size( char const * const lcPath, CvSize * const lcSize ) {
+
+        /* Canvas header variables */
+        lc_Canvas_t lcCanvas;
+
+        /* Canvas file variables */
+        int lcFile = -1;
+
+        /* Status variables */
+        int lcStatus = LC_FALSE;
+
+        /* Open canvas file */
+        if ( ( lcFile = lc_canvas_file( lcPath, O_RDONLY ) ) < 0 ) return( LC_FALSE );
+
+        /* Read canvas header */
+        if ( ( lcStatus = lc_canvas_header( lcFile, & lcCanvas ) ) == LC_TRUE ) {
+
+            /* Assign canvas size */
+            * lcSize = cvSize( lcCanvas.cnWidth, lcCanvas.cnHeight );
+
+        }
+
+        /* Close canvas file */
+        close( lcFile );
+
+        /* Return status */
+        return( lcStatus );
+
+    }
+
+    int lc_canvas_header( int const lcFile, lc_Canvas_t * const lcCanvas ) {
+
+        /* File status variables */
+        struct stat lcStat;
+
+        /* Read canvas header */
+        if ( pread( lcFile, lcCanvas, sizeof( lc_Canvas_t ), 0 ) != ( ssize_t ) sizeof( lc_Canvas_t ) ) return( LC_FALSE );
+
+        /* Verify canvas header */
+        if ( lc_canvas_verify( lcCanvas ) == LC_FALSE ) return( LC_FALSE );
+
+        /* Verify canvas file size */
+        if ( fstat( lcFile, & lcStat ) != 0 ) return( LC_FALSE );
+
+        /* Return status */
+        return( lcStat.st_size >= ( off_t ) LC_CANVAS_HEADER + ( off_t ) lcCanvas->cnWidth * lcCanvas->cnHeight * lcCanvas->cnLayers ? LC_TRUE : LC_FALSE );
+
+    }
+
+    int lc_canvas_verify( lc_Canvas_t const * const lcCanvas ) {
+
+        /* Verify canvas signature and version */
+        if ( memcmp( lcCanvas->cnMagic, LC_CANVAS_MAGIC, sizeof( lcCanvas->cnMagic ) ) != 0 ) return( LC_FALSE );
+        if ( lcCanvas->cnVersion != LC_CANVAS_VERSION ) return( LC_FALSE );
+
+        /* Verify canvas geometry */
+        if ( ( lcCanvas->cnWidth  == 0 ) || ( lcCanvas->cnWidth  > INT_MAX ) ) return( LC_FALSE );
+        if ( ( lcCanvas->cnHeight == 0 ) || ( lcCanvas->cnHeight > INT_MAX ) ) return( LC_FALSE );
+        if ( ( lcCanvas->cnLayers == 0 ) || ( lcCanvas->cnLayers > 4       ) ) return( LC_FALSE );
+
+        /* Return status */
+        return( LC_TRUE );
+
+    }
+
+    int lc_canvas_page( char * const lcPage, lc_Canvas_t * const lcCanvas, int const lcWidth, int const lcHeight, int const lcLayers ) {
+
+        /* Check canvas geometry */
+        if ( ( lcWidth <= 0 ) || ( lcHeight <= 0 ) || ( lcLayers <= 0 ) || ( lcLayers > 4 ) ) return( LC_FALSE );
+
+        /* Compose canvas header */
+        memset( lcCanvas, 0, sizeof( lc_Canvas_t ) );
+        memcpy( lcCanvas->cnMagic, LC_CANVAS_MAGIC, sizeof( lcCanvas->cnMagic ) );
+
+        /* Assign canvas geometry */
+        lcCanvas->cnVersion = LC_CANVAS_VERSION;
+        lcCanvas->cnWidth   = lcWidth;
+        lcCanvas->cnHeight  = lcHeight;
+        lcCanvas->cnLayers  = lcLayers;
+
+        /* Compose header page */
+        memset( lcPage, 0, LC_CANVAS_HEADER );
+        memcpy( lcPage, lcCanvas, sizeof( lc_Canvas_t ) );
+
+        /* Return status */
+        return( LC_TRUE );
+
+    }
+
+    int lc_canvas_file( char const * const lcPath, int const lcFlags ) {
+
+        /* Segment name variables */
+        char lcName[NAME_MAX + 1];
+
+        /* Check shared memory segment */
+        if ( strncmp( lcPath, LC_CANVAS_SHM, strlen( LC_CANVAS_SHM ) ) == 0 ) {
+
+            /* Compose segment name */
+            if ( snprintf( lcName, NAME_MAX + 1, "/%s", lcPath + strlen( LC_CANVAS_SHM ) ) > NAME_MAX ) return( -1 );
+
+            /* Open shared memory segment */
+            return( shm_open( lcName, lcFlags, 0600 ) );
+
+        } else {
+
+            /* Open canvas file */
+            return( open( lcPath, lcFlags, 0644 ) );
+
+        }
+
+    }
+
+    IplImage * lc_canvas_map( int const lcFile, lc_Canvas_t const * const lcCanvas, int const lcShare ) {
+
+        /* Mapping variables */
+        char * lcMap = NULL;
+
+        /* Mapping size variables */
+        size_t lcSize = LC_CANVAS_HEADER + ( size_t ) lcCanvas->cnWidth * lcCanvas->cnHeight * lcCanvas->cnLayers;
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Map canvas file */
+        if ( ( lcMap = mmap( NULL, lcSize, PROT_READ | PROT_WRITE, lcShare, lcFile, 0 ) ) == MAP_FAILED ) return( NULL );
+
+        /* Create image header */
+        if ( ( lcImage = cvCreateImageHeader( cvSize( lcCanvas->cnWidth, lcCanvas->cnHeight ), IPL_DEPTH_8U, lcCanvas->cnLayers ) ) == NULL ) {
+
+            /* Unmap canvas file */
+            munmap( lcMap, lcSize );
+
+            /* Send message */
+            return( NULL );
+
+        }
+
+        /* Assign mapped pixels - rows without padding */
+        cvSetData( lcImage, lcMap + LC_CANVAS_HEADER, lcCanvas->cnWidth * lcCanvas->cnLayers );
+
+        /* Assign mapping origin */
+        lcImage->imageDataOrigin = lcMap;
+
+        /* Assign mapping tag */
+        lcImage->imageId = lcImage;
+
+        /* Return mapped canvas */
+        return( lcImage );
+
+    }
+
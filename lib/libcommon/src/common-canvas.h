@@ -0,0 +1,378 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-canvas.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Raw canvas interface
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_CANVAS__
+    # define __LC_CANVAS__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.h"
+    # include <stdint.h>
+    # include <limits.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/mman.h>
+    # include <sys/stat.h>
+    # include <opencv/cv.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define canvas signature */
+    # define LC_CANVAS_MAGIC    "NRCANVAS"
+
+    /* Define canvas format version */
+    # define LC_CANVAS_VERSION  1
+
+    /* Define canvas header size - pixels page aligned */
+    # define LC_CANVAS_HEADER   4096
+
+    /* Define shared memory segment path prefix */
+    # define LC_CANVAS_SHM      "shm:"
+
+    /* Define standard streams path */
+    # define LC_CANVAS_STREAM   "-"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Canvas_struct
+     *  \brief Raw canvas header
+     *
+     *  This structure describes the header stored at the beginning of a raw
+     *  canvas file, in host byte order. The header is padded to the size of
+     *  LC_CANVAS_HEADER bytes and is followed by the canvas pixels, stored row
+     *  by row without padding in blue, green, red order, as in OpenCV images.
+     *  The same layout is used for POSIX shared memory segments, designated by
+     *  a path of LC_CANVAS_SHM prefix, and for images exchanged over pipes.
+     *
+     *  \var lc_Canvas_struct::cnMagic
+     *  Canvas signature, LC_CANVAS_MAGIC
+     *  \var lc_Canvas_struct::cnVersion
+     *  Canvas format version
+     *  \var lc_Canvas_struct::cnWidth
+     *  Canvas width, in pixels
+     *  \var lc_Canvas_struct::cnHeight
+     *  Canvas height, in pixels
+     *  \var lc_Canvas_struct::cnLayers
+     *  Canvas layers count
+     */
+
+    typedef struct lc_Canvas_struct {
+
+        char     cnMagic[8];
+        uint32_t cnVersion;
+        uint32_t cnWidth;
+        uint32_t cnHeight;
+        uint32_t cnLayers;
+
+    } lc_Canvas_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Canvas creation
+     *
+     *  This function creates a raw canvas file of the provided size and maps
+     *  it in memory. The canvas pixels are initialized to zero without being
+     *  written, the file being created sparse. The returned image points to
+     *  the mapping and has to be released using lc_canvas_close.
+     *
+     *  \param  lcPath   Canvas path
+     *  \param  lcWidth  Canvas width, in pixels
+     *  \param  lcHeight Canvas height, in pixels
+     *  \param  lcLayers Canvas layers count
+     *
+     *  \return Returns mapped canvas image, NULL on failure
+     */
+
+    IplImage * lc_canvas_create ( char const * const lcPath, int const lcWidth, int const lcHeight, int const lcLayers );
+
+    /*! \brief Canvas mapping
+     *
+     *  This function maps the provided raw canvas file in memory, in shared
+     *  mode. The modifications of the returned image pixels are written back
+     *  in the canvas file, only the modified pages being written. The returned
+     *  image has to be released using lc_canvas_close.
+     *
+     *  \param  lcPath Canvas path
+     *
+     *  \return Returns mapped canvas image, NULL on failure
+     */
+
+    IplImage * lc_canvas_open ( char const * const lcPath );
+
+    /*! \brief Canvas attachment
+     *
+     *  This function maps the provided raw canvas file or shared memory segment
+     *  in memory, in private mode. The pixels are not copied, and the returned
+     *  image can be modified without altering the canvas, the modified pages
+     *  being copied on write. The returned image has to be released using
+     *  lc_canvas_close.
+     *
+     *  \param  lcPath   Canvas path
+     *  \param  lcLayers Image layers count, zero or equal to the canvas layers
+     *                   count
+     *
+     *  \return Returns mapped canvas image, NULL on failure
+     */
+
+    IplImage * lc_canvas_attach ( char const * const lcPath, int const lcLayers );
+
+    /*! \brief Canvas synchronization
+     *
+     *  This function writes the modified pages of the provided canvas rows
+     *  back in the canvas file, waiting for the writes completion.
+     *
+     *  \param  lcImage  Mapped canvas image
+     *  \param  lcRegion Modified canvas region, only its rows being considered
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_canvas_sync ( IplImage const * const lcImage, CvRect const lcRegion );
+
+    /*! \brief Canvas unmapping
+     *
+     *  This function unmaps the provided canvas image and releases its header.
+     *  Images that are not mapped are released using cvReleaseImage. The
+     *  pointer to the image is set to NULL.
+     *
+     *  \param  lcImage Pointer to mapped canvas image
+     */
+
+    void lc_canvas_close ( IplImage ** const lcImage );
+
+    /*! \brief Canvas mapping detection
+     *
+     *  This function checks if the provided image points to a mapped canvas.
+     *  The mapping is tagged by the image identifier pointing to the image
+     *  itself, the tag being then not inherited by the image clones.
+     *
+     *  \param  lcImage Image to check
+     *
+     *  \return Returns LC_TRUE for mapped canvas, LC_FALSE otherwise
+     */
+
+    int lc_canvas_mapped ( IplImage const * const lcImage );
+
+    /*! \brief Canvas importation
+     *
+     *  This function imports the provided raw canvas file in an allocated
+     *  image. If a region is provided, only its pixels are read, the image
+     *  content outside of the region being undefined.
+     *
+     *  \param  lcPath   Canvas path
+     *  \param  lcLayers Image layers count, zero or equal to the canvas layers
+     *                   count
+     *  \param  lcRegion Imported region, NULL for the entire canvas
+     *
+     *  \return Returns imported image, NULL on failure
+     */
+
+    IplImage * lc_canvas_read ( char const * const lcPath, int const lcLayers, CvRect const * const lcRegion );
+
+    /*! \brief Canvas stream importation
+     *
+     *  This function imports a raw canvas from the provided sequential stream,
+     *  usually the standard input of a tool chained by a pipe.
+     *
+     *  \param  lcStream Canvas stream
+     *  \param  lcLayers Image layers count, zero or equal to the canvas layers
+     *                   count
+     *
+     *  \return Returns imported image, NULL on failure
+     */
+
+    IplImage * lc_canvas_pull ( FILE * const lcStream, int const lcLayers );
+
+    /*! \brief Canvas exportation
+     *
+     *  This function exports the provided image in a raw canvas file.
+     *
+     *  \param  lcPath  Canvas path
+     *  \param  lcImage Image to export, with 8 bits layers
+     *
+     *  \return The function returns a non zero value if exportation succeed,
+     *  zero otherwise
+     */
+
+    int lc_canvas_write ( char const * const lcPath, IplImage const * const lcImage );
+
+    /*! \brief Canvas stream exportation
+     *
+     *  This function exports the provided image as a raw canvas on the provided
+     *  sequential stream, usually the standard output of a tool chained by a
+     *  pipe. The stream is flushed after exportation.
+     *
+     *  \param  lcStream Canvas stream
+     *  \param  lcImage  Image to export, with 8 bits layers
+     *
+     *  \return The function returns a non zero value if exportation succeed,
+     *  zero otherwise
+     */
+
+    int lc_canvas_push ( FILE * const lcStream, IplImage const * const lcImage );
+
+    /*! \brief Canvas size
+     *
+     *  This function reads the size of the provided raw canvas from its header.
+     *
+     *  \param  lcPath Canvas path
+     *  \param  lcSize Returned canvas size
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_canvas_size ( char const * const lcPath, CvSize * const lcSize );
+
+    /*! \brief Canvas header reading
+     *
+     *  This function reads and verifies the header of the provided canvas file
+     *  descriptor, including the consistency of the file size.
+     *
+     *  \param  lcFile   Canvas file descriptor
+     *  \param  lcCanvas Returned canvas header
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_canvas_header ( int const lcFile, lc_Canvas_t * const lcCanvas );
+
+    /*! \brief Canvas header verification
+     *
+     *  This function verifies the signature, the version and the geometry of
+     *  the provided canvas header.
+     *
+     *  \param  lcCanvas Canvas header
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_canvas_verify ( lc_Canvas_t const * const lcCanvas );
+
+    /*! \brief Canvas header composition
+     *
+     *  This function composes the canvas header of the provided geometry and
+     *  the header page, of LC_CANVAS_HEADER bytes, that precedes the pixels.
+     *
+     *  \param  lcPage   Returned header page
+     *  \param  lcCanvas Returned canvas header
+     *  \param  lcWidth  Canvas width, in pixels
+     *  \param  lcHeight Canvas height, in pixels
+     *  \param  lcLayers Canvas layers count
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_canvas_page ( char * const lcPage, lc_Canvas_t * const lcCanvas, int const lcWidth, int const lcHeight, int const lcLayers );
+
+    /*! \brief Canvas file opening
+     *
+     *  This function opens the provided canvas path. Paths starting with the
+     *  LC_CANVAS_SHM prefix designate the POSIX shared memory segment named by
+     *  the rest of the path, other paths designating regular files.
+     *
+     *  \param  lcPath  Canvas path
+     *  \param  lcFlags Opening flags
+     *
+     *  \return Returns canvas file descriptor, negative value on failure
+     */
+
+    int lc_canvas_file ( char const * const lcPath, int const lcFlags );
+
+    /*! \brief Canvas file mapping
+     *
+     *  This function maps the provided canvas file descriptor in memory and
+     *  composes the image pointing to the mapped pixels. The image data origin
+     *  points to the mapping beginning, allowing its unmapping.
+     *
+     *  \param  lcFile   Canvas file descriptor
+     *  \param  lcCanvas Canvas header
+     *  \param  lcShare  Mapping mode, MAP_SHARED or MAP_PRIVATE
+     *
+     *  \return Returns mapped canvas image, NULL on failure
+     */
+
+    IplImage * lc_canvas_map ( int const lcFile, lc_Canvas_t const * const lcCanvas, int const lcShare );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,1201 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-jpeg.h"
+
+/*
+    Source - JPEG exportation
+ */
+
+    int lc_jpeg_write( char const * const lcPath, IplImage const * const lcImage, int const lcQuality ) {
+
+        /* Bands variables */
+        lc_Band_t * lcBand = NULL;
+
+        /* Bands geometry variables */
+        int lcStep  = 0;
+        int lcCount = 0;
+
+        /* Stream offsets variables */
+        size_t lcFrame  = 0;
+        size_t lcOffset = 0;
+        size_t lcParse  = 0;
+
+        /* Restart markers variables */
+        unsigned char lcRestart = 0;
+
+        /* Marker variables */
+        unsigned char lcMarker[2] = { 0xFF, 0xD9 };
+
+        /* Exportation stream variables */
+        FILE * lcStream = NULL;
+
+        /* Returned value variables */
+        int lcReturn = LC_TRUE;
+
+        /* Parsing variables */
+        int lcBands = 0;
+
+        /* Check image dimensions - frame header fields and codec limit */
+        if ( ( lcImage->width < 1 ) || ( lcImage->height < 1 ) || ( lcImage->width > JPEG_MAX_DIMENSION ) || ( lcImage->height > JPEG_MAX_DIMENSION ) ) return( 0 );
+
+        /* Compute bands height - aligned on MCU rows */
+        lcStep = ( ( lcImage->height + LC_JPEG_BANDS - 1 ) / LC_JPEG_BANDS + LC_JPEG_ALIGN - 1 ) / LC_JPEG_ALIGN * LC_JPEG_ALIGN;
+
+        /* Compute bands count */
+        lcCount = ( lcImage->height + lcStep - 1 ) / lcStep;
+
+        /* Allocate bands */
+        if ( ( lcBand = ( lc_Band_t * ) calloc( lcCount, sizeof( lc_Band_t ) ) ) == NULL ) return( 0 );
+
+        /* Encode bands */
+        # pragma omp parallel for private( lcBands ) schedule( dynamic )
+        for ( lcBands = 0; lcBands < lcCount; lcBands ++ ) {
+
+            /* Encode band */
+            lc_jpeg_band( lcImage, lcBands * lcStep, ( lcBands + 1 ) * lcStep > lcImage->height ? lcImage->height - lcBands * lcStep : lcStep, lcQuality, lcBand + lcBands );
+
+        }
+
+        /* Verify bands streams */
+        for ( lcBands = 0; ( lcBands < lcCount ) && ( lcReturn == LC_TRUE ); lcBands ++ ) {
+
+            /* Verify band stream termination */
+            if ( ( lcBand[lcBands].bdBytes == NULL ) || ( lcBand[lcBands].bdSize < 4 ) || ( lcBand[lcBands].bdBytes[lcBand[lcBands].bdSize - 2] != 0xFF ) || ( lcBand[lcBands].bdBytes[lcBand[lcBands].bdSize - 1] != 0xD9 ) ) lcReturn = LC_FALSE;
+
+        }
+
+        /* Create exportation stream */
+        if ( ( lcReturn == LC_TRUE ) && ( ( lcStream = fopen( lcPath, "wb" ) ) != NULL ) ) {
+
+            /* Stitch bands streams */
+            for ( lcBands = 0; ( lcBands < lcCount ) && ( lcReturn == LC_TRUE ); lcBands ++ ) {
+
+                /* Retrieve entropy coded data */
+                if ( ( ( lcOffset = lc_jpeg_entropy( lcBand[lcBands].bdBytes, lcBand[lcBands].bdSize, & lcFrame ) ) == 0 ) || ( ( lcBands == 0 ) && ( ( lcFrame == 0 ) || ( lcFrame + 7 > lcOffset ) ) ) ) {
+
+                    /* Update status */
+                    lcReturn = LC_FALSE;
+
+                } else {
+
+                    /* Check first band */
+                    if ( lcBands == 0 ) {
+
+                        /* Update frame height to image height */
+                        lcBand[0].bdBytes[lcFrame + 5] = ( lcImage->height >> 8 ) & 0xFF;
+                        lcBand[0].bdBytes[lcFrame + 6] = ( lcImage->height      ) & 0xFF;
+
+                        /* Export stream headers */
+                        if ( fwrite( lcBand[0].bdBytes, 1, lcOffset, lcStream ) != lcOffset ) lcReturn = LC_FALSE;
+
+                    } else {
+
+                        /* Compose band restart marker */
+                        lcMarker[1] = 0xD0 + ( ( lcRestart ++ ) & 0x07 );
+
+                        /* Export band restart marker */
+                        if ( fwrite( lcMarker, 1, 2, lcStream ) != 2 ) lcReturn = LC_FALSE;
+
+                    }
+
+                    /* Renumber band restart markers */
+                    for ( lcParse = lcOffset; lcParse + 3 < lcBand[lcBands].bdSize; lcParse ++ ) {
+
+                        /* Detect restart marker */
+                        if ( ( lcBand[lcBands].bdBytes[lcParse] == 0xFF ) && ( ( lcBand[lcBands].bdBytes[lcParse + 1] & 0xF8 ) == 0xD0 ) ) {
+
+                            /* Renumber restart marker */
+                            lcBand[lcBands].bdBytes[++ lcParse] = 0xD0 + ( ( lcRestart ++ ) & 0x07 );
+
+                        }
+
+                    }
+
+                    /* Export band entropy coded data - end of image excluded */
+                    if ( fwrite( lcBand[lcBands].bdBytes + lcOffset, 1, lcBand[lcBands].bdSize - lcOffset - 2, lcStream ) != lcBand[lcBands].bdSize - lcOffset - 2 ) lcReturn = LC_FALSE;
+
+                }
+
+            }
+
+            /* Compose end of image marker */
+            lcMarker[1] = 0xD9;
+
+            /* Export end of image marker */
+            if ( fwrite( lcMarker, 1, 2, lcStream ) != 2 ) lcReturn = LC_FALSE;
+
+            /* Close exportation stream */
+            if ( fclose( lcStream ) != 0 ) lcReturn = LC_FALSE;
+
+        } else { lcReturn = LC_FALSE; }
+
+        /* Release bands streams */
+        for ( lcBands = 0; lcBands < lcCount; lcBands ++ ) free( lcBand[lcBands].bdBytes );
+
+        /* Release bands */
+        free( lcBand );
+
+        /* Return status */
+        return( lcReturn == LC_TRUE ? 1 : 0 );
+
+    }
+
+/*
+    Source - JPEG band encoding
+ */
+
+    int lc_jpeg_band( 
+
+        IplImage const * const lcImage, 
+        int              const lcRow, 
+        int              const lcHeight, 
+        int              const lcQuality, 
+        lc_Band_t      * const lcBand 
+
+    ) {
+
+        /* Codec variables */
+        struct jpeg_compress_struct lcInfo;
+
+        /* Error manager variables */
+        lc_Error_t lcError;
+
+        /* Rows pointers variables */
+        JSAMPROW lcLine[LC_JPEG_ALIGN];
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* Reset band stream */
+        lcBand->bdBytes = NULL;
+        lcBand->bdSize  = 0;
+
+        /* Install error manager */
+        lcInfo.err = jpeg_std_error( & lcError.erManager );
+
+        /* Assign fatal error handler */
+        lcError.erManager.error_exit = & lc_jpeg_error;
+
+        /* Fatal error return */
+        if ( setjmp( lcError.erJump ) != 0 ) {
+
+            /* Release codec */
+            jpeg_destroy_compress( & lcInfo );
+
+            /* Release band stream */
+            free( lcBand->bdBytes );
+
+            /* Reset band stream */
+            lcBand->bdBytes = NULL;
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Create codec */
+        jpeg_create_compress( & lcInfo );
+
+        /* Assign memory destination */
+        jpeg_mem_dest( & lcInfo, & lcBand->bdBytes, & lcBand->bdSize );
+
+        /* Assign band geometry */
+        lcInfo.image_width      = lcImage->width;
+        lcInfo.image_height     = lcHeight;
+        lcInfo.input_components = lcImage->nChannels;
+
+        /* Assign pixels layout - read in place */
+        lcInfo.in_color_space = ( lcImage->nChannels == 1 ) ? JCS_GRAYSCALE : ( ( lcImage->nChannels == 3 ) ? JCS_EXT_BGR : JCS_EXT_BGRX );
+
+        /* Assign encoding parameters */
+        jpeg_set_defaults( & lcInfo );
+        jpeg_set_quality( & lcInfo, lcQuality, TRUE );
+
+        /* Assign restart marker at each MCU row */
+        lcInfo.restart_in_rows = 1;
+
+        /* Start encoding */
+        jpeg_start_compress( & lcInfo, TRUE );
+
+        /* Encode band rows */
+        while ( lcInfo.next_scanline < lcInfo.image_height ) {
+
+            /* Compose rows pointers */
+            for ( lcParse = 0; ( lcParse < LC_JPEG_ALIGN ) && ( lcInfo.next_scanline + lcParse < lcInfo.image_height ); lcParse ++ ) {
+
+                /* Assign row pointer */
+                lcLine[lcParse] = ( JSAMPROW ) ( lcImage->imageData + ( size_t ) ( lcRow + lcInfo.next_scanline + lcParse ) * lcImage->widthStep );
+
+            }
+
+            /* Encode rows */
+            jpeg_write_scanlines( & lcInfo, lcLine, lcParse );
+
+        }
+
+        /* Terminate encoding */
+        jpeg_finish_compress( & lcInfo );
+
+        /* Release codec */
+        jpeg_destroy_compress( & lcInfo );
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - JPEG importation
+ */
+
+    IplImage * lc_jpeg_read( char const * const lcPath, int const lcLayers, CvRect const * const lcRegion, double const lcDensity ) {
+
+        /* Codec variables */
+        struct jpeg_decompress_struct lcInfo;
+
+        /* Error manager variables */
+        lc_Error_t lcError;
+
+        /* Stream variables */
+        lc_Stream_t lcStream = { NULL, 0, 0, 0, 0, NULL, 0 };
+
+        /* Importation stream variables */
+        FILE * lcFile = NULL;
+        long   lcLength = 0;
+
+        /* Image variables - kept across fatal error return */
+        IplImage * volatile lcImage = NULL;
+
+        /* Image release variables */
+        IplImage * lcRelease = NULL;
+
+        /* Restart markers offsets variables - kept across fatal error return */
+        size_t * volatile lcMark = NULL;
+
+        /* Decoded region variables */
+        CvRect lcKeep;
+
+        /* Marker search variables */
+        unsigned char * lcFind = NULL;
+
+        /* Coefficients variables */
+        jvirt_barray_ptr * lcCoeff = NULL;
+        JBLOCKROW        * volatile lcRows[MAX_COMPONENTS] = { NULL };
+
+        /* Geometry variables */
+        int lcScale     = 1;
+        int lcMCUHeight = 0;
+        int lcMCUWidth  = 0;
+        int lcRowHeight = 0;
+        int lcMCURows   = 0;
+        int lcMCUCols   = 0;
+        int lcVertical  = 0;
+        int lcHorizon   = 0;
+
+        /* Slices variables */
+        int lcPeriod  = 1;
+        int lcStride  = 1;
+        int lcSegment = 0;
+        int lcLeft    = 0;
+        int lcRight   = 1;
+        int lcTop     = 0;
+        int lcBottom  = 0;
+        int lcStep    = 0;
+        int lcCount   = 0;
+        int lcRestart = LC_FALSE;
+        int lcSlice   = LC_FALSE;
+
+        /* Threads variables */
+        int lcThread = 1;
+
+        /* Slice variables */
+        lc_Band_t lcBand = { NULL, 0 };
+        CvRect    lcKept;
+        int       lcLow  = 0;
+        int       lcHigh = 0;
+        int       lcFail = 0;
+
+        /* Parsing variables */
+        int    lcParse = 0;
+        int    lcRow   = 0;
+        int    lcGcd   = 0;
+        int    lcSwap  = 0;
+        size_t lcScan  = 0;
+
+        /* Open importation stream */
+        if ( ( lcFile = fopen( lcPath, "rb" ) ) == NULL ) return( NULL );
+
+        /* Retrieve stream size */
+        if ( ( fseek( lcFile, 0, SEEK_END ) != 0 ) || ( ( lcLength = ftell( lcFile ) ) < 4 ) || ( fseek( lcFile, 0, SEEK_SET ) != 0 ) ) {
+
+            /* Close importation stream */
+            fclose( lcFile );
+
+            /* Send message */
+            return( NULL );
+
+        }
+
+        /* Allocate and read stream */
+        if ( ( ( lcStream.stBytes = ( unsigned char * ) malloc( lcStream.stSize = lcLength ) ) == NULL ) || ( fread( lcStream.stBytes, 1, lcStream.stSize, lcFile ) != lcStream.stSize ) ) {
+
+            /* Release stream */
+            free( lcStream.stBytes );
+
+            /* Close importation stream */
+            fclose( lcFile );
+
+            /* Send message */
+            return( NULL );
+
+        }
+
+        /* Close importation stream */
+        fclose( lcFile );
+
+        /* Install error manager */
+        lcInfo.err = jpeg_std_error( & lcError.erManager );
+
+        /* Assign fatal error handler */
+        lcError.erManager.error_exit = & lc_jpeg_error;
+
+        /* Fatal error return */
+        if ( setjmp( lcError.erJump ) != 0 ) {
+
+            /* Release codec */
+            jpeg_destroy_decompress( & lcInfo );
+
+            /* Release coefficients rows */
+            for ( lcParse = 0; lcParse < MAX_COMPONENTS; lcParse ++ ) free( lcRows[lcParse] );
+
+            /* Release restart markers offsets */
+            free( lcMark );
+
+            /* Release stream */
+            free( lcStream.stBytes );
+
+            /* Release image */
+            if ( ( lcRelease = lcImage ) != NULL ) cvReleaseImage( & lcRelease );
+
+            /* Send message */
+            return( NULL );
+
+        }
+
+        /* Create codec */
+        jpeg_create_decompress( & lcInfo );
+
+        /* Assign memory source */
+        jpeg_mem_src( & lcInfo, lcStream.stBytes, lcStream.stSize );
+
+        /* Read stream headers */
+        if ( jpeg_read_header( & lcInfo, TRUE ) != JPEG_HEADER_OK ) longjmp( lcError.erJump, 1 );
+
+        /* Check handled streams */
+        if ( ( lcInfo.data_precision != 8 ) || ( ( lcInfo.jpeg_color_space != JCS_GRAYSCALE ) && ( lcInfo.jpeg_color_space != JCS_YCbCr ) && ( lcInfo.jpeg_color_space != JCS_RGB ) ) ) longjmp( lcError.erJump, 1 );
+
+        /* Select reduced decoding scale - largest scale satisfying density */
+        for ( lcScale = LC_JPEG_SCALE; ( lcScale > 1 ) && ( ( lcDensity <= 0.0 ) || ( lcDensity * lcScale > 1.0 ) ); lcScale >>= 1 );
+
+        /* Assign reduced decoding scale - scaled inverse DCT */
+        lcInfo.scale_num   = 1;
+        lcInfo.scale_denom = lcScale;
+
+        /* Compute decoded image size */
+        jpeg_calc_output_dimensions( & lcInfo );
+
+        /* Create image */
+        if ( ( lcImage = cvCreateImage( cvSize( lcInfo.output_width, lcInfo.output_height ), IPL_DEPTH_8U, lcLayers != 0 ? lcLayers : ( lcInfo.num_components == 1 ? 1 : 3 ) ) ) == NULL ) longjmp( lcError.erJump, 1 );
+
+        /* Assign decoded region - entire image */
+        lcKeep = cvRect( 0, 0, lcImage->width, lcImage->height );
+
+        /* Check decoded region */
+        if ( lcRegion != NULL ) {
+
+            /* Clamp decoded region on image - converted to decoded image pixels */
+            lcKeep.x      = ( lcRegion->x < 0 ? 0 : ( lcRegion->x > ( int ) lcInfo.image_width  ? ( int ) lcInfo.image_width  : lcRegion->x ) ) / lcScale;
+            lcKeep.y      = ( lcRegion->y < 0 ? 0 : ( lcRegion->y > ( int ) lcInfo.image_height ? ( int ) lcInfo.image_height : lcRegion->y ) ) / lcScale;
+            lcKeep.width  = ( ( lcRegion->x + lcRegion->width  > ( int ) lcInfo.image_width  ? ( int ) lcInfo.image_width  : lcRegion->x + lcRegion->width  ) + lcScale - 1 ) / lcScale - lcKeep.x;
+            lcKeep.height = ( ( lcRegion->y + lcRegion->height > ( int ) lcInfo.image_height ? ( int ) lcInfo.image_height : lcRegion->y + lcRegion->height ) + lcScale - 1 ) / lcScale - lcKeep.y;
+
+            /* Check empty region - entire image decoded */
+            if ( ( lcKeep.width <= 0 ) || ( lcKeep.height <= 0 ) ) lcKeep = cvRect( 0, 0, lcImage->width, lcImage->height );
+
+        }
+
+        /* Compute MCU geometry */
+        lcMCUHeight = lcInfo.max_v_samp_factor * DCTSIZE;
+        lcMCUWidth  = lcInfo.max_h_samp_factor * DCTSIZE;
+
+        /* Compute decoded MCU rows height */
+        lcRowHeight = lcMCUHeight / lcScale;
+
+        /* Compute MCU rows and columns count */
+        lcMCURows = ( lcInfo.image_height + lcMCUHeight - 1 ) / lcMCUHeight;
+        lcMCUCols = ( lcInfo.image_width  + lcMCUWidth  - 1 ) / lcMCUWidth;
+
+        /* Detect subsampled components - upsampling context */
+        for ( lcParse = 0; lcParse < lcInfo.num_components; lcParse ++ ) {
+
+            /* Check component subsampling */
+            if ( lcInfo.comp_info[lcParse].v_samp_factor != lcInfo.max_v_samp_factor ) lcVertical = 1;
+            if ( lcInfo.comp_info[lcParse].h_samp_factor != lcInfo.max_h_samp_factor ) lcHorizon  = 1;
+
+        }
+
+        /* Retrieve available threads count */
+        # ifdef __OPENMP__
+        lcThread = omp_get_max_threads();
+        # endif
+
+        /* Check interleaved sequential stream with restart markers */
+        if ( ( lcInfo.progressive_mode == FALSE ) && ( lcInfo.restart_interval > 0 ) && ( lcInfo.comps_in_scan == lcInfo.num_components ) && ( ( lcInfo.num_components > 1 ) || ( lcMCUHeight * lcMCUWidth == DCTSIZE2 ) ) ) {
+
+            /* Compute MCU rows and restart intervals common divisor */
+            for ( lcGcd = lcInfo.restart_interval, lcParse = lcMCUCols; lcParse != 0; lcSwap = lcGcd % lcParse, lcGcd = lcParse, lcParse = lcSwap );
+
+            /* Compute restart period - MCU rows starting a restart interval */
+            lcPeriod = lcInfo.restart_interval / lcGcd;
+
+            /* Compute restart intervals count per period */
+            lcStride = lcMCUCols / lcGcd;
+
+            /* Compute restart markers count */
+            lcStream.stMarks = ( ( size_t ) lcMCURows * lcMCUCols + lcInfo.restart_interval - 1 ) / lcInfo.restart_interval - 1;
+
+            /* Retrieve entropy coded data */
+            if ( ( lcPeriod <= LC_JPEG_SPAN ) && ( ( lcStream.stEntropy = lc_jpeg_entropy( lcStream.stBytes, lcStream.stSize, & lcStream.stFrame ) ) != 0 ) && ( ( lcStream.stMark = lcMark = ( size_t * ) malloc( ( lcStream.stMarks + 1 ) * sizeof( size_t ) ) ) != NULL ) ) {
+
+                /* Search restart markers */
+                for ( lcScan = lcStream.stEntropy, lcParse = 0; ( lcStream.stEnd == 0 ) && ( lcParse <= lcStream.stMarks ); ) {
+
+                    /* Search marker prefix */
+                    lcFind = ( unsigned char * ) memchr( lcStream.stBytes + lcScan, 0xFF, lcStream.stSize - lcScan );
+
+                    /* Check stream end */
+                    if ( ( lcFind == NULL ) || ( ( lcScan = lcFind - lcStream.stBytes ) + 1 >= lcStream.stSize ) ) break;
+
+                    /* Check restart marker */
+                    if ( ( lcStream.stBytes[lcScan + 1] & 0xF8 ) == 0xD0 ) {
+
+                        /* Push restart marker offset */
+                        lcStream.stMark[lcParse ++] = lcScan;
+
+                        /* Skip marker */
+                        lcScan += 2;
+
+                    } else
+                    if ( ( lcStream.stBytes[lcScan + 1] == 0x00 ) || ( lcStream.stBytes[lcScan + 1] == 0xFF ) ) {
+
+                        /* Skip stuffed or fill byte */
+                        lcScan += 1 + ( lcStream.stBytes[lcScan + 1] == 0x00 );
+
+                    } else {
+
+                        /* Entropy coded data end - single scan only */
+                        if ( lcStream.stBytes[lcScan + 1] == 0xD9 ) lcStream.stEnd = lcScan; else break;
+
+                    }
+
+                }
+
+                /* Check restart intervals layout */
+                if ( ( lcStream.stEnd != 0 ) && ( lcParse == lcStream.stMarks ) ) lcRestart = LC_TRUE;
+
+            }
+
+        }
+
+        /* Check restart intervals slices - parallel or region decoding */
+        if ( ( lcRestart == LC_TRUE ) && ( ( ( lcThread > 1 ) && ( lcMCURows > LC_JPEG_SPAN ) ) || ( lcKeep.width < lcImage->width ) || ( lcKeep.height < lcImage->height ) ) ) {
+
+            /* Check restart intervals columns */
+            if ( lcPeriod == 1 ) {
+
+                /* Compute restart interval width */
+                lcSegment = lcInfo.restart_interval * lcMCUWidth;
+
+                /* Compute region restart intervals - upsampling context */
+                lcLeft  = lcKeep.x / ( lcSegment / lcScale ) - lcHorizon;
+                lcRight = ( lcKeep.x + lcKeep.width + lcSegment / lcScale - 1 ) / ( lcSegment / lcScale ) + lcHorizon;
+
+                /* Clamp region restart intervals */
+                lcLeft  = lcLeft  < 0        ? 0        : lcLeft;
+                lcRight = lcRight > lcStride ? lcStride : lcRight;
+
+            } else {
+
+                /* Assign entire restart periods */
+                lcLeft = 0; lcRight = lcStride;
+
+            }
+
+            /* Update mode */
+            lcSlice = LC_TRUE;
+
+        } else
+        if ( ( lcRestart == LC_FALSE ) && ( lcThread > 1 ) && ( lcMCURows > LC_JPEG_SPAN ) && ( lcKeep.width == lcImage->width ) && ( lcKeep.height == lcImage->height ) ) {
+
+            /* Reset restart period */
+            lcPeriod = 1;
+
+            /* Decode stream coefficients */
+            if ( ( lcCoeff = jpeg_read_coefficients( & lcInfo ) ) == NULL ) longjmp( lcError.erJump, 1 );
+
+            /* Retrieve coefficients rows */
+            for ( lcParse = 0; lcParse < lcInfo.num_components; lcParse ++ ) {
+
+                /* Compute component rows count - padded to MCU rows */
+                lcSwap = lcMCURows * lcInfo.comp_info[lcParse].v_samp_factor;
+
+                /* Allocate rows pointers */
+                if ( ( lcRows[lcParse] = ( JBLOCKROW * ) malloc( lcSwap * sizeof( JBLOCKROW ) ) ) == NULL ) longjmp( lcError.erJump, 1 );
+
+                /* Retrieve rows pointers */
+                for ( lcRow = 0; lcRow < lcSwap; lcRow ++ ) {
+
+                    /* Retrieve row pointer */
+                    lcRows[lcParse][lcRow] = ( * lcInfo.mem->access_virt_barray )( ( j_common_ptr ) & lcInfo, lcCoeff[lcParse], lcRow, 1, FALSE )[0];
+
+                }
+
+            }
+
+            /* Update mode */
+            lcSlice = LC_TRUE;
+
+        }
+
+        /* Check slices decoding */
+        if ( lcSlice == LC_TRUE ) {
+
+            /* Compute region MCU rows - aligned on restart period */
+            lcTop    = ( lcKeep.y / lcRowHeight ) / lcPeriod * lcPeriod;
+            lcBottom = ( ( lcKeep.y + lcKeep.height + lcRowHeight - 1 ) / lcRowHeight + lcPeriod - 1 ) / lcPeriod * lcPeriod;
+
+            /* Clamp region MCU rows */
+            lcBottom = lcBottom > lcMCURows ? lcMCURows : lcBottom;
+
+            /* Compute slices height */
+            lcStep = ( ( lcBottom - lcTop + LC_JPEG_BANDS - 1 ) / LC_JPEG_BANDS > LC_JPEG_SPAN ? ( lcBottom - lcTop + LC_JPEG_BANDS - 1 ) / LC_JPEG_BANDS : LC_JPEG_SPAN );
+
+            /* Align slices height on restart period */
+            lcStep = ( ( lcStep + lcPeriod - 1 ) / lcPeriod ) * lcPeriod;
+
+            /* Compute slices count */
+            lcCount = ( lcBottom - lcTop + lcStep - 1 ) / lcStep;
+
+            /* Compute slices overlap */
+            lcVertical *= lcPeriod;
+
+            /* Decode slices */
+            # pragma omp parallel for private( lcParse, lcBand, lcKept, lcLow, lcHigh ) reduction( + : lcFail ) schedule( dynamic )
+            for ( lcParse = 0; lcParse < lcCount; lcParse ++ ) {
+
+                /* Compute slice kept rows */
+                lcLow  = lcTop + lcParse * lcStep;
+                lcHigh = lcTop + ( lcParse + 1 ) * lcStep;
+
+                /* Compose slice kept region */
+                lcKept = cvRect( lcKeep.x, lcLow * lcRowHeight > lcKeep.y ? lcLow * lcRowHeight : lcKeep.y, lcKeep.width, 0 );
+
+                /* Compute slice kept region height */
+                lcKept.height = ( lcHigh * lcRowHeight < lcKeep.y + lcKeep.height ? lcHigh * lcRowHeight : lcKeep.y + lcKeep.height ) - lcKept.y;
+
+                /* Compute slice decoded MCU rows - upsampling context */
+                lcLow  = lcLow  - lcVertical < 0         ? 0         : lcLow  - lcVertical;
+                lcHigh = lcHigh + lcVertical > lcMCURows ? lcMCURows : lcHigh + lcVertical;
+
+                /* Compose slice stream */
+                if ( lcRestart == LC_TRUE ) {
+
+                    /* Extract slice restart intervals */
+                    lcFail += lc_jpeg_slice( & lcStream, lcStride, cvRect( lcLeft, lcLow / lcPeriod, lcRight - lcLeft, ( lcHigh + lcPeriod - 1 ) / lcPeriod - lcLow / lcPeriod ), 
+
+                        /* Slice width - clamped on image */
+                        ( lcRight == lcStride ? ( int ) lcInfo.image_width : lcRight * lcSegment ) - lcLeft * lcSegment,
+
+                        /* Slice height - clamped on image */
+                        ( lcHigh * lcMCUHeight > ( int ) lcInfo.image_height ? ( int ) lcInfo.image_height : lcHigh * lcMCUHeight ) - lcLow * lcMCUHeight,
+
+                    & lcBand ) == LC_FALSE;
+
+                } else {
+
+                    /* Encode slice coefficients */
+                    lcFail += lc_jpeg_transcode( & lcInfo, ( JBLOCKROW const * const * ) lcRows, lcLow, ( lcHigh * lcMCUHeight > ( int ) lcInfo.image_height ? ( int ) lcInfo.image_height : lcHigh * lcMCUHeight ) - lcLow * lcMCUHeight, & lcBand ) == LC_FALSE;
+
+                }
+
+                /* Decode slice kept region */
+                if ( lcBand.bdBytes != NULL ) lcFail += lc_jpeg_decode( & lcBand, lcImage, lcLeft * lcSegment / lcScale, lcLow * lcRowHeight, lcKept, lcScale ) == LC_FALSE;
+
+                /* Release slice stream */
+                free( lcBand.bdBytes );
+
+            }
+
+        } else {
+
+            /* Compose single slice */
+            lcBand.bdBytes = lcStream.stBytes;
+            lcBand.bdSize  = lcStream.stSize;
+
+            /* Decode image region */
+            lcFail = lc_jpeg_decode( & lcBand, lcImage, 0, 0, lcKeep, lcScale ) == LC_FALSE;
+
+        }
+
+        /* Release codec */
+        jpeg_destroy_decompress( & lcInfo );
+
+        /* Release coefficients rows */
+        for ( lcParse = 0; lcParse < MAX_COMPONENTS; lcParse ++ ) free( lcRows[lcParse] );
+
+        /* Release restart markers offsets */
+        free( lcStream.stMark );
+
+        /* Release stream */
+        free( lcStream.stBytes );
+
+        /* Check slices decoding */
+        if ( lcFail != 0 ) {
+
+            /* Release image */
+            lcRelease = lcImage; cvReleaseImage( & lcRelease );
+
+            /* Send message */
+            return( NULL );
+
+        }
+
+        /* Return image */
+        return( lcImage );
+
+    }
+
+/*
+    Source - JPEG image size
+ */
+
+    int lc_jpeg_size( char const * const lcPath, CvSize * const lcSize ) {
+
+        /* Codec variables */
+        struct jpeg_decompress_struct lcInfo;
+
+        /* Error manager variables */
+        lc_Error_t lcError;
+
+        /* Importation stream variables */
+        FILE * lcFile = NULL;
+
+        /* Open importation stream */
+        if ( ( lcFile = fopen( lcPath, "rb" ) ) == NULL ) return( LC_FALSE );
+
+        /* Install error manager */
+        lcInfo.err = jpeg_std_error( & lcError.erManager );
+
+        /* Assign fatal error handler */
+        lcError.erManager.error_exit = & lc_jpeg_error;
+
+        /* Fatal error return */
+        if ( setjmp( lcError.erJump ) != 0 ) {
+
+            /* Release codec */
+            jpeg_destroy_decompress( & lcInfo );
+
+            /* Close importation stream */
+            fclose( lcFile );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Create codec */
+        jpeg_create_decompress( & lcInfo );
+
+        /* Assign stream source */
+        jpeg_stdio_src( & lcInfo, lcFile );
+
+        /* Read stream headers */
+        if ( jpeg_read_header( & lcInfo, TRUE ) != JPEG_HEADER_OK ) longjmp( lcError.erJump, 1 );
+
+        /* Assign image size */
+        * lcSize = cvSize( lcInfo.image_width, lcInfo.image_height );
+
+        /* Release codec */
+        jpeg_destroy_decompress( & lcInfo );
+
+        /* Close importation stream */
+        fclose( lcFile );
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - JPEG slice stream
+ */
+
+    int lc_jpeg_slice(
+
+        lc_Stream_t const * const lcStream,
+        int                 const lcStride,
+        CvRect              const lcSegment,
+        int                 const lcWidth,
+        int                 const lcHeight,
+        lc_Band_t         * const lcBand
+
+    ) {
+
+        /* Restart markers variables */
+        unsigned char lcRestart = 0;
+
+        /* Restart intervals variables */
+        size_t lcBegin = 0;
+        size_t lcEnd   = 0;
+
+        /* Stream offset variables */
+        size_t lcOffset = 0;
+
+        /* Parsing variables */
+        int lcRow    = 0;
+        int lcColumn = 0;
+        int lcIndex  = 0;
+        int lcPass   = 0;
+
+        /* Compute slice stream size - headers and end of image */
+        lcBand->bdSize = lcStream->stEntropy + 2;
+
+        /* Two passes - size then composition */
+        for ( lcPass = 0; lcPass < 2; lcPass ++ ) {
+
+            /* Check composition pass */
+            if ( lcPass == 1 ) {
+
+                /* Allocate slice stream */
+                if ( ( lcBand->bdBytes = ( unsigned char * ) malloc( lcBand->bdSize ) ) == NULL ) return( LC_FALSE );
+
+                /* Copy stream headers */
+                memcpy( lcBand->bdBytes, lcStream->stBytes, lcOffset = lcStream->stEntropy );
+
+                /* Update frame height and width to slice size */
+                lcBand->bdBytes[lcStream->stFrame + 5] = ( lcHeight >> 8 ) & 0xFF;
+                lcBand->bdBytes[lcStream->stFrame + 6] = ( lcHeight      ) & 0xFF;
+                lcBand->bdBytes[lcStream->stFrame + 7] = ( lcWidth  >> 8 ) & 0xFF;
+                lcBand->bdBytes[lcStream->stFrame + 8] = ( lcWidth       ) & 0xFF;
+
+            }
+
+            /* Reset restart markers numbering */
+            lcRestart = 0;
+
+            /* Walk slice restart intervals */
+            for ( lcRow = lcSegment.y; lcRow < lcSegment.y + lcSegment.height; lcRow ++ ) {
+
+                for ( lcColumn = lcSegment.x; lcColumn < lcSegment.x + lcSegment.width; lcColumn ++ ) {
+
+                    /* Compute restart interval index */
+                    if ( ( lcIndex = lcRow * lcStride + lcColumn ) > lcStream->stMarks ) continue;
+
+                    /* Compute restart interval offsets */
+                    lcBegin = lcIndex == 0 ? lcStream->stEntropy : lcStream->stMark[lcIndex - 1] + 2;
+                    lcEnd   = lcIndex == lcStream->stMarks ? lcStream->stEnd : lcStream->stMark[lcIndex];
+
+                    /* Check composition pass */
+                    if ( lcPass == 0 ) {
+
+                        /* Update slice stream size - interval and restart marker */
+                        lcBand->bdSize += ( lcEnd - lcBegin ) + ( ( lcRow == lcSegment.y ) && ( lcColumn == lcSegment.x ) ? 0 : 2 );
+
+                    } else {
+
+                        /* Check first interval */
+                        if ( ( lcRow != lcSegment.y ) || ( lcColumn != lcSegment.x ) ) {
+
+                            /* Compose restart marker */
+                            lcBand->bdBytes[lcOffset ++] = 0xFF;
+                            lcBand->bdBytes[lcOffset ++] = 0xD0 + ( ( lcRestart ++ ) & 0x07 );
+
+                        }
+
+                        /* Copy restart interval */
+                        memcpy( lcBand->bdBytes + lcOffset, lcStream->stBytes + lcBegin, lcEnd - lcBegin );
+
+                        /* Update stream offset */
+                        lcOffset += lcEnd - lcBegin;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        /* Compose end of image marker */
+        lcBand->bdBytes[lcOffset ++] = 0xFF;
+        lcBand->bdBytes[lcOffset ++] = 0xD9;
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - JPEG slice transcoding
+ */
+
+    int lc_jpeg_transcode(
+
+        j_decompress_ptr         lcSource,
+        JBLOCKROW  const * const lcRows[],
+        int                const lcRow,
+        int                const lcHeight,
+        lc_Band_t        * const lcBand
+
+    ) {
+
+        /* Codec variables */
+        struct jpeg_compress_struct lcInfo;
+
+        /* Error manager variables */
+        lc_Error_t lcError;
+
+        /* Coefficients variables */
+        jvirt_barray_ptr lcCoeff[MAX_COMPONENTS];
+
+        /* Component variables */
+        jpeg_component_info * lcComp = NULL;
+
+        /* Geometry variables */
+        int lcWidth  = 0;
+        int lcBlocks = 0;
+
+        /* Parsing variables */
+        int lcParse = 0;
+        int lcIndex = 0;
+
+        /* Reset slice stream */
+        lcBand->bdBytes = NULL;
+        lcBand->bdSize  = 0;
+
+        /* Install error manager */
+        lcInfo.err = jpeg_std_error( & lcError.erManager );
+
+        /* Assign fatal error handler */
+        lcError.erManager.error_exit = & lc_jpeg_error;
+
+        /* Fatal error return */
+        if ( setjmp( lcError.erJump ) != 0 ) {
+
+            /* Release codec */
+            jpeg_destroy_compress( & lcInfo );
+
+            /* Release slice stream */
+            free( lcBand->bdBytes );
+
+            /* Reset slice stream */
+            lcBand->bdBytes = NULL;
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Create codec */
+        jpeg_create_compress( & lcInfo );
+
+        /* Assign memory destination */
+        jpeg_mem_dest( & lcInfo, & lcBand->bdBytes, & lcBand->bdSize );
+
+        /* Copy stream parameters - quantization tables and sampling */
+        jpeg_copy_critical_parameters( lcSource, & lcInfo );
+
+        /* Assign slice height */
+        lcInfo.image_height = lcHeight;
+
+        /* Request slice coefficients arrays */
+        for ( lcParse = 0; lcParse < lcInfo.num_components; lcParse ++ ) {
+
+            /* Retrieve component */
+            lcComp = lcSource->comp_info + lcParse;
+
+            /* Compute component geometry - padded to MCU */
+            lcWidth  = ( ( lcComp->width_in_blocks + lcComp->h_samp_factor - 1 ) / lcComp->h_samp_factor ) * lcComp->h_samp_factor;
+            lcBlocks = ( ( lcHeight + lcSource->max_v_samp_factor * DCTSIZE - 1 ) / ( lcSource->max_v_samp_factor * DCTSIZE ) ) * lcComp->v_samp_factor;
+
+            /* Request coefficients array */
+            lcCoeff[lcParse] = ( * lcInfo.mem->request_virt_barray )( ( j_common_ptr ) & lcInfo, JPOOL_IMAGE, FALSE, lcWidth, lcBlocks, lcComp->v_samp_factor );
+
+        }
+
+        /* Start encoding */
+        jpeg_write_coefficients( & lcInfo, lcCoeff );
+
+        /* Copy slice coefficients */
+        for ( lcParse = 0; lcParse < lcInfo.num_components; lcParse ++ ) {
+
+            /* Retrieve component */
+            lcComp = lcSource->comp_info + lcParse;
+
+            /* Compute component geometry - padded to MCU */
+            lcWidth  = ( ( lcComp->width_in_blocks + lcComp->h_samp_factor - 1 ) / lcComp->h_samp_factor ) * lcComp->h_samp_factor;
+            lcBlocks = ( ( lcHeight + lcSource->max_v_samp_factor * DCTSIZE - 1 ) / ( lcSource->max_v_samp_factor * DCTSIZE ) ) * lcComp->v_samp_factor;
+
+            /* Copy coefficients rows */
+            for ( lcIndex = 0; lcIndex < lcBlocks; lcIndex ++ ) {
+
+                /* Copy coefficients row */
+                memcpy( ( * lcInfo.mem->access_virt_barray )( ( j_common_ptr ) & lcInfo, lcCoeff[lcParse], lcIndex, 1, TRUE )[0], lcRows[lcParse][lcRow * lcComp->v_samp_factor + lcIndex], lcWidth * sizeof( JBLOCK ) );
+
+            }
+
+        }
+
+        /* Terminate encoding */
+        jpeg_finish_compress( & lcInfo );
+
+        /* Release codec */
+        jpeg_destroy_compress( & lcInfo );
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - JPEG slice decoding
+ */
+
+    int lc_jpeg_decode(
+
+        lc_Band_t const * const lcBand,
+        IplImage        * const lcImage,
+        int               const lcColumn,
+        int               const lcRow,
+        CvRect            const lcKeep,
+        int               const lcScale
+
+    ) {
+
+        /* Codec variables */
+        struct jpeg_decompress_struct lcInfo;
+
+        /* Error manager variables */
+        lc_Error_t lcError;
+
+        /* Scratch row variables */
+        unsigned char * volatile lcScratch = NULL;
+
+        /* Row pointer variables */
+        JSAMPROW lcLine = NULL;
+
+        /* Kept columns variables */
+        int lcLeft  = 0;
+        int lcRight = 0;
+
+        /* Cropped columns variables */
+        JDIMENSION lcCrop  = 0;
+        JDIMENSION lcWidth = 0;
+
+        /* Image row variables */
+        int lcImageRow = 0;
+
+        /* Install error manager */
+        lcInfo.err = jpeg_std_error( & lcError.erManager );
+
+        /* Assign fatal error handler */
+        lcError.erManager.error_exit = & lc_jpeg_error;
+
+        /* Fatal error return */
+        if ( setjmp( lcError.erJump ) != 0 ) {
+
+            /* Release codec */
+            jpeg_destroy_decompress( & lcInfo );
+
+            /* Release scratch row */
+            free( lcScratch );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Create codec */
+        jpeg_create_decompress( & lcInfo );
+
+        /* Assign memory source */
+        jpeg_mem_src( & lcInfo, lcBand->bdBytes, lcBand->bdSize );
+
+        /* Read stream headers */
+        if ( jpeg_read_header( & lcInfo, TRUE ) != JPEG_HEADER_OK ) longjmp( lcError.erJump, 1 );
+
+        /* Assign pixels layout - written in place */
+        lcInfo.out_color_space = ( lcImage->nChannels == 1 ) ? JCS_GRAYSCALE : JCS_EXT_BGR;
+
+        /* Assign reduced decoding scale */
+        lcInfo.scale_num   = 1;
+        lcInfo.scale_denom = lcScale;
+
+        /* Start decoding */
+        jpeg_start_decompress( & lcInfo );
+
+        /* Check slice geometry */
+        if ( ( lcColumn + ( int ) lcInfo.output_width > lcImage->width ) || ( lcInfo.output_components != lcImage->nChannels ) || ( lcRow + ( int ) lcInfo.output_height > lcImage->height ) ) longjmp( lcError.erJump, 1 );
+
+        /* Compute kept columns in slice */
+        lcLeft  = lcKeep.x - lcColumn < 0 ? 0 : lcKeep.x - lcColumn;
+        lcRight = lcKeep.x + lcKeep.width - lcColumn > ( int ) lcInfo.output_width ? ( int ) lcInfo.output_width : lcKeep.x + lcKeep.width - lcColumn;
+
+        /* Check cropped decoding */
+        if ( ( lcLeft > 0 ) || ( lcRight < ( int ) lcInfo.output_width ) ) {
+
+            /* Compute cropped columns - upsampling context */
+            lcCrop  = lcLeft - lcInfo.max_h_samp_factor * DCTSIZE / lcScale < 0 ? 0 : lcLeft - lcInfo.max_h_samp_factor * DCTSIZE / lcScale;
+            lcWidth = ( lcRight + lcInfo.max_h_samp_factor * DCTSIZE / lcScale > ( int ) lcInfo.output_width ? lcInfo.output_width : lcRight + lcInfo.max_h_samp_factor * DCTSIZE / lcScale ) - lcCrop;
+
+            /* Crop decoded columns - aligned on MCU by codec */
+            jpeg_crop_scanline( & lcInfo, & lcCrop, & lcWidth );
+
+        }
+
+        /* Skip rows preceding kept region - entropy decoding only */
+        if ( lcKeep.y > lcRow ) jpeg_skip_scanlines( & lcInfo, lcKeep.y - lcRow );
+
+        /* Allocate scratch row */
+        if ( ( lcScratch = ( unsigned char * ) malloc( lcInfo.output_width * lcInfo.output_components ) ) == NULL ) longjmp( lcError.erJump, 1 );
+
+        /* Decode slice rows - up to last kept row */
+        while ( ( lcInfo.output_scanline < lcInfo.output_height ) && ( ( lcImageRow = lcRow + lcInfo.output_scanline ) < lcKeep.y + lcKeep.height ) ) {
+
+            /* Check cropped decoding */
+            if ( lcWidth > 0 ) {
+
+                /* Assign row pointer - scratch row */
+                lcLine = lcScratch;
+
+                /* Decode row */
+                jpeg_read_scanlines( & lcInfo, & lcLine, 1 );
+
+                /* Copy kept columns */
+                memcpy( lcImage->imageData + ( size_t ) lcImageRow * lcImage->widthStep + ( lcColumn + lcLeft ) * lcImage->nChannels, lcScratch + ( lcLeft - lcCrop ) * lcImage->nChannels, ( lcRight - lcLeft ) * lcImage->nChannels );
+
+            } else {
+
+                /* Assign row pointer - decoded in place */
+                lcLine = ( JSAMPROW ) ( lcImage->imageData + ( size_t ) lcImageRow * lcImage->widthStep + lcColumn * lcImage->nChannels );
+
+                /* Decode row */
+                jpeg_read_scanlines( & lcInfo, & lcLine, 1 );
+
+            }
+
+        }
+
+        /* Release codec - remaining rows discarded */
+        jpeg_destroy_decompress( & lcInfo );
+
+        /* Release scratch row */
+        free( lcScratch );
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - JPEG stream segments
+ */
+
+    size_t lc_jpeg_entropy( unsigned char const * const lcBytes, size_t const lcSize, size_t * const lcFrame ) {
+
+        /* Stream offset variables */
+        size_t lcOffset = 2;
+
+        /* Marker variables */
+        unsigned char lcMarker = 0;
+
+        /* Verify start of image marker */
+        if ( ( lcSize < 4 ) || ( lcBytes[0] != 0xFF ) || ( lcBytes[1] != 0xD8 ) ) return( 0 );
+
+        /* Walk markers segments */
+        while ( lcOffset + 4 <= lcSize ) {
+
+            /* Verify marker */
+            if ( lcBytes[lcOffset] != 0xFF ) return( 0 );
+
+            /* Retrieve marker */
+            lcMarker = lcBytes[lcOffset + 1];
+
+            /* Check start of frame marker */
+            if ( ( lcMarker >= 0xC0 ) && ( lcMarker <= 0xC2 ) && ( lcFrame != NULL ) ) * lcFrame = lcOffset;
+
+            /* Move to next segment */
+            lcOffset += 2 + ( ( size_t ) lcBytes[lcOffset + 2] << 8 ) + lcBytes[lcOffset + 3];
+
+            /* Check start of scan marker */
+            if ( lcMarker == 0xDA ) return( lcOffset <= lcSize ? lcOffset : 0 );
+
+        }
+
+        /* Start of scan not found */
+        return( 0 );
+
+    }
+
+/*
+    Source - JPEG codec fatal error
+ */
+
+    void lc_jpeg_error( j_common_ptr lcInfo ) {
+
+        /* Return to error context */
+        longjmp( ( ( lc_Error_t * ) lcInfo->err )->erJump, 1 );
+
+    }
+
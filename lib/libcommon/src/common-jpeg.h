@@ -0,0 +1,405 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-jpeg.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  JPEG codec interface
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_JPEG__
+    # define __LC_JPEG__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.h"
+    # include <setjmp.h>
+    # include <jpeglib.h>
+    # include <opencv/cv.h>
+    # ifdef __OPENMP__
+    # include <omp.h>
+    # endif
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define encoding bands alignment - largest MCU height */
+    # define LC_JPEG_ALIGN  16
+
+    /* Define encoding bands count */
+    # define LC_JPEG_BANDS  64
+
+    /* Define default quality - OpenCV exportation default */
+    # define LC_JPEG_QUALITY 95
+
+    /* Define decoding slices minimal height, in MCU rows */
+    # define LC_JPEG_SPAN   4
+
+    /* Define largest reduced decoding scale - scaled inverse DCT */
+    # define LC_JPEG_SCALE  8
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Error_struct
+     *  \brief JPEG codec error manager
+     *
+     *  This structure extends the libjpeg error manager with the context used
+     *  to return from the codec on fatal errors instead of exiting.
+     *
+     *  \var lc_Error_struct::erManager
+     *  libjpeg error manager
+     *  \var lc_Error_struct::erJump
+     *  Return context on fatal error
+     */
+
+    typedef struct lc_Error_struct {
+
+        struct jpeg_error_mgr erManager;
+        jmp_buf               erJump;
+
+    } lc_Error_t;
+
+    /*! \struct lc_Band_struct
+     *  \brief JPEG encoding band
+     *
+     *  This structure holds the JPEG stream encoded for a horizontal band of
+     *  the exported image.
+     *
+     *  \var lc_Band_struct::bdBytes
+     *  Band JPEG stream, NULL on failure
+     *  \var lc_Band_struct::bdSize
+     *  Band JPEG stream size, in bytes
+     */
+
+    typedef struct lc_Band_struct {
+
+        unsigned char * bdBytes;
+        unsigned long   bdSize;
+
+    } lc_Band_t;
+
+    /*! \struct lc_Stream_struct
+     *  \brief JPEG imported stream
+     *
+     *  This structure holds an imported JPEG stream along with the offsets of
+     *  its restart markers, used to extract restart intervals without having
+     *  to decode the entropy coded data.
+     *
+     *  \var lc_Stream_struct::stBytes
+     *  JPEG stream
+     *  \var lc_Stream_struct::stSize
+     *  JPEG stream size, in bytes
+     *  \var lc_Stream_struct::stFrame
+     *  Start of frame marker offset
+     *  \var lc_Stream_struct::stEntropy
+     *  Entropy coded data offset
+     *  \var lc_Stream_struct::stEnd
+     *  Entropy coded data end offset
+     *  \var lc_Stream_struct::stMark
+     *  Restart markers offsets
+     *  \var lc_Stream_struct::stMarks
+     *  Restart markers count
+     */
+
+    typedef struct lc_Stream_struct {
+
+        unsigned char * stBytes;
+        size_t          stSize;
+        size_t          stFrame;
+        size_t          stEntropy;
+        size_t          stEnd;
+        size_t        * stMark;
+        int             stMarks;
+
+    } lc_Stream_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief JPEG exportation
+     *
+     *  This function exports the provided image in JPEG format. The image is
+     *  cut in horizontal bands, aligned on MCU rows, that are encoded in
+     *  parallel with a restart marker at each MCU row. The bands streams are
+     *  then stitched in a single stream, the restart markers being renumbered
+     *  and one being inserted between consecutive bands. The image rows are
+     *  read in place, blue, green, red ordered pixels being handled by the
+     *  codec itself. Images larger than JPEG_MAX_DIMENSION in any direction
+     *  are refused, as the frame header stores 16 bits dimensions.
+     *
+     *  \param  lcPath    Image exportation path
+     *  \param  lcImage   Image to export, with 1, 3 or 4 layers of 8 bits
+     *  \param  lcQuality JPEG image quality, between 0 and 100
+     *
+     *  \return The function returns a non zero value if exportation succeed,
+     *  zero otherwise
+     */
+
+    int lc_jpeg_write ( char const * const lcPath, IplImage const * const lcImage, int const lcQuality );
+
+    /*! \brief JPEG band encoding
+     *
+     *  This function encodes the provided rows of the image as a standalone
+     *  JPEG stream in memory, with a restart marker at each MCU row.
+     *
+     *  \param  lcImage   Image to export
+     *  \param  lcRow     Band first row
+     *  \param  lcHeight  Band rows count
+     *  \param  lcQuality JPEG image quality
+     *  \param  lcBand    Returned band stream
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_jpeg_band ( 
+
+        IplImage const * const lcImage, 
+        int              const lcRow, 
+        int              const lcHeight, 
+        int              const lcQuality, 
+        lc_Band_t      * const lcBand 
+
+    );
+
+    /*! \brief JPEG importation
+     *
+     *  This function imports the provided JPEG image. The image is cut in
+     *  horizontal slices, aligned on MCU rows, that are decoded in parallel in
+     *  place in the returned image rows. If the stream comes with restart
+     *  markers aligned on MCU rows, each slice is decoded from a standalone
+     *  stream made of the stream headers and of the slice restart intervals.
+     *  Otherwise, the entropy coded data are decoded in a single serial pass
+     *  and the slices coefficients are re-encoded in standalone streams that
+     *  are decoded in parallel - inverse DCT, upsampling and color conversion
+     *  being the parallel part. When chroma components are vertically
+     *  subsampled, the slices overlap by one restart period so that upsampled
+     *  rows are identical to a single pass decoding.
+     *
+     *  A region can be provided to restrict the decoding to it. Only the MCU
+     *  rows covering the region are then decoded and, with restart markers,
+     *  only the restart intervals covering it, the entropy coded data of the
+     *  other intervals being skipped. Without restart markers, the rows above
+     *  the region are entropy decoded only and the region columns are cropped
+     *  by the codec. The image content outside of the region is undefined.
+     *
+     *  A sampling density can be provided to decode a reduced image through
+     *  the codec scaled inverse DCT. The largest scale among 1/2, 1/4 and 1/8
+     *  keeping the image density above the requested one is selected, the
+     *  image size being reduced accordingly. The caller retrieves the applied
+     *  scale from the returned image size.
+     *
+     *  Only 8 bits grayscale, YCbCr and RGB streams are handled, the function
+     *  failing otherwise so that the caller can fall back on OpenCV.
+     *
+     *  \param  lcPath    Image importation path
+     *  \param  lcLayers  Image layers count, 1 or 3, zero to keep the stream
+     *                    layers count
+     *  \param  lcRegion  Decoded region, in full resolution pixels, NULL for
+     *                    the entire image
+     *  \param  lcDensity Required sampling density relative to the full
+     *                    resolution, full resolution if not in ]0,1[
+     *
+     *  \return Returns imported image, NULL on failure
+     */
+
+    IplImage * lc_jpeg_read ( char const * const lcPath, int const lcLayers, CvRect const * const lcRegion, double const lcDensity );
+
+    /*! \brief JPEG image size
+     *
+     *  This function reads the headers of the provided JPEG image to retrieve
+     *  its size without decoding it.
+     *
+     *  \param  lcPath Image path
+     *  \param  lcSize Returned image size
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_jpeg_size ( char const * const lcPath, CvSize * const lcSize );
+
+    /*! \brief JPEG slice stream
+     *
+     *  This function composes the standalone stream of a slice made of a
+     *  rectangle of restart intervals. The restart intervals are seen as a
+     *  grid, each row of the grid holding the intervals of a restart period.
+     *  The stream headers are copied with the frame size replaced by the slice
+     *  size, the intervals being separated by restart markers numbered from
+     *  zero.
+     *
+     *  \param  lcStream  Imported JPEG stream
+     *  \param  lcStride  Restart intervals count per restart period
+     *  \param  lcSegment Slice restart intervals rectangle
+     *  \param  lcWidth   Slice columns count
+     *  \param  lcHeight  Slice rows count
+     *  \param  lcBand    Returned slice stream
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_jpeg_slice (
+
+        lc_Stream_t const * const lcStream,
+        int                 const lcStride,
+        CvRect              const lcSegment,
+        int                 const lcWidth,
+        int                 const lcHeight,
+        lc_Band_t         * const lcBand
+
+    );
+
+    /*! \brief JPEG slice transcoding
+     *
+     *  This function encodes the provided coefficients rows of a decoded
+     *  stream as a standalone stream in memory. The coefficients are copied
+     *  without quantization so that the slice is decoded as it would be in
+     *  the original stream.
+     *
+     *  \param  lcSource Decoder holding the stream coefficients
+     *  \param  lcRows   Coefficients rows of each component
+     *  \param  lcRow    Slice first MCU row
+     *  \param  lcHeight Slice rows count
+     *  \param  lcBand   Returned slice stream
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_jpeg_transcode (
+
+        j_decompress_ptr         lcSource,
+        JBLOCKROW  const * const lcRows[],
+        int                const lcRow,
+        int                const lcHeight,
+        lc_Band_t        * const lcBand
+
+    );
+
+    /*! \brief JPEG slice decoding
+     *
+     *  This function decodes the kept region of the provided slice stream in
+     *  the image. The rows preceding the kept region are skipped and the
+     *  decoding stops after its last row. When the kept region does not cover
+     *  the slice columns, the codec crops the decoded columns and the kept
+     *  columns are copied from a scratch row, the rows being decoded in place
+     *  otherwise.
+     *
+     *  \param  lcBand   Slice stream
+     *  \param  lcImage  Decoded image
+     *  \param  lcColumn Image column of the slice first column
+     *  \param  lcRow    Image row of the slice first row
+     *  \param  lcKeep   Kept image region
+     *  \param  lcScale  Reduced decoding scale denominator
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_jpeg_decode (
+
+        lc_Band_t const * const lcBand,
+        IplImage        * const lcImage,
+        int               const lcColumn,
+        int               const lcRow,
+        CvRect            const lcKeep,
+        int               const lcScale
+
+    );
+
+    /*! \brief JPEG stream segments
+     *
+     *  This function walks the markers segments of a JPEG stream up to the
+     *  start of scan segment and returns the offset of the entropy coded
+     *  data that follows it.
+     *
+     *  \param  lcBytes JPEG stream
+     *  \param  lcSize  JPEG stream size, in bytes
+     *  \param  lcFrame Returned offset of the start of frame marker
+     *
+     *  \return Returns entropy coded data offset, zero if not found
+     */
+
+    size_t lc_jpeg_entropy ( unsigned char const * const lcBytes, size_t const lcSize, size_t * const lcFrame );
+
+    /*! \brief JPEG codec fatal error
+     *
+     *  This function replaces the libjpeg fatal error handler. It returns to
+     *  the context stored in the error manager instead of exiting.
+     *
+     *  \param  lcInfo libjpeg codec structure
+     */
+
+    void lc_jpeg_error ( j_common_ptr lcInfo );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
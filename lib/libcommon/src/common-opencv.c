@@ -43,6 +43,150 @@
 
     # include "common-opencv.h"
 
+/*
+    Source - Image importation interface
+ */
+
+    IplImage * lc_imread( char const * const lcPath, int const lcFlag ) {
+
+        /* Entire image importation */
+        return( lc_imread_partial( lcPath, lcFlag, NULL, 1.0 ) );
+
+    }
+
+    IplImage * lc_imread_partial( char const * const lcPath, int const lcFlag, CvRect const * const lcRegion, double const lcDensity ) {
+
+        /* Cache entry variables */
+        char lcEntry[PATH_MAX];
+
+        /* Image size variables */
+        CvSize lcSize;
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Check standard input stream */
+        if ( strcmp( lcPath, LC_CANVAS_STREAM ) == 0 ) {
+
+            /* Raw canvas stream importation */
+            return( lc_canvas_pull( stdin, lcFlag == CV_LOAD_IMAGE_GRAYSCALE ? 1 : ( lcFlag == CV_LOAD_IMAGE_COLOR ? 3 : 0 ) ) );
+
+        } else
+        if ( strncmp( lcPath, LC_CANVAS_SHM, strlen( LC_CANVAS_SHM ) ) == 0 ) {
+
+            /* Shared memory segment mapping - no copy */
+            return( lc_canvas_attach( lcPath, lcFlag == CV_LOAD_IMAGE_GRAYSCALE ? 1 : ( lcFlag == CV_LOAD_IMAGE_COLOR ? 3 : 0 ) ) );
+
+        }
+
+        /* Check decoded images cache - images exceeding the budget not decoded entirely */
+        if ( ( lc_cache_entry( lcPath, lcFlag, lcEntry ) == LC_TRUE ) && ( ( lc_imsize( lcPath, & lcSize ) == LC_FALSE ) || ( ( off_t ) lcSize.width * lcSize.height * 4 <= lc_cache_budget() ) ) ) {
+
+            /* Map cached image - no decoding */
+            if ( ( lcImage = lc_cache_read( lcEntry ) ) != NULL ) return( lcImage );
+
+            /* Decode entire image - cached for following processes */
+            if ( ( lcImage = lc_imread_decode( lcPath, lcFlag, NULL, 1.0 ) ) != NULL ) lc_cache_write( lcEntry, lcImage );
+
+            /* Return imported image */
+            return( lcImage );
+
+        }
+
+        /* Image decoding */
+        return( lc_imread_decode( lcPath, lcFlag, lcRegion, lcDensity ) );
+
+    }
+
+    IplImage * lc_imread_decode( char const * const lcPath, int const lcFlag, CvRect const * const lcRegion, double const lcDensity ) {
+
+        /* Extension pointer variables */
+        char const * lcExt = strrchr( lcPath, '.' );
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Check native decoder flags */
+        if ( ( lcExt != NULL ) && ( ( lcFlag == CV_LOAD_IMAGE_UNCHANGED ) || ( lcFlag == CV_LOAD_IMAGE_GRAYSCALE ) || ( lcFlag == CV_LOAD_IMAGE_COLOR ) ) ) {
+
+            /* Search image type */
+            if ( ( strcasecmp( lcExt + 1, "jpg" ) == 0 ) || ( strcasecmp( lcExt + 1, "jpeg" ) == 0 ) ) {
+
+                /* Native parallel importation */
+                lcImage = lc_jpeg_read( lcPath, lcFlag == CV_LOAD_IMAGE_UNCHANGED ? 0 : ( lcFlag == CV_LOAD_IMAGE_GRAYSCALE ? 1 : 3 ), lcRegion, lcDensity );
+
+            } else
+            if ( ( strcasecmp( lcExt + 1, "tif" ) == 0 ) || ( strcasecmp( lcExt + 1, "tiff" ) == 0 ) ) {
+
+                /* Native parallel importation - tiled images only */
+                lcImage = lc_tiff_read( lcPath, lcFlag == CV_LOAD_IMAGE_UNCHANGED ? 0 : ( lcFlag == CV_LOAD_IMAGE_GRAYSCALE ? 1 : 3 ), lcRegion );
+
+            } else
+            if ( strcasecmp( lcExt + 1, "nrc" ) == 0 ) {
+
+                /* Raw canvas importation - no OpenCV fallback */
+                return( lc_canvas_read( lcPath, lcFlag == CV_LOAD_IMAGE_UNCHANGED ? 0 : ( lcFlag == CV_LOAD_IMAGE_GRAYSCALE ? 1 : 3 ), lcRegion ) );
+
+            }
+
+        }
+
+        /* Standard importation method - native importation failure */
+        return( lcImage != NULL ? lcImage : cvLoadImage( lcPath, lcFlag ) );
+
+    }
+
+/*
+    Source - Image size interface
+ */
+
+    int lc_imsize( char const * const lcPath, CvSize * const lcSize ) {
+
+        /* Extension pointer variables */
+        char const * lcExt = strrchr( lcPath, '.' );
+
+        /* Check shared memory segment */
+        if ( strncmp( lcPath, LC_CANVAS_SHM, strlen( LC_CANVAS_SHM ) ) == 0 ) return( lc_canvas_size( lcPath, lcSize ) );
+
+        /* Check extension */
+        if ( lcExt == NULL ) return( LC_FALSE );
+
+        /* Search image type */
+        if ( ( strcasecmp( lcExt + 1, "jpg" ) == 0 ) || ( strcasecmp( lcExt + 1, "jpeg" ) == 0 ) ) {
+
+            /* Read size from JPEG headers */
+            return( lc_jpeg_size( lcPath, lcSize ) );
+
+        } else
+        if ( ( strcasecmp( lcExt + 1, "tif" ) == 0 ) || ( strcasecmp( lcExt + 1, "tiff" ) == 0 ) ) {
+
+            /* Read size from TIFF directory */
+            return( lc_tiff_size( lcPath, lcSize ) );
+
+        } else
+        if ( strcasecmp( lcExt + 1, "nrc" ) == 0 ) {
+
+            /* Read size from canvas header */
+            return( lc_canvas_size( lcPath, lcSize ) );
+
+        }
+
+        /* Unknown image size */
+        return( LC_FALSE );
+
+    }
+
+/*
+    Source - Image release interface
+ */
+
+    void lc_imrelease( IplImage ** const lcImage ) {
+
+        /* Unmap or release image */
+        lc_canvas_close( lcImage );
+
+    }
+
 /*
     Source - Image exportation interface
  */
@@ -53,16 +197,40 @@
         char * lcExt = strrchr( lcPath, '.' );
 
         /* Search image type */
-        if ( ( lcOption >= 0 ) && ( ( strcasecmp( lcExt + 1, "jpg" ) == 0 ) || ( strcasecmp( lcExt + 1, "jpeg" ) == 0 ) ) ) {
+        if ( strcmp( lcPath, LC_CANVAS_STREAM ) == 0 ) {
+
+            /* Raw canvas stream exportation - options ignored */
+            return( lc_canvas_push( stdout, lcImage ) );
 
-            /* Specific exportation method */
-            return( lc_imwrite_jpeg( lcPath, lcImage, lcOption ) );
+        } else
+        if ( strncmp( lcPath, LC_CANVAS_SHM, strlen( LC_CANVAS_SHM ) ) == 0 ) {
+
+            /* Shared memory segment exportation - options ignored */
+            return( lc_canvas_write( lcPath, lcImage ) );
 
         } else
-        if ( ( lcOption >= 0 ) && ( strcasecmp( lcExt + 1, "png" ) == 0 ) ) {
+        if ( ( lcExt != NULL ) && ( ( strcasecmp( lcExt + 1, "jpg" ) == 0 ) || ( strcasecmp( lcExt + 1, "jpeg" ) == 0 ) ) ) {
 
-            /* Specific exportation method */
-            return( lc_imwrite_png( lcPath, lcImage, lcOption ) );
+            /* Specific exportation method - OpenCV default quality kept */
+            return( lc_imwrite_jpeg( lcPath, lcImage, lcOption >= 0 ? lcOption : LC_JPEG_QUALITY ) );
+
+        } else
+        if ( ( lcExt != NULL ) && ( strcasecmp( lcExt + 1, "png" ) == 0 ) ) {
+
+            /* Specific exportation method - OpenCV default compression kept */
+            return( lc_imwrite_png( lcPath, lcImage, lcOption >= 0 ? lcOption : LC_PNG_COMPRESSION ) );
+
+        } else
+        if ( ( lcExt != NULL ) && ( ( strcasecmp( lcExt + 1, "tif" ) == 0 ) || ( strcasecmp( lcExt + 1, "tiff" ) == 0 ) ) ) {
+
+            /* Specific exportation method - zlib default compression kept */
+            return( lc_imwrite_tiff( lcPath, lcImage, lcOption >= 0 ? lcOption : LC_TIFF_COMPRESSION ) );
+
+        } else
+        if ( ( lcExt != NULL ) && ( strcasecmp( lcExt + 1, "nrc" ) == 0 ) ) {
+
+            /* Raw canvas exportation - options ignored */
+            return( lc_canvas_write( lcPath, lcImage ) );
 
         } else {
 
@@ -82,6 +250,14 @@
         /* Option array variables */
         int lcOptions[2] = { CV_IMWRITE_JPEG_QUALITY, ( lcQuality > 100 ) ? 100: ( ( lcQuality < 0 ) ? 0 : lcQuality ) };
 
+        /* Check native encoder image layout */
+        if ( ( lcImage->depth == IPL_DEPTH_8U ) && ( lcImage->origin == IPL_ORIGIN_TL ) && ( lcImage->roi == NULL ) && ( ( lcImage->nChannels == 1 ) || ( lcImage->nChannels == 3 ) || ( lcImage->nChannels == 4 ) ) ) {
+
+            /* Native parallel exportation */
+            return( lc_jpeg_write( lcPath, lcImage, lcOptions[1] ) );
+
+        }
+
         /* Image exportation */
         return( cvSaveImage(  lcPath, lcImage, lcOptions ) );
 
@@ -92,8 +268,31 @@
         /* Option array variables */
         int lcOptions[2] = { CV_IMWRITE_PNG_COMPRESSION, ( lcCompression > 9 ) ? 9 : ( ( lcCompression < 0 ) ? 0 : lcCompression ) };
 
+        /* Check native encoder image layout */
+        if ( ( lcImage->depth == IPL_DEPTH_8U ) && ( lcImage->origin == IPL_ORIGIN_TL ) && ( lcImage->roi == NULL ) && ( ( lcImage->nChannels == 1 ) || ( lcImage->nChannels == 3 ) || ( lcImage->nChannels == 4 ) ) ) {
+
+            /* Native parallel exportation */
+            return( lc_png_write( lcPath, lcImage, lcOptions[1] ) );
+
+        }
+
         /* Image exportation */
         return( cvSaveImage(  lcPath, lcImage, lcOptions ) );
 
     }
 
+    int lc_imwrite_tiff( char * lcPath, IplImage * lcImage, int lcCompression ) {
+
+        /* Check native encoder image layout */
+        if ( ( lcImage->depth == IPL_DEPTH_8U ) && ( lcImage->origin == IPL_ORIGIN_TL ) && ( lcImage->roi == NULL ) && ( ( lcImage->nChannels == 1 ) || ( lcImage->nChannels == 3 ) || ( lcImage->nChannels == 4 ) ) ) {
+
+            /* Native parallel exportation */
+            return( lc_tiff_write( lcPath, lcImage, ( lcCompression > 9 ) ? 9 : ( ( lcCompression < 0 ) ? 0 : lcCompression ) ) );
+
+        }
+
+        /* Image exportation */
+        return( cvSaveImage( lcPath, lcImage, NULL ) );
+
+    }
+
@@ -62,6 +62,11 @@
  */
 
     # include "common.h"
+    # include "common-jpeg.h"
+    # include "common-png.h"
+    # include "common-tiff.h"
+    # include "common-canvas.h"
+    # include "common-cache.h"
     # include <opencv/cv.h>
     # include <opencv/highgui.h>
 
@@ -85,13 +90,111 @@
     Header - Function prototypes
  */
 
+    /*! \brief Image importation interface
+     *
+     *  This function is a front end to the OpenCV image importation function.
+     *  JPEG images and tiled TIFF images are decoded in parallel by the native
+     *  importations, the OpenCV importation being used for the other formats,
+     *  or when the native importation fails on a stream it does not handle.
+     *  Raw canvas images, of nrc extension, are only read by lc_canvas_read.
+     *  The LC_CANVAS_STREAM path reads a raw canvas from the standard input
+     *  and paths of LC_CANVAS_SHM prefix map the named shared memory segment
+     *  without copy. Images have then to be released using lc_imrelease.
+     *  The determination of the input format is made on the basis of the file
+     *  extention.
+     *
+     *  \param  lcPath          Image importation path
+     *  \param  lcFlag          OpenCV importation flag
+     *
+     *  \return Returns imported image, NULL on failure
+     */
+
+    IplImage * lc_imread ( char const * const lcPath, int const lcFlag );
+
+    /*! \brief Image importation interface
+     *
+     *  This function imports the provided image as lc_imread does, the native
+     *  JPEG importation decoding only the provided region of the image. The
+     *  image content outside of the region is undefined, unless the image is
+     *  imported in its entirety by OpenCV.
+     *
+     *  The native JPEG importation also decodes a reduced image, through the
+     *  codec scaled inverse DCT, when the provided sampling density allows it.
+     *  The caller has to deduce the applied scale from the imported image
+     *  size, OpenCV always importing the image at full resolution.
+     *
+     *  When the decoded images cache is enabled by the LC_CACHE_PATH
+     *  environment variable, the image is mapped from the cache if another
+     *  process already decoded it. Otherwise it is decoded in its entirety and
+     *  at full resolution, and stored in the cache. The region and density are
+     *  then not considered.
+     *
+     *  \param  lcPath          Image importation path
+     *  \param  lcFlag          OpenCV importation flag
+     *  \param  lcRegion        Decoded region, in full resolution pixels, NULL
+     *                          for the entire image
+     *  \param  lcDensity       Required sampling density relative to the full
+     *                          resolution, in ]0,1], full resolution otherwise
+     *
+     *  \return Returns imported image, NULL on failure
+     */
+
+    IplImage * lc_imread_partial ( char const * const lcPath, int const lcFlag, CvRect const * const lcRegion, double const lcDensity );
+
+    /*! \brief Image decoding methods
+     *
+     *  This function decodes the provided image file, selecting the native or
+     *  OpenCV importation according to the file extension. It implements the
+     *  decoding of lc_imread_partial, without the streams, shared memory and
+     *  cache front end.
+     *
+     *  \param  lcPath          Image importation path
+     *  \param  lcFlag          OpenCV importation flag
+     *  \param  lcRegion        Decoded region, in full resolution pixels, NULL
+     *                          for the entire image
+     *  \param  lcDensity       Required sampling density relative to the full
+     *                          resolution, in ]0,1], full resolution otherwise
+     *
+     *  \return Returns imported image, NULL on failure
+     */
+
+    IplImage * lc_imread_decode ( char const * const lcPath, int const lcFlag, CvRect const * const lcRegion, double const lcDensity );
+
+    /*! \brief Image size interface
+     *
+     *  This function reads the size of the provided image from its headers,
+     *  without decoding it. Only JPEG, TIFF and raw canvas images, including
+     *  shared memory segments, are handled. The determination of the input
+     *  format is made on the basis of the file extention.
+     *
+     *  \param  lcPath          Image path
+     *  \param  lcSize          Returned image size
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_imsize ( char const * const lcPath, CvSize * const lcSize );
+
+    /*! \brief Image release interface
+     *
+     *  This function releases the provided image, imported by lc_imread. The
+     *  images mapping a shared memory segment are unmapped, the others being
+     *  released using cvReleaseImage. The pointer is set to NULL.
+     *
+     *  \param  lcImage         Pointer to image to release
+     */
+
+    void lc_imrelease ( IplImage ** const lcImage );
+
     /*! \brief Image exportation interface
      *
      *  This function is a simple front end to the OpenCV image exportation
      *  function. It simply takes care of specific options that can be passed to
      *  the OpenCV function according to the image format such as compression
-     *  or quality. The determination of the output format is made on the basis
-     *  of the file extention.
+     *  or quality. Raw canvas images, of nrc extension, are written without
+     *  options by lc_canvas_write, as for the shared memory segments of
+     *  LC_CANVAS_SHM prefix and the standard output, of LC_CANVAS_STREAM path. The determination of the output format is
+     *  made on the basis of the file extention.
      *
      *  \param  lcPath          Image exportation path
      *  \param  lcImage         Image to export
@@ -105,9 +208,10 @@
 
     /*! \brief Image exportation methods
      *
-     *  This function uses the OpenCV exportation method to export the provided
-     *  image in JPEG format using the specified quality value. The JPEG quality
-     *  value has to be between 0 and 100.
+     *  This function exports the provided image in JPEG format using the
+     *  specified quality value. The JPEG quality value has to be between 0 and
+     *  100. Images of 8 bits layers are encoded in parallel by the native JPEG
+     *  exportation, the OpenCV exportation method being used otherwise.
      *
      *  \param  lcPath          Image exportation path
      *  \param  lcImage         Image to export
@@ -121,9 +225,11 @@
 
     /*! \brief Image exportation methods
      *
-     *  This function uses the OpenCV exportation method to export the provided
-     *  image in PNG format using the specified compression value. The PNG
-     *  compression value has to be between 0 and 9.
+     *  This function exports the provided image in PNG format using the
+     *  specified compression value. The PNG compression value has to be
+     *  between 0 and 9. Images of 8 bits layers are compressed in parallel by
+     *  the native PNG exportation, the OpenCV exportation method being used
+     *  otherwise.
      *
      *  \param  lcPath          Image exportation path
      *  \param  lcImage         Image to export
@@ -135,6 +241,23 @@
 
     int lc_imwrite_png ( char * lcPath, IplImage * lcImage, int lcCompression );
 
+    /*! \brief Image exportation methods
+     *
+     *  This function exports the provided image in tiled TIFF format using
+     *  the specified deflate compression value, between 0 and 9. Images of 8
+     *  bits layers are compressed in parallel by the native TIFF exportation,
+     *  the OpenCV exportation method being used otherwise.
+     *
+     *  \param  lcPath          Image exportation path
+     *  \param  lcImage         Image to export
+     *  \param  lcCompression   Deflate compression level
+     *
+     *  \return The function returns a non zero value if exportation succeed,
+     *  zero otherwise - repport OpenCV function value
+     */
+
+    int lc_imwrite_tiff ( char * lcPath, IplImage * lcImage, int lcCompression );
+
 /* 
     Header - C/C++ compatibility
  */
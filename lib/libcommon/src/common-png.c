@@ -0,0 +1,502 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-png.h"
+
+/*
+    Source - PNG exportation
+ */
+
+    int lc_png_write( char const * const lcPath, IplImage const * const lcImage, int const lcCompression ) {
+
+        /* PNG signature variables */
+        static unsigned char const lcSignature[8] = { 0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A };
+
+        /* Chunks variables */
+        lc_Chunk_t * lcChunk = NULL;
+
+        /* Chunks geometry variables */
+        size_t lcLength = 1 + ( size_t ) lcImage->width * lcImage->nChannels;
+        int    lcStep   = 0;
+        int    lcCount  = 0;
+
+        /* Stream checksum variables */
+        unsigned long lcAdler = adler32( 0L, Z_NULL, 0 );
+
+        /* Image header variables */
+        unsigned char lcHeader[13] = { 0 };
+
+        /* Exportation stream variables */
+        FILE * lcStream = NULL;
+
+        /* Returned value variables */
+        int lcReturn = LC_TRUE;
+
+        /* Parsing variables */
+        int lcChunks = 0;
+
+        /* Compute chunks height - compression block size */
+        lcStep = ( lcLength < LC_PNG_BLOCK ) ? LC_PNG_BLOCK / lcLength : 1;
+
+        /* Compute chunks count */
+        lcCount = ( lcImage->height + lcStep - 1 ) / lcStep;
+
+        /* Allocate chunks */
+        if ( ( lcChunk = ( lc_Chunk_t * ) calloc( lcCount, sizeof( lc_Chunk_t ) ) ) == NULL ) return( 0 );
+
+        /* Compress chunks */
+        # pragma omp parallel for private( lcChunks ) schedule( dynamic )
+        for ( lcChunks = 0; lcChunks < lcCount; lcChunks ++ ) {
+
+            /* Compress chunk */
+            lc_png_chunk( lcImage, lcChunks * lcStep, ( lcChunks + 1 ) * lcStep > lcImage->height ? lcImage->height - lcChunks * lcStep : lcStep, lcCompression, lcChunk + lcChunks );
+
+        }
+
+        /* Verify chunks streams */
+        for ( lcChunks = 0; ( lcChunks < lcCount ) && ( lcReturn == LC_TRUE ); lcChunks ++ ) {
+
+            /* Verify chunk stream */
+            if ( lcChunk[lcChunks].chBytes == NULL ) lcReturn = LC_FALSE;
+
+            /* Combine stream checksum */
+            else lcAdler = adler32_combine( lcAdler, lcChunk[lcChunks].chAdler, lcChunk[lcChunks].chLength );
+
+        }
+
+        /* Check chunks streams */
+        if ( lcReturn == LC_TRUE ) {
+
+            /* Append stream checksum to last chunk - room left by compression */
+            lcChunk[lcCount - 1].chBytes[lcChunk[lcCount - 1].chSize ++] = ( lcAdler >> 24 ) & 0xFF;
+            lcChunk[lcCount - 1].chBytes[lcChunk[lcCount - 1].chSize ++] = ( lcAdler >> 16 ) & 0xFF;
+            lcChunk[lcCount - 1].chBytes[lcChunk[lcCount - 1].chSize ++] = ( lcAdler >>  8 ) & 0xFF;
+            lcChunk[lcCount - 1].chBytes[lcChunk[lcCount - 1].chSize ++] = ( lcAdler       ) & 0xFF;
+
+        }
+
+        /* Compose image header - size */
+        lcHeader[0] = ( lcImage->width  >> 24 ) & 0xFF;
+        lcHeader[1] = ( lcImage->width  >> 16 ) & 0xFF;
+        lcHeader[2] = ( lcImage->width  >>  8 ) & 0xFF;
+        lcHeader[3] = ( lcImage->width        ) & 0xFF;
+        lcHeader[4] = ( lcImage->height >> 24 ) & 0xFF;
+        lcHeader[5] = ( lcImage->height >> 16 ) & 0xFF;
+        lcHeader[6] = ( lcImage->height >>  8 ) & 0xFF;
+        lcHeader[7] = ( lcImage->height       ) & 0xFF;
+
+        /* Compose image header - bit depth and color type */
+        lcHeader[8] = 8;
+        lcHeader[9] = ( lcImage->nChannels == 1 ) ? 0 : ( ( lcImage->nChannels == 3 ) ? 2 : 6 );
+
+        /* Create exportation stream */
+        if ( ( lcReturn == LC_TRUE ) && ( ( lcStream = fopen( lcPath, "wb" ) ) != NULL ) ) {
+
+            /* Export signature and image header */
+            if ( fwrite( lcSignature, 1, 8, lcStream ) != 8 ) lcReturn = LC_FALSE;
+            if ( lc_png_block( lcStream, "IHDR", lcHeader, 13 ) == LC_FALSE ) lcReturn = LC_FALSE;
+
+            /* Export chunks streams - one image data chunk each */
+            for ( lcChunks = 0; ( lcChunks < lcCount ) && ( lcReturn == LC_TRUE ); lcChunks ++ ) {
+
+                /* Export chunk stream */
+                if ( lc_png_block( lcStream, "IDAT", lcChunk[lcChunks].chBytes, lcChunk[lcChunks].chSize ) == LC_FALSE ) lcReturn = LC_FALSE;
+
+            }
+
+            /* Export image end */
+            if ( lc_png_block( lcStream, "IEND", NULL, 0 ) == LC_FALSE ) lcReturn = LC_FALSE;
+
+            /* Close exportation stream */
+            if ( fclose( lcStream ) != 0 ) lcReturn = LC_FALSE;
+
+        } else { lcReturn = LC_FALSE; }
+
+        /* Release chunks streams */
+        for ( lcChunks = 0; lcChunks < lcCount; lcChunks ++ ) free( lcChunk[lcChunks].chBytes );
+
+        /* Release chunks */
+        free( lcChunk );
+
+        /* Return status */
+        return( lcReturn == LC_TRUE ? 1 : 0 );
+
+    }
+
+/*
+    Source - PNG chunk compression
+ */
+
+    int lc_png_chunk( 
+
+        IplImage const * const lcImage, 
+        int              const lcRow, 
+        int              const lcHeight, 
+        int              const lcCompression, 
+        lc_Chunk_t     * const lcChunk 
+
+    ) {
+
+        /* Rows size variables */
+        size_t lcLength = 1 + ( size_t ) lcImage->width * lcImage->nChannels;
+
+        /* Dictionary variables */
+        int    lcPrior  = ( LC_PNG_WINDOW + lcLength - 1 ) / lcLength;
+        size_t lcWindow = 0;
+
+        /* Stream header variables */
+        size_t lcHead = ( lcRow == 0 ) ? 2 : 0;
+
+        /* Stream bound variables */
+        size_t lcBound = 0;
+
+        /* Filtered rows variables */
+        unsigned char * lcFilter  = NULL;
+        unsigned char * lcScratch = NULL;
+
+        /* Deflate variables */
+        z_stream lcDeflate;
+
+        /* Deflate status variables */
+        int lcStatus = Z_OK;
+
+        /* Last chunk variables */
+        int lcLast = ( lcRow + lcHeight == lcImage->height );
+
+        /* Returned value variables */
+        int lcReturn = LC_FALSE;
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* Reset chunk stream */
+        lcChunk->chBytes  = NULL;
+        lcChunk->chSize   = 0;
+        lcChunk->chLength = ( size_t ) lcHeight * lcLength;
+
+        /* Clamp dictionary rows on image */
+        if ( lcPrior > lcRow ) lcPrior = lcRow;
+
+        /* Allocate filtered rows and scratch rows */
+        if ( ( ( lcFilter = ( unsigned char * ) malloc( ( size_t ) ( lcPrior + lcHeight ) * lcLength ) ) == NULL ) || ( ( lcScratch = ( unsigned char * ) malloc( 3 * ( lcLength - 1 ) ) ) == NULL ) ) {
+
+            /* Release filtered rows */
+            free( lcFilter );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Filter dictionary and chunk rows */
+        for ( lcParse = 0; lcParse < lcPrior + lcHeight; lcParse ++ ) lc_png_filter( lcImage, lcRow - lcPrior + lcParse, lcCompression, lcFilter + ( size_t ) lcParse * lcLength, lcScratch );
+
+        /* Compute chunk checksum */
+        lcChunk->chAdler = adler32( adler32( 0L, Z_NULL, 0 ), lcFilter + ( size_t ) lcPrior * lcLength, lcChunk->chLength );
+
+        /* Initialize deflate structure */
+        memset( & lcDeflate, 0, sizeof( z_stream ) );
+
+        /* Create raw deflate stream - libpng strategy */
+        if ( deflateInit2( & lcDeflate, lcCompression, Z_DEFLATED, -MAX_WBITS, 8, lcCompression == 0 ? Z_DEFAULT_STRATEGY : Z_FILTERED ) == Z_OK ) {
+
+            /* Compute dictionary size */
+            lcWindow = ( size_t ) lcPrior * lcLength > LC_PNG_WINDOW ? LC_PNG_WINDOW : ( size_t ) lcPrior * lcLength;
+
+            /* Assign dictionary - previous chunk last filtered bytes */
+            if ( lcWindow > 0 ) deflateSetDictionary( & lcDeflate, lcFilter + ( size_t ) lcPrior * lcLength - lcWindow, lcWindow );
+
+            /* Compute stream bound - synchronization flush marker included */
+            lcBound = deflateBound( & lcDeflate, lcChunk->chLength ) + 16;
+
+            /* Allocate chunk stream - stream header and checksum room included */
+            if ( ( lcChunk->chBytes = ( unsigned char * ) malloc( lcHead + lcBound + 4 ) ) != NULL ) {
+
+                /* Check first chunk */
+                if ( lcHead > 0 ) {
+
+                    /* Compose stream header - deflate method and compression level */
+                    lcChunk->chBytes[0] = 0x78;
+                    lcChunk->chBytes[1] = ( lcCompression < 2 ? 0 : ( lcCompression < 6 ? 1 : ( lcCompression == 6 ? 2 : 3 ) ) ) << 6;
+
+                    /* Compose stream header check */
+                    lcChunk->chBytes[1] += 31 - ( ( lcChunk->chBytes[0] << 8 ) + lcChunk->chBytes[1] ) % 31;
+
+                }
+
+                /* Assign deflate buffers */
+                lcDeflate.next_in   = lcFilter + ( size_t ) lcPrior * lcLength;
+                lcDeflate.avail_in  = lcChunk->chLength;
+                lcDeflate.next_out  = lcChunk->chBytes + lcHead;
+                lcDeflate.avail_out = lcBound;
+
+                /* Deflate chunk rows - ended on byte border */
+                lcStatus = deflate( & lcDeflate, lcLast ? Z_FINISH : Z_SYNC_FLUSH );
+
+                /* Verify deflate completion */
+                if ( ( lcDeflate.avail_in == 0 ) && ( lcDeflate.avail_out > 0 ) && ( lcStatus == ( lcLast ? Z_STREAM_END : Z_OK ) ) ) {
+
+                    /* Assign chunk stream size */
+                    lcChunk->chSize = lcHead + lcBound - lcDeflate.avail_out;
+
+                    /* Update status */
+                    lcReturn = LC_TRUE;
+
+                }
+
+            }
+
+            /* Release deflate stream */
+            deflateEnd( & lcDeflate );
+
+        }
+
+        /* Check failure */
+        if ( lcReturn == LC_FALSE ) {
+
+            /* Release chunk stream */
+            free( lcChunk->chBytes );
+
+            /* Reset chunk stream */
+            lcChunk->chBytes = NULL;
+
+        }
+
+        /* Release filtered rows and scratch rows */
+        free( lcFilter );
+        free( lcScratch );
+
+        /* Return status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - PNG row filtering
+ */
+
+    void lc_png_filter( 
+
+        IplImage const * const lcImage, 
+        int              const lcRow, 
+        int              const lcCompression, 
+        unsigned char  * const lcLine, 
+        unsigned char  * const lcScratch 
+
+    ) {
+
+        /* Row size variables */
+        size_t lcSize  = ( size_t ) lcImage->width * lcImage->nChannels;
+        size_t lcPixel = lcImage->nChannels;
+
+        /* Rows variables */
+        unsigned char * lcCurrent  = lcScratch;
+        unsigned char * lcPrevious = lcScratch + lcSize;
+        unsigned char * lcTrial    = lcScratch + lcSize * 2;
+
+        /* Filter score variables */
+        unsigned long lcScore = 0;
+        unsigned long lcBest  = 0;
+
+        /* Predictor variables */
+        int lcA = 0;
+        int lcB = 0;
+        int lcC = 0;
+        int lcP = 0;
+
+        /* Parsing variables */
+        size_t lcParse = 0;
+        int    lcType  = 0;
+
+        /* Convert filtered row */
+        lc_png_convert( lcImage, lcRow, lcCurrent );
+
+        /* Check compression */
+        if ( lcCompression == 0 ) {
+
+            /* Assign unfiltered row */
+            lcLine[0] = 0; memcpy( lcLine + 1, lcCurrent, lcSize ); return;
+
+        }
+
+        /* Convert previous row - zero above first row */
+        if ( lcRow > 0 ) lc_png_convert( lcImage, lcRow - 1, lcPrevious ); else memset( lcPrevious, 0, lcSize );
+
+        /* Parsing filter types */
+        for ( lcType = 0; lcType < 5; lcType ++ ) {
+
+            /* Parsing row bytes */
+            for ( lcParse = 0; lcParse < lcSize; lcParse ++ ) {
+
+                /* Compose predictor neighbours */
+                lcA = ( lcParse >= lcPixel ) ? lcCurrent [lcParse - lcPixel] : 0;
+                lcB = lcPrevious[lcParse];
+                lcC = ( lcParse >= lcPixel ) ? lcPrevious[lcParse - lcPixel] : 0;
+
+                /* Select filter type */
+                switch ( lcType ) {
+
+                    /* Filter - none */
+                    case ( 0 ) : { lcP = 0; } break;
+
+                    /* Filter - sub */
+                    case ( 1 ) : { lcP = lcA; } break;
+
+                    /* Filter - up */
+                    case ( 2 ) : { lcP = lcB; } break;
+
+                    /* Filter - average */
+                    case ( 3 ) : { lcP = ( lcA + lcB ) >> 1; } break;
+
+                    /* Filter - paeth */
+                    default : {
+
+                        /* Compute paeth predictor */
+                        lcP = abs( lcB - lcC ) <= abs( lcA - lcC ) ? ( abs( lcB - lcC ) <= abs( lcA + lcB - 2 * lcC ) ? lcA : lcC ) : ( abs( lcA - lcC ) <= abs( lcA + lcB - 2 * lcC ) ? lcB : lcC );
+
+                    } break;
+
+                }
+
+                /* Compute filtered byte */
+                lcTrial[lcParse] = ( lcCurrent[lcParse] - lcP ) & 0xFF;
+
+            }
+
+            /* Compute filter score - sum of absolute signed bytes */
+            for ( lcParse = 0, lcScore = 0; lcParse < lcSize; lcParse ++ ) lcScore += ( lcTrial[lcParse] < 128 ) ? lcTrial[lcParse] : 256 - lcTrial[lcParse];
+
+            /* Keep best filter */
+            if ( ( lcType == 0 ) || ( lcScore < lcBest ) ) {
+
+                /* Update best score */
+                lcBest = lcScore;
+
+                /* Assign filtered row */
+                lcLine[0] = lcType; memcpy( lcLine + 1, lcTrial, lcSize );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - PNG row conversion
+ */
+
+    void lc_png_convert( IplImage const * const lcImage, int const lcRow, unsigned char * const lcPixel ) {
+
+        /* Image row variables */
+        unsigned char const * lcSource = ( unsigned char const * ) lcImage->imageData + ( size_t ) lcRow * lcImage->widthStep;
+
+        /* Row size variables */
+        size_t lcSize = ( size_t ) lcImage->width * lcImage->nChannels;
+
+        /* Parsing variables */
+        size_t lcParse = 0;
+
+        /* Check image layers */
+        if ( lcImage->nChannels == 1 ) {
+
+            /* Copy row */
+            memcpy( lcPixel, lcSource, lcSize );
+
+        } else {
+
+            /* Parsing row pixels */
+            for ( lcParse = 0; lcParse < lcSize; lcParse += lcImage->nChannels ) {
+
+                /* Swap blue and red components */
+                lcPixel[lcParse    ] = lcSource[lcParse + 2];
+                lcPixel[lcParse + 1] = lcSource[lcParse + 1];
+                lcPixel[lcParse + 2] = lcSource[lcParse    ];
+
+                /* Copy alpha component */
+                if ( lcImage->nChannels == 4 ) lcPixel[lcParse + 3] = lcSource[lcParse + 3];
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - PNG chunk exportation
+ */
+
+    int lc_png_block( FILE * const lcStream, char const * const lcType, unsigned char const * const lcData, size_t const lcSize ) {
+
+        /* Chunk field variables */
+        unsigned char lcField[4] = { 0 };
+
+        /* Chunk CRC variables */
+        unsigned long lcCRC = crc32( crc32( 0L, Z_NULL, 0 ), ( Bytef const * ) lcType, 4 );
+
+        /* Update chunk CRC with data */
+        if ( lcSize > 0 ) lcCRC = crc32( lcCRC, lcData, lcSize );
+
+        /* Compose chunk length */
+        lcField[0] = ( lcSize >> 24 ) & 0xFF;
+        lcField[1] = ( lcSize >> 16 ) & 0xFF;
+        lcField[2] = ( lcSize >>  8 ) & 0xFF;
+        lcField[3] = ( lcSize       ) & 0xFF;
+
+        /* Export chunk length and type */
+        if ( fwrite( lcField, 1, 4, lcStream ) != 4 ) return( LC_FALSE );
+        if ( fwrite( lcType , 1, 4, lcStream ) != 4 ) return( LC_FALSE );
+
+        /* Export chunk data */
+        if ( ( lcSize > 0 ) && ( fwrite( lcData, 1, lcSize, lcStream ) != lcSize ) ) return( LC_FALSE );
+
+        /* Compose chunk CRC */
+        lcField[0] = ( lcCRC >> 24 ) & 0xFF;
+        lcField[1] = ( lcCRC >> 16 ) & 0xFF;
+        lcField[2] = ( lcCRC >>  8 ) & 0xFF;
+        lcField[3] = ( lcCRC       ) & 0xFF;
+
+        /* Export chunk CRC */
+        return( fwrite( lcField, 1, 4, lcStream ) == 4 ? LC_TRUE : LC_FALSE );
+
+    }
+
@@ -0,0 +1,233 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-png.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  PNG codec interface
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_PNG__
+    # define __LC_PNG__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.h"
+    # include <zlib.h>
+    # include <opencv/cv.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define compression chunks size, in filtered bytes */
+    # define LC_PNG_BLOCK   131072
+
+    /* Define deflate window size - chunks dictionary */
+    # define LC_PNG_WINDOW  32768
+
+    /* Define default compression - OpenCV documented default */
+    # define LC_PNG_COMPRESSION 3
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Chunk_struct
+     *  \brief PNG compression chunk
+     *
+     *  This structure holds the deflate stream compressed for a chunk of rows
+     *  of the exported image, along with the checksum of its filtered rows.
+     *
+     *  \var lc_Chunk_struct::chBytes
+     *  Chunk deflate stream, NULL on failure
+     *  \var lc_Chunk_struct::chSize
+     *  Chunk deflate stream size, in bytes
+     *  \var lc_Chunk_struct::chLength
+     *  Chunk filtered rows size, in bytes
+     *  \var lc_Chunk_struct::chAdler
+     *  Chunk filtered rows adler-32 checksum
+     */
+
+    typedef struct lc_Chunk_struct {
+
+        unsigned char * chBytes;
+        size_t          chSize;
+        size_t          chLength;
+        unsigned long   chAdler;
+
+    } lc_Chunk_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief PNG exportation
+     *
+     *  This function exports the provided image in PNG format. The image is cut
+     *  in chunks of rows that are filtered and deflated in parallel, each chunk
+     *  using the last filtered bytes of the previous one as dictionary. Except
+     *  for the last one, the chunks deflate streams are ended on a byte border
+     *  by a synchronization flush, allowing their concatenation in the zlib
+     *  stream of the image. The stream checksum is combined from the chunks
+     *  checksums.
+     *
+     *  \param  lcPath        Image exportation path
+     *  \param  lcImage       Image to export, with 1, 3 or 4 layers of 8 bits
+     *  \param  lcCompression PNG compression level, between 0 and 9
+     *
+     *  \return The function returns a non zero value if exportation succeed,
+     *  zero otherwise
+     */
+
+    int lc_png_write ( char const * const lcPath, IplImage const * const lcImage, int const lcCompression );
+
+    /*! \brief PNG chunk compression
+     *
+     *  This function filters the provided rows of the image and deflates them
+     *  in a raw deflate stream. The rows preceding the chunk are also filtered
+     *  to provide the deflate dictionary. The zlib stream header is written at
+     *  the beginning of the first chunk, room being left for the zlib stream
+     *  checksum at the end of the last one.
+     *
+     *  \param  lcImage       Image to export
+     *  \param  lcRow         Chunk first row
+     *  \param  lcHeight      Chunk rows count
+     *  \param  lcCompression PNG compression level
+     *  \param  lcChunk       Returned chunk stream
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_png_chunk ( 
+
+        IplImage const * const lcImage, 
+        int              const lcRow, 
+        int              const lcHeight, 
+        int              const lcCompression, 
+        lc_Chunk_t     * const lcChunk 
+
+    );
+
+    /*! \brief PNG row filtering
+     *
+     *  This function converts the provided image row and its previous row in
+     *  red, green, blue ordered pixels and filters it. Without compression, the
+     *  row is not filtered. Otherwise, the filter minimizing the sum of the
+     *  absolute values of the filtered bytes is selected, as libpng does.
+     *
+     *  \param  lcImage       Image to export
+     *  \param  lcRow         Filtered row
+     *  \param  lcCompression PNG compression level
+     *  \param  lcLine        Returned filtered row, filter type included
+     *  \param  lcScratch     Scratch buffer of three rows
+     */
+
+    void lc_png_filter ( 
+
+        IplImage const * const lcImage, 
+        int              const lcRow, 
+        int              const lcCompression, 
+        unsigned char  * const lcLine, 
+        unsigned char  * const lcScratch 
+
+    );
+
+    /*! \brief PNG row conversion
+     *
+     *  This function copies the provided image row, converting blue, green,
+     *  red ordered pixels in red, green, blue ordered pixels.
+     *
+     *  \param  lcImage Image to export
+     *  \param  lcRow   Converted row
+     *  \param  lcPixel Returned converted row
+     */
+
+    void lc_png_convert ( IplImage const * const lcImage, int const lcRow, unsigned char * const lcPixel );
+
+    /*! \brief PNG chunk exportation
+     *
+     *  This function exports a PNG chunk made of the provided type and data,
+     *  preceded by its length and followed by its CRC.
+     *
+     *  \param  lcStream Exportation stream
+     *  \param  lcType   Chunk type, four characters
+     *  \param  lcData   Chunk data
+     *  \param  lcSize   Chunk data size, in bytes
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_png_block ( FILE * const lcStream, char const * const lcType, unsigned char const * const lcData, size_t const lcSize );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,548 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-tiff.h"
+
+/*
+    Source - TIFF exportation
+ */
+
+    int lc_tiff_write( char const * const lcPath, IplImage const * const lcImage, int const lcCompression ) {
+
+        /* TIFF stream variables */
+        TIFF * lcTIFF = NULL;
+
+        /* Tiles variables */
+        lc_Tile_t * lcTile = NULL;
+
+        /* Tiles geometry variables */
+        int lcAcross = ( lcImage->width  + LC_TIFF_TILE - 1 ) / LC_TIFF_TILE;
+        int lcDown   = ( lcImage->height + LC_TIFF_TILE - 1 ) / LC_TIFF_TILE;
+
+        /* Extra sample variables */
+        uint16_t lcExtra = EXTRASAMPLE_UNASSALPHA;
+
+        /* Returned value variables */
+        int lcReturn = LC_TRUE;
+
+        /* Parsing variables */
+        int lcBatch = 0;
+        int lcLimit = 0;
+        int lcParse = 0;
+
+        /* Allocate tiles batch */
+        if ( ( lcTile = ( lc_Tile_t * ) calloc( LC_TIFF_BATCH, sizeof( lc_Tile_t ) ) ) == NULL ) return( 0 );
+
+        /* Create exportation stream - BigTIFF beyond classic limit */
+        if ( ( lcTIFF = TIFFOpen( lcPath, ( size_t ) lcImage->width * lcImage->height * lcImage->nChannels > LC_TIFF_LIMIT ? "w8" : "w" ) ) == NULL ) {
+
+            /* Release tiles batch */
+            free( lcTile );
+
+            /* Send message */
+            return( 0 );
+
+        }
+
+        /* Assign image layout */
+        TIFFSetField( lcTIFF, TIFFTAG_IMAGEWIDTH     , ( uint32_t ) lcImage->width  );
+        TIFFSetField( lcTIFF, TIFFTAG_IMAGELENGTH    , ( uint32_t ) lcImage->height );
+        TIFFSetField( lcTIFF, TIFFTAG_BITSPERSAMPLE  , 8 );
+        TIFFSetField( lcTIFF, TIFFTAG_SAMPLESPERPIXEL, lcImage->nChannels );
+        TIFFSetField( lcTIFF, TIFFTAG_PHOTOMETRIC    , lcImage->nChannels == 1 ? PHOTOMETRIC_MINISBLACK : PHOTOMETRIC_RGB );
+        TIFFSetField( lcTIFF, TIFFTAG_PLANARCONFIG   , PLANARCONFIG_CONTIG );
+
+        /* Assign alpha sample */
+        if ( lcImage->nChannels == 4 ) TIFFSetField( lcTIFF, TIFFTAG_EXTRASAMPLES, 1, & lcExtra );
+
+        /* Assign tiles layout and compression */
+        TIFFSetField( lcTIFF, TIFFTAG_TILEWIDTH      , LC_TIFF_TILE );
+        TIFFSetField( lcTIFF, TIFFTAG_TILELENGTH     , LC_TIFF_TILE );
+        TIFFSetField( lcTIFF, TIFFTAG_COMPRESSION    , COMPRESSION_ADOBE_DEFLATE );
+        TIFFSetField( lcTIFF, TIFFTAG_PREDICTOR      , PREDICTOR_HORIZONTAL );
+
+        /* Parsing tiles batches */
+        for ( lcBatch = 0; ( lcBatch < lcAcross * lcDown ) && ( lcReturn == LC_TRUE ); lcBatch += LC_TIFF_BATCH ) {
+
+            /* Compute batch limit */
+            lcLimit = ( lcBatch + LC_TIFF_BATCH > lcAcross * lcDown ) ? lcAcross * lcDown : lcBatch + LC_TIFF_BATCH;
+
+            /* Compress batch tiles */
+            # pragma omp parallel for private( lcParse ) schedule( dynamic )
+            for ( lcParse = lcBatch; lcParse < lcLimit; lcParse ++ ) {
+
+                /* Compress tile */
+                lc_tiff_tile( lcImage, ( lcParse % lcAcross ) * LC_TIFF_TILE, ( lcParse / lcAcross ) * LC_TIFF_TILE, lcCompression, lcTile + lcParse - lcBatch );
+
+            }
+
+            /* Export batch tiles */
+            for ( lcParse = lcBatch; lcParse < lcLimit; lcParse ++ ) {
+
+                /* Export compressed tile - tiles enumerated row by row */
+                if ( ( lcTile[lcParse - lcBatch].tlBytes == NULL ) || ( TIFFWriteRawTile( lcTIFF, lcParse, lcTile[lcParse - lcBatch].tlBytes, lcTile[lcParse - lcBatch].tlSize ) < 0 ) ) lcReturn = LC_FALSE;
+
+                /* Release compressed tile */
+                free( lcTile[lcParse - lcBatch].tlBytes );
+
+                /* Reset compressed tile */
+                lcTile[lcParse - lcBatch].tlBytes = NULL;
+
+            }
+
+        }
+
+        /* Export image directory */
+        if ( ( lcReturn == LC_TRUE ) && ( TIFFFlush( lcTIFF ) == 0 ) ) lcReturn = LC_FALSE;
+
+        /* Close exportation stream */
+        TIFFClose( lcTIFF );
+
+        /* Release tiles batch */
+        free( lcTile );
+
+        /* Return status */
+        return( lcReturn == LC_TRUE ? 1 : 0 );
+
+    }
+
+/*
+    Source - TIFF tile compression
+ */
+
+    int lc_tiff_tile( 
+
+        IplImage const * const lcImage, 
+        int              const lcColumn, 
+        int              const lcRow, 
+        int              const lcCompression, 
+        lc_Tile_t      * const lcTile 
+
+    ) {
+
+        /* Tile geometry variables */
+        size_t lcStep   = ( size_t ) LC_TIFF_TILE * lcImage->nChannels;
+        int    lcLines  = ( lcRow    + LC_TIFF_TILE > lcImage->height ) ? lcImage->height - lcRow    : LC_TIFF_TILE;
+        int    lcPixels = ( lcColumn + LC_TIFF_TILE > lcImage->width  ) ? lcImage->width  - lcColumn : LC_TIFF_TILE;
+
+        /* Tile pixels variables */
+        unsigned char * lcPixel = NULL;
+
+        /* Compressed size variables */
+        uLongf lcSize = compressBound( lcStep * LC_TIFF_TILE );
+
+        /* Parsing variables */
+        int lcLine  = 0;
+        int lcParse = 0;
+
+        /* Reset compressed tile */
+        lcTile->tlBytes = NULL;
+        lcTile->tlSize  = 0;
+
+        /* Allocate tile pixels - zeroed outside of image */
+        if ( ( lcPixel = ( unsigned char * ) calloc( lcStep, LC_TIFF_TILE ) ) == NULL ) return( LC_FALSE );
+
+        /* Compose tile rows */
+        for ( lcLine = 0; lcLine < lcLines; lcLine ++ ) {
+
+            /* Convert image row */
+            lc_tiff_convert( ( unsigned char const * ) lcImage->imageData + ( size_t ) ( lcRow + lcLine ) * lcImage->widthStep + ( size_t ) lcColumn * lcImage->nChannels, lcImage->nChannels, lcPixel + lcLine * lcStep, lcImage->nChannels, lcPixels );
+
+            /* Apply horizontal predictor - backward to preserve predictors */
+            for ( lcParse = lcStep - 1; lcParse >= lcImage->nChannels; lcParse -- ) lcPixel[lcLine * lcStep + lcParse] -= lcPixel[lcLine * lcStep + lcParse - lcImage->nChannels];
+
+        }
+
+        /* Allocate compressed tile */
+        if ( ( lcTile->tlBytes = ( unsigned char * ) malloc( lcSize ) ) != NULL ) {
+
+            /* Compress tile - zlib stream */
+            if ( compress2( lcTile->tlBytes, & lcSize, lcPixel, lcStep * LC_TIFF_TILE, lcCompression ) == Z_OK ) {
+
+                /* Assign compressed size */
+                lcTile->tlSize = lcSize;
+
+            } else {
+
+                /* Release compressed tile */
+                free( lcTile->tlBytes );
+
+                /* Reset compressed tile */
+                lcTile->tlBytes = NULL;
+
+            }
+
+        }
+
+        /* Release tile pixels */
+        free( lcPixel );
+
+        /* Return status */
+        return( lcTile->tlBytes != NULL ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - TIFF importation
+ */
+
+    IplImage * lc_tiff_read( char const * const lcPath, int const lcLayers, CvRect const * const lcRegion ) {
+
+        /* TIFF stream variables */
+        TIFF * lcTIFF = NULL;
+
+        /* Stream geometry variables */
+        uint32_t lcWidth  = 0;
+        uint32_t lcHeight = 0;
+        uint32_t lcTileW  = 0;
+        uint32_t lcTileH  = 0;
+        int      lcSamples = 0;
+
+        /* Image variables */
+        IplImage * lcImage = NULL;
+
+        /* Decoded region variables */
+        CvRect lcKeep;
+        CvRect lcTiles;
+
+        /* Decoding blocks variables */
+        int lcCount  = 0;
+        int lcBlocks = 1;
+
+        /* Decoding failures variables */
+        int lcFail = 0;
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* Open importation stream */
+        if ( ( lcTIFF = TIFFOpen( lcPath, "r" ) ) == NULL ) return( NULL );
+
+        /* Verify stream layout */
+        if ( lc_tiff_layout( lcTIFF, & lcSamples ) == LC_TRUE ) {
+
+            /* Retrieve stream geometry */
+            TIFFGetField( lcTIFF, TIFFTAG_IMAGEWIDTH , & lcWidth  );
+            TIFFGetField( lcTIFF, TIFFTAG_IMAGELENGTH, & lcHeight );
+            TIFFGetField( lcTIFF, TIFFTAG_TILEWIDTH  , & lcTileW  );
+            TIFFGetField( lcTIFF, TIFFTAG_TILELENGTH , & lcTileH  );
+
+        }
+
+        /* Close importation stream - decoding streams opened by threads */
+        TIFFClose( lcTIFF );
+
+        /* Verify stream geometry */
+        if ( ( lcWidth == 0 ) || ( lcHeight == 0 ) || ( lcTileW == 0 ) || ( lcTileH == 0 ) ) return( NULL );
+
+        /* Create image - memory untouched out of decoded tiles */
+        if ( ( lcImage = cvCreateImage( cvSize( lcWidth, lcHeight ), IPL_DEPTH_8U, lcLayers != 0 ? lcLayers : lcSamples ) ) == NULL ) return( NULL );
+
+        /* Assign decoded region - entire image */
+        lcKeep = cvRect( 0, 0, lcImage->width, lcImage->height );
+
+        /* Check decoded region */
+        if ( lcRegion != NULL ) {
+
+            /* Clamp decoded region on image */
+            lcKeep.x      = lcRegion->x < 0 ? 0 : ( lcRegion->x > lcImage->width  ? lcImage->width  : lcRegion->x );
+            lcKeep.y      = lcRegion->y < 0 ? 0 : ( lcRegion->y > lcImage->height ? lcImage->height : lcRegion->y );
+            lcKeep.width  = ( lcRegion->x + lcRegion->width  > lcImage->width  ? lcImage->width  : lcRegion->x + lcRegion->width  ) - lcKeep.x;
+            lcKeep.height = ( lcRegion->y + lcRegion->height > lcImage->height ? lcImage->height : lcRegion->y + lcRegion->height ) - lcKeep.y;
+
+            /* Check empty region - entire image decoded */
+            if ( ( lcKeep.width <= 0 ) || ( lcKeep.height <= 0 ) ) lcKeep = cvRect( 0, 0, lcImage->width, lcImage->height );
+
+        }
+
+        /* Compute tiles region */
+        lcTiles.x      = lcKeep.x / lcTileW;
+        lcTiles.y      = lcKeep.y / lcTileH;
+        lcTiles.width  = ( lcKeep.x + lcKeep.width  + lcTileW - 1 ) / lcTileW - lcTiles.x;
+        lcTiles.height = ( lcKeep.y + lcKeep.height + lcTileH - 1 ) / lcTileH - lcTiles.y;
+
+        /* Compute tiles count */
+        lcCount = lcTiles.width * lcTiles.height;
+
+        /* Retrieve available threads count */
+        # ifdef __OPENMP__
+        lcBlocks = omp_get_max_threads();
+        # endif
+
+        /* Clamp blocks count on tiles count */
+        if ( lcBlocks > lcCount ) lcBlocks = lcCount;
+
+        /* Decode tiles blocks - one stream per block */
+        # pragma omp parallel for private( lcParse ) reduction( + : lcFail ) schedule( dynamic )
+        for ( lcParse = 0; lcParse < lcBlocks; lcParse ++ ) {
+
+            /* Decode tiles block */
+            lcFail += lc_tiff_decode( lcPath, lcImage, lcTiles, ( long ) lcCount * lcParse / lcBlocks, ( long ) lcCount * ( lcParse + 1 ) / lcBlocks ) == LC_FALSE;
+
+        }
+
+        /* Check decoding failure */
+        if ( lcFail != 0 ) cvReleaseImage( & lcImage );
+
+        /* Return imported image */
+        return( lcImage );
+
+    }
+
+/*
+    Source - TIFF tiles decoding
+ */
+
+    int lc_tiff_decode(
+
+        char const * const lcPath,
+        IplImage   * const lcImage,
+        CvRect       const lcRegion,
+        int          const lcFirst,
+        int          const lcLast
+
+    ) {
+
+        /* TIFF stream variables */
+        TIFF * lcTIFF = NULL;
+
+        /* Tile variables */
+        unsigned char * lcTile = NULL;
+
+        /* Tile geometry variables */
+        uint32_t lcTileW   = 0;
+        uint32_t lcTileH   = 0;
+        int      lcSamples = 0;
+        int      lcColumn  = 0;
+        int      lcRow     = 0;
+        int      lcPixels  = 0;
+        int      lcLines   = 0;
+
+        /* Returned value variables */
+        int lcReturn = LC_TRUE;
+
+        /* Parsing variables */
+        int lcParse = 0;
+        int lcLine  = 0;
+
+        /* Open decoding stream */
+        if ( ( lcTIFF = TIFFOpen( lcPath, "r" ) ) == NULL ) return( LC_FALSE );
+
+        /* Verify stream layout and allocate tile */
+        if ( ( lc_tiff_layout( lcTIFF, & lcSamples ) == LC_FALSE ) || ( ( lcTile = ( unsigned char * ) _TIFFmalloc( TIFFTileSize( lcTIFF ) ) ) == NULL ) ) {
+
+            /* Close decoding stream */
+            TIFFClose( lcTIFF );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Retrieve tiles size */
+        TIFFGetField( lcTIFF, TIFFTAG_TILEWIDTH , & lcTileW );
+        TIFFGetField( lcTIFF, TIFFTAG_TILELENGTH, & lcTileH );
+
+        /* Parsing tiles */
+        for ( lcParse = lcFirst; ( lcParse < lcLast ) && ( lcReturn == LC_TRUE ); lcParse ++ ) {
+
+            /* Compute tile position */
+            lcColumn = ( lcRegion.x + lcParse % lcRegion.width ) * lcTileW;
+            lcRow    = ( lcRegion.y + lcParse / lcRegion.width ) * lcTileH;
+
+            /* Decode tile */
+            if ( TIFFReadEncodedTile( lcTIFF, TIFFComputeTile( lcTIFF, lcColumn, lcRow, 0, 0 ), lcTile, ( tmsize_t ) -1 ) < 0 ) {
+
+                /* Update status */
+                lcReturn = LC_FALSE;
+
+            } else {
+
+                /* Clip tile on image */
+                lcPixels = ( lcColumn + ( int ) lcTileW > lcImage->width  ) ? lcImage->width  - lcColumn : ( int ) lcTileW;
+                lcLines  = ( lcRow    + ( int ) lcTileH > lcImage->height ) ? lcImage->height - lcRow    : ( int ) lcTileH;
+
+                /* Convert tile rows in image */
+                for ( lcLine = 0; lcLine < lcLines; lcLine ++ ) lc_tiff_convert( lcTile + ( size_t ) lcLine * lcTileW * lcSamples, lcSamples, ( unsigned char * ) lcImage->imageData + ( size_t ) ( lcRow + lcLine ) * lcImage->widthStep + ( size_t ) lcColumn * lcImage->nChannels, lcImage->nChannels, lcPixels );
+
+            }
+
+        }
+
+        /* Release tile */
+        _TIFFfree( lcTile );
+
+        /* Close decoding stream */
+        TIFFClose( lcTIFF );
+
+        /* Return status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - TIFF stream layout verification
+ */
+
+    int lc_tiff_layout( TIFF * const lcTIFF, int * const lcSamples ) {
+
+        /* Stream layout variables */
+        uint16_t lcBits        = 0;
+        uint16_t lcSample      = 0;
+        uint16_t lcPlanar      = 0;
+        uint16_t lcFormat      = 0;
+        uint16_t lcPhotometric = 0;
+        uint16_t lcCompression = 0;
+
+        /* Retrieve stream layout */
+        TIFFGetFieldDefaulted( lcTIFF, TIFFTAG_BITSPERSAMPLE  , & lcBits        );
+        TIFFGetFieldDefaulted( lcTIFF, TIFFTAG_SAMPLESPERPIXEL, & lcSample      );
+        TIFFGetFieldDefaulted( lcTIFF, TIFFTAG_PLANARCONFIG   , & lcPlanar      );
+        TIFFGetFieldDefaulted( lcTIFF, TIFFTAG_SAMPLEFORMAT   , & lcFormat      );
+        TIFFGetFieldDefaulted( lcTIFF, TIFFTAG_COMPRESSION    , & lcCompression );
+
+        /* Retrieve photometric interpretation */
+        if ( TIFFGetField( lcTIFF, TIFFTAG_PHOTOMETRIC, & lcPhotometric ) == 0 ) return( LC_FALSE );
+
+        /* Verify tiles and samples layout */
+        if ( ( TIFFIsTiled( lcTIFF ) == 0 ) || ( lcBits != 8 ) || ( lcPlanar != PLANARCONFIG_CONTIG ) || ( lcFormat != SAMPLEFORMAT_UINT ) ) return( LC_FALSE );
+
+        /* Check JPEG compressed luminance and chrominance */
+        if ( ( lcPhotometric == PHOTOMETRIC_YCBCR ) && ( lcCompression == COMPRESSION_JPEG ) ) {
+
+            /* Assign codec color conversion */
+            TIFFSetField( lcTIFF, TIFFTAG_JPEGCOLORMODE, JPEGCOLORMODE_RGB );
+
+            /* Update photometric interpretation */
+            lcPhotometric = PHOTOMETRIC_RGB;
+
+        }
+
+        /* Verify photometric interpretation */
+        if ( ( ( lcSample != 1 ) || ( lcPhotometric != PHOTOMETRIC_MINISBLACK ) ) && ( ( ( lcSample != 3 ) && ( lcSample != 4 ) ) || ( lcPhotometric != PHOTOMETRIC_RGB ) ) ) return( LC_FALSE );
+
+        /* Assign samples count */
+        * lcSamples = lcSample;
+
+        /* Return status */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - TIFF pixels conversion
+ */
+
+    void lc_tiff_convert( 
+
+        unsigned char const * const lcSource, 
+        int                   const lcsLayers, 
+        unsigned char       * const lcTarget, 
+        int                   const lctLayers, 
+        int                   const lcCount 
+
+    ) {
+
+        /* Pixels pointers variables */
+        unsigned char const * lcsPixel = lcSource;
+        unsigned char       * lctPixel = lcTarget;
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* Parsing pixels */
+        for ( lcParse = 0; lcParse < lcCount; lcParse ++, lcsPixel += lcsLayers, lctPixel += lctLayers ) {
+
+            /* Check target layers */
+            if ( lctLayers == 1 ) {
+
+                /* Assign grayscale - OpenCV fixed point weights */
+                lctPixel[0] = ( lcsLayers == 1 ) ? lcsPixel[0] : ( lcsPixel[0] * 4899 + lcsPixel[1] * 9617 + lcsPixel[2] * 1868 + 8192 ) >> 14;
+
+            } else {
+
+                /* Assign color components - swapped order */
+                lctPixel[0] = lcsPixel[lcsLayers == 1 ? 0 : 2];
+                lctPixel[1] = lcsPixel[lcsLayers == 1 ? 0 : 1];
+                lctPixel[2] = lcsPixel[0];
+
+                /* Assign alpha component - opaque if missing */
+                if ( lctLayers == 4 ) lctPixel[3] = ( lcsLayers == 4 ) ? lcsPixel[3] : 0xFF;
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - TIFF image size
+ */
+
+    int lc_tiff_size( char const * const lcPath, CvSize * const lcSize ) {
+
+        /* TIFF stream variables */
+        TIFF * lcTIFF = NULL;
+
+        /* Stream geometry variables */
+        uint32_t lcWidth  = 0;
+        uint32_t lcHeight = 0;
+
+        /* Open importation stream */
+        if ( ( lcTIFF = TIFFOpen( lcPath, "r" ) ) == NULL ) return( LC_FALSE );
+
+        /* Retrieve stream geometry */
+        TIFFGetField( lcTIFF, TIFFTAG_IMAGEWIDTH , & lcWidth  );
+        TIFFGetField( lcTIFF, TIFFTAG_IMAGELENGTH, & lcHeight );
+
+        /* Close importation stream */
+        TIFFClose( lcTIFF );
+
+        /* Assign image size */
+        * lcSize = cvSize( lcWidth, lcHeight );
+
+        /* Return status */
+        return( ( lcWidth > 0 ) && ( lcHeight > 0 ) ? LC_TRUE : LC_FALSE );
+
+    }
+
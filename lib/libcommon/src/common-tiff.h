@@ -0,0 +1,277 @@
+/*
+ * norama-suite libcommon - norama-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-tiff.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  TIFF codec interface
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_TIFF__
+    # define __LC_TIFF__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.h"
+    # include <zlib.h>
+    # include <tiffio.h>
+    # include <opencv/cv.h>
+    # ifdef __OPENMP__
+    # include <omp.h>
+    # endif
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define tiles size, in pixels */
+    # define LC_TIFF_TILE   256
+
+    /* Define compression batch size, in tiles */
+    # define LC_TIFF_BATCH  256
+
+    /* Define classic TIFF size limit - BigTIFF beyond */
+    # define LC_TIFF_LIMIT  ( ( size_t ) 3 << 30 )
+
+    /* Define default compression - zlib default */
+    # define LC_TIFF_COMPRESSION 6
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Tile_struct
+     *  \brief TIFF compressed tile
+     *
+     *  This structure holds the deflate compressed data of an exported image
+     *  tile.
+     *
+     *  \var lc_Tile_struct::tlBytes
+     *  Tile compressed data, NULL on failure
+     *  \var lc_Tile_struct::tlSize
+     *  Tile compressed data size, in bytes
+     */
+
+    typedef struct lc_Tile_struct {
+
+        unsigned char * tlBytes;
+        size_t          tlSize;
+
+    } lc_Tile_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief TIFF exportation
+     *
+     *  This function exports the provided image in tiled TIFF format, BigTIFF
+     *  being used for images beyond LC_TIFF_LIMIT bytes. The tiles are deflate
+     *  compressed in parallel, by batches of LC_TIFF_BATCH tiles, with the
+     *  horizontal predictor. The compressed tiles are then written in order as
+     *  raw tiles through libtiff.
+     *
+     *  \param  lcPath        Image exportation path
+     *  \param  lcImage       Image to export, with 1, 3 or 4 layers of 8 bits
+     *  \param  lcCompression Deflate compression level, between 0 and 9
+     *
+     *  \return The function returns a non zero value if exportation succeed,
+     *  zero otherwise
+     */
+
+    int lc_tiff_write ( char const * const lcPath, IplImage const * const lcImage, int const lcCompression );
+
+    /*! \brief TIFF tile compression
+     *
+     *  This function composes the provided tile of the image, in red, green,
+     *  blue ordered pixels, applies the horizontal predictor on it and deflate
+     *  compresses it. The tile parts lying outside of the image are zeroed.
+     *
+     *  \param  lcImage       Image to export
+     *  \param  lcColumn      Tile first column
+     *  \param  lcRow         Tile first row
+     *  \param  lcCompression Deflate compression level
+     *  \param  lcTile        Returned compressed tile
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_tiff_tile ( 
+
+        IplImage const * const lcImage, 
+        int              const lcColumn, 
+        int              const lcRow, 
+        int              const lcCompression, 
+        lc_Tile_t      * const lcTile 
+
+    );
+
+    /*! \brief TIFF importation
+     *
+     *  This function imports the provided tiled TIFF image, classic or BigTIFF,
+     *  of 8 bits samples. If a region is provided, only the tiles intersecting
+     *  it are decoded, the image content outside of the region being undefined.
+     *  As the image memory is not touched out of the decoded tiles, images
+     *  larger than the available memory can be imported by regions. The tiles
+     *  are decoded in parallel, each thread using its own TIFF stream. Any
+     *  compression handled by libtiff is supported. The function fails on
+     *  stripped images, letting the caller fall back on OpenCV.
+     *
+     *  \param  lcPath   Image importation path
+     *  \param  lcLayers Image layers count, 1, 3 or 4, zero to keep the stream
+     *                   samples count
+     *  \param  lcRegion Decoded region, NULL for the entire image
+     *
+     *  \return Returns imported image, NULL on failure
+     */
+
+    IplImage * lc_tiff_read ( char const * const lcPath, int const lcLayers, CvRect const * const lcRegion );
+
+    /*! \brief TIFF tiles decoding
+     *
+     *  This function decodes the provided range of tiles in the image through
+     *  its own TIFF stream. The tiles are enumerated row by row in the tiles
+     *  region.
+     *
+     *  \param  lcPath    Image importation path
+     *  \param  lcImage   Decoded image
+     *  \param  lcRegion  Tiles region, in tiles
+     *  \param  lcFirst   First decoded tile
+     *  \param  lcLast    Last decoded tile, excluded
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_tiff_decode (
+
+        char const * const lcPath,
+        IplImage   * const lcImage,
+        CvRect       const lcRegion,
+        int          const lcFirst,
+        int          const lcLast
+
+    );
+
+    /*! \brief TIFF stream layout verification
+     *
+     *  This function verifies that the provided TIFF stream is tiled with 8
+     *  bits unsigned samples interleaved in pixels, and that its photometric
+     *  interpretation is handled. Tiles decoding of JPEG compressed streams is
+     *  set to red, green, blue pixels.
+     *
+     *  \param  lcTIFF    TIFF stream
+     *  \param  lcSamples Returned samples count
+     *
+     *  \return Returns LC_TRUE if the layout is handled, LC_FALSE otherwise
+     */
+
+    int lc_tiff_layout ( TIFF * const lcTIFF, int * const lcSamples );
+
+    /*! \brief TIFF pixels conversion
+     *
+     *  This function converts the provided pixels between red, green, blue
+     *  and blue, green, red orders, the conversion being its own inverse. The
+     *  layers count is also adapted, grayscale being computed with the OpenCV
+     *  weights, alpha being dropped or set opaque.
+     *
+     *  \param  lcSource  Source pixels
+     *  \param  lcsLayers Source pixels layers count
+     *  \param  lcTarget  Returned pixels
+     *  \param  lctLayers Returned pixels layers count
+     *  \param  lcCount   Pixels count
+     */
+
+    void lc_tiff_convert ( 
+
+        unsigned char const * const lcSource, 
+        int                   const lcsLayers, 
+        unsigned char       * const lcTarget, 
+        int                   const lctLayers, 
+        int                   const lcCount 
+
+    );
+
+    /*! \brief TIFF image size
+     *
+     *  This function reads the size of the provided TIFF image from its first
+     *  directory, without decoding the image.
+     *
+     *  \param  lcPath Image path
+     *  \param  lcSize Returned image size
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int lc_tiff_size ( char const * const lcPath, CvSize * const lcSize );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,530 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama-cube.h"
+
+/*
+    Source - Cube face frame
+ */
+
+    void ln_cube_frame( int const lnFace, double lnFrame[3][3] ) {
+
+        /* Cube faces frames variables */
+        static double const lnFrames[LN_FACES][3][3] = {
+
+            { {  1.0,  0.0,  0.0 }, {  0.0,  1.0,  0.0 }, {  0.0,  0.0,  1.0 } },
+            { {  0.0,  1.0,  0.0 }, { -1.0,  0.0,  0.0 }, {  0.0,  0.0,  1.0 } },
+            { { -1.0,  0.0,  0.0 }, {  0.0, -1.0,  0.0 }, {  0.0,  0.0,  1.0 } },
+            { {  0.0, -1.0,  0.0 }, {  1.0,  0.0,  0.0 }, {  0.0,  0.0,  1.0 } },
+            { {  0.0,  0.0,  1.0 }, {  0.0,  1.0,  0.0 }, { -1.0,  0.0,  0.0 } },
+            { {  0.0,  0.0, -1.0 }, {  0.0,  1.0,  0.0 }, {  1.0,  0.0,  0.0 } }
+
+        };
+
+        /* Assign face frame */
+        memcpy( lnFrame, lnFrames[( lnFace < 0 ) || ( lnFace >= LN_FACES ) ? LN_FRONT : lnFace], sizeof( double ) * 9 );
+
+    }
+
+/*
+    Source - Direction to mapping coordinates
+ */
+
+    void ln_cube_mapping( double lnX, double lnY, double lnZ, int const lnWidth, int const lnHeight, double * const lnU, double * const lnV ) {
+
+        /* Compute floating pixel coordinates */
+        * lnU = ( ( atan2( lnY, lnX ) + LG_PI ) / ( 2.0 * LG_PI ) ) * lnWidth - 0.5;
+        * lnV = ( 0.5 - atan2( lnZ, sqrt( lnX * lnX + lnY * lnY ) ) / LG_PI ) * lnHeight - 0.5;
+
+        /* Wrap horizontal coordinate */
+        if ( * lnU < 0.0 ) * lnU += lnWidth; else if ( * lnU >= lnWidth ) * lnU -= lnWidth;
+
+        /* Clamp vertical coordinate */
+        if ( * lnV < 0.0 ) * lnV = 0.0; else if ( * lnV > lnHeight - 1 ) * lnV = lnHeight - 1;
+
+    }
+
+/*
+    Source - Cube face tile
+ */
+
+    int ln_cube_tile( 
+
+        ln_Image_t const * const lnInput, 
+        ln_Image_t       * const lnOutput, 
+        int                const lnFace, 
+        int                const lnSize, 
+        int                const lnX, 
+        int                const lnY, 
+        li_Method_t        const lnMethod, 
+        int                const lnThread 
+
+    ) {
+
+        /* Face frame variables */
+        double lnFrame[3][3];
+
+        /* Verify image descriptors */
+        if ( ( ln_image( lnInput ) == LN_FALSE ) || ( ln_image( lnOutput ) == LN_FALSE ) || ( lnSize <= 0 ) ) return( LN_ERROR_IMAGE );
+
+        /* Verify layers consistency */
+        if ( lnInput->imLayers != lnOutput->imLayers ) return( LN_ERROR_IMAGE );
+
+        /* Retrieve face frame */
+        ln_cube_frame( lnFace, lnFrame );
+
+        /* Process tile rows */
+        # pragma omp parallel for num_threads( lnThread ) schedule( dynamic )
+        for ( int lnRow = 0; lnRow < lnOutput->imHeight; lnRow ++ ) {
+
+            /* Normalized coordinates variables */
+            double lnA = 0.0;
+            double lnB = 2.0 * ( lnY + lnRow + 0.5 ) / lnSize - 1.0;
+
+            /* Mapping coordinates variables */
+            double lnU = 0.0;
+            double lnV = 0.0;
+
+            /* Output pointer variables */
+            inter_C8_t * lnPixel = lnOutput->imBytes + ( size_t ) lnRow * lnOutput->imWidth * lnOutput->imLayers;
+
+            /* Process tile row */
+            for ( int lnCol = 0; lnCol < lnOutput->imWidth; lnCol ++ ) {
+
+                /* Compute normalized coordinate */
+                lnA = 2.0 * ( lnX + lnCol + 0.5 ) / lnSize - 1.0;
+
+                /* Compute mapping coordinates */
+                ln_cube_mapping( 
+
+                    lnFrame[0][0] + lnA * lnFrame[1][0] - lnB * lnFrame[2][0],
+                    lnFrame[0][1] + lnA * lnFrame[1][1] - lnB * lnFrame[2][1],
+                    lnFrame[0][2] + lnA * lnFrame[1][2] - lnB * lnFrame[2][2],
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    & lnU,
+                    & lnV
+
+                );
+
+                /* Interpolate pixel layers */
+                for ( int lnLayer = 0; lnLayer < lnOutput->imLayers; lnLayer ++ ) {
+
+                    /* Assign interpolated component */
+                    * ( lnPixel ++ ) = lnMethod( lnInput->imBytes, lnInput->imWidth, lnInput->imHeight, lnInput->imLayers, lnLayer, lnU, lnV );
+
+                }
+
+            }
+
+        }
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+
+/*
+    Source - Cube map
+ */
+
+    int ln_cubemap( ln_Image_t const * const lnInput, ln_Image_t * const lnFaces, li_Method_t const lnMethod, int const lnThread ) {
+
+        /* Face size variables */
+        int lnSize = lnFaces[0].imWidth;
+
+        /* Columns geometry variables */
+        double * lnColumn = NULL;
+
+        /* Parsing variables */
+        int lnParse = 0;
+
+        /* Verify input image descriptor */
+        if ( ln_image( lnInput ) == LN_FALSE ) return( LN_ERROR_IMAGE );
+
+        /* Verify faces image descriptors */
+        for ( lnParse = 0; lnParse < LN_FACES; lnParse ++ ) {
+
+            /* Verify face descriptor, size and layers */
+            if ( ( ln_image( lnFaces + lnParse ) == LN_FALSE ) || ( lnFaces[lnParse].imWidth != lnSize ) || ( lnFaces[lnParse].imHeight != lnSize ) || ( lnFaces[lnParse].imLayers != lnInput->imLayers ) ) return( LN_ERROR_IMAGE );
+
+        }
+
+        /* Allocate columns geometry */
+        if ( ( lnColumn = ( double * ) malloc( sizeof( double ) * 2 * lnSize ) ) == NULL ) return( LN_ERROR_IMAGE );
+
+        /* Compute columns geometry - front face longitude and horizontal norm */
+        for ( lnParse = 0; lnParse < lnSize; lnParse ++ ) {
+
+            /* Compute normalized coordinate */
+            double lnA = 2.0 * ( lnParse + 0.5 ) / lnSize - 1.0;
+
+            /* Compute front face horizontal coordinate */
+            lnColumn[2 * lnParse    ] = ( ( atan2( lnA, 1.0 ) + LG_PI ) / ( 2.0 * LG_PI ) ) * lnInput->imWidth - 0.5;
+
+            /* Compute horizontal norm of side faces directions */
+            lnColumn[2 * lnParse + 1] = sqrt( 1.0 + lnA * lnA );
+
+        }
+
+        /* Process faces rows */
+        # pragma omp parallel for num_threads( lnThread ) schedule( dynamic )
+        for ( int lnRow = 0; lnRow < lnSize; lnRow ++ ) {
+
+            /* Normalized coordinates variables */
+            double lnA = 0.0;
+            double lnB = 2.0 * ( lnRow + 0.5 ) / lnSize - 1.0;
+
+            /* Mapping coordinates variables */
+            double lnU = 0.0;
+            double lnV = 0.0;
+            double lnDownU = 0.0;
+            double lnDownV = 0.0;
+
+            /* Faces pixel offset variables */
+            size_t lnOffset = ( size_t ) lnRow * lnSize * lnInput->imLayers;
+
+            /* Process faces row */
+            for ( int lnCol = 0; lnCol < lnSize; lnCol ++, lnOffset += lnInput->imLayers ) {
+
+                /* Compute normalized coordinate */
+                lnA = 2.0 * ( lnCol + 0.5 ) / lnSize - 1.0;
+
+                /* Compute side faces vertical coordinate - shared by the four faces */
+                lnV = ( 0.5 - atan2( - lnB, lnColumn[2 * lnCol + 1] ) / LG_PI ) * lnInput->imHeight - 0.5;
+
+                /* Clamp vertical coordinate */
+                if ( lnV < 0.0 ) lnV = 0.0; else if ( lnV > lnInput->imHeight - 1 ) lnV = lnInput->imHeight - 1;
+
+                /* Process side faces - quarter turns in longitude */
+                for ( int lnFace = LN_FRONT; lnFace <= LN_LEFT; lnFace ++ ) {
+
+                    /* Compute horizontal coordinate */
+                    lnU = lnColumn[2 * lnCol] + lnFace * 0.25 * lnInput->imWidth;
+
+                    /* Wrap horizontal coordinate */
+                    if ( lnU >= lnInput->imWidth ) lnU -= lnInput->imWidth;
+
+                    /* Interpolate pixel layers */
+                    for ( int lnLayer = 0; lnLayer < lnInput->imLayers; lnLayer ++ ) {
+
+                        /* Assign interpolated component */
+                        lnFaces[lnFace].imBytes[lnOffset + lnLayer] = lnMethod( lnInput->imBytes, lnInput->imWidth, lnInput->imHeight, lnInput->imLayers, lnLayer, lnU, lnV );
+
+                    }
+
+                }
+
+                /* Compute up face mapping coordinates */
+                ln_cube_mapping( lnB, lnA, 1.0, lnInput->imWidth, lnInput->imHeight, & lnU, & lnV );
+
+                /* Compute down face mapping coordinates - mirrored up face */
+                lnDownU = 1.5 * lnInput->imWidth - lnU - 1.0; lnDownV = lnInput->imHeight - 1 - lnV;
+
+                /* Wrap horizontal coordinate */
+                if ( lnDownU >= lnInput->imWidth ) lnDownU -= lnInput->imWidth; else if ( lnDownU < 0.0 ) lnDownU += lnInput->imWidth;
+
+                /* Interpolate pixel layers */
+                for ( int lnLayer = 0; lnLayer < lnInput->imLayers; lnLayer ++ ) {
+
+                    /* Assign interpolated components */
+                    lnFaces[LN_UP  ].imBytes[lnOffset + lnLayer] = lnMethod( lnInput->imBytes, lnInput->imWidth, lnInput->imHeight, lnInput->imLayers, lnLayer, lnU, lnV );
+                    lnFaces[LN_DOWN].imBytes[lnOffset + lnLayer] = lnMethod( lnInput->imBytes, lnInput->imWidth, lnInput->imHeight, lnInput->imLayers, lnLayer, lnDownU, lnDownV );
+
+                }
+
+            }
+
+        }
+
+        /* Release columns geometry */
+        free( lnColumn );
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - Cube map creation
+ */
+
+    int ln_cube_create( ln_Cube_t * const lnCube, ln_Image_t const * const lnInput, int const lnSize, li_Method_t const lnMethod, int const lnThread ) {
+
+        /* Padded face edge variables */
+        int lnEdge = lnSize + 2 * LN_CUBE_PAD;
+
+        /* Verify input image descriptor */
+        if ( ( ln_image( lnInput ) == LN_FALSE ) || ( lnSize <= 0 ) ) return( LN_ERROR_IMAGE );
+
+        /* Allocate faces buffer */
+        if ( ( lnCube->cbBytes = ( inter_C8_t * ) malloc( ( size_t ) LN_FACES * lnEdge * lnEdge * lnInput->imLayers ) ) == NULL ) return( LN_ERROR_IMAGE );
+
+        /* Assign cube map parameters */
+        lnCube->cbSize   = lnSize;
+        lnCube->cbPad    = LN_CUBE_PAD;
+        lnCube->cbLayers = lnInput->imLayers;
+
+        /* Process faces rows */
+        # pragma omp parallel for num_threads( lnThread ) schedule( dynamic )
+        for ( int lnRow = 0; lnRow < LN_FACES * lnEdge; lnRow ++ ) {
+
+            /* Face frame variables */
+            double lnFrame[3][3];
+
+            /* Normalized coordinates variables - padding beyond face edges */
+            double lnA = 0.0;
+            double lnB = 2.0 * ( lnRow % lnEdge - LN_CUBE_PAD + 0.5 ) / lnSize - 1.0;
+
+            /* Mapping coordinates variables */
+            double lnU = 0.0;
+            double lnV = 0.0;
+
+            /* Output pointer variables */
+            inter_C8_t * lnPixel = lnCube->cbBytes + ( size_t ) lnRow * lnEdge * lnCube->cbLayers;
+
+            /* Retrieve face frame */
+            ln_cube_frame( lnRow / lnEdge, lnFrame );
+
+            /* Process face row */
+            for ( int lnCol = 0; lnCol < lnEdge; lnCol ++ ) {
+
+                /* Compute normalized coordinate */
+                lnA = 2.0 * ( lnCol - LN_CUBE_PAD + 0.5 ) / lnSize - 1.0;
+
+                /* Compute mapping coordinates */
+                ln_cube_mapping( 
+
+                    lnFrame[0][0] + lnA * lnFrame[1][0] - lnB * lnFrame[2][0],
+                    lnFrame[0][1] + lnA * lnFrame[1][1] - lnB * lnFrame[2][1],
+                    lnFrame[0][2] + lnA * lnFrame[1][2] - lnB * lnFrame[2][2],
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    & lnU,
+                    & lnV
+
+                );
+
+                /* Interpolate pixel layers */
+                for ( int lnLayer = 0; lnLayer < lnCube->cbLayers; lnLayer ++ ) {
+
+                    /* Assign interpolated component */
+                    * ( lnPixel ++ ) = lnMethod( lnInput->imBytes, lnInput->imWidth, lnInput->imHeight, lnInput->imLayers, lnLayer, lnU, lnV );
+
+                }
+
+            }
+
+        }
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - Cube map rectilinear view
+ */
+
+    int ln_cube_view( 
+
+        ln_Cube_t  const * const lnCube, 
+        ln_Image_t       * const lnOutput, 
+        double             const lnAzim, 
+        double             const lnElev, 
+        double             const lnRoll, 
+        double             const lnApper, 
+        li_Method_t        const lnMethod, 
+        int                const lnThread 
+
+    ) {
+
+        /* Faces frames variables */
+        double lnFrame[LN_FACES][3][3];
+
+        /* View frame variables - forward, right and up */
+        double lnView[3][3];
+
+        /* View focal length variables, in pixels */
+        double lnFocal = 0.0;
+
+        /* Padded face edge variables */
+        int lnEdge = lnCube->cbSize + 2 * lnCube->cbPad;
+
+        /* Parsing variables */
+        int lnParse = 0;
+
+        /* Verify cube map and output image descriptor */
+        if ( ( lnCube->cbBytes == NULL ) || ( ln_image( lnOutput ) == LN_FALSE ) || ( lnOutput->imLayers != lnCube->cbLayers ) ) return( LN_ERROR_IMAGE );
+
+        /* Verify view aperture */
+        if ( ( lnApper <= 0.0 ) || ( lnApper >= LG_PI ) ) return( LN_ERROR_IMAGE );
+
+        /* Retrieve faces frames */
+        for ( lnParse = 0; lnParse < LN_FACES; lnParse ++ ) ln_cube_frame( lnParse, lnFrame[lnParse] );
+
+        /* Compute view frame */
+        ln_cube_sight( lnAzim, lnElev, lnRoll, lnView );
+
+        /* Compute view focal length */
+        lnFocal = ( lnOutput->imWidth / 2.0 ) / tan( lnApper / 2.0 );
+
+        /* Process view rows */
+        # pragma omp parallel for num_threads( lnThread ) schedule( dynamic )
+        for ( int lnRow = 0; lnRow < lnOutput->imHeight; lnRow ++ ) {
+
+            /* Direction variables */
+            double lnD[3];
+
+            /* Face coordinates variables */
+            double lnT = 0.0;
+            double lnX = 0.0;
+            double lnY = 0.0;
+
+            /* View plane coordinates variables */
+            double lnH = 0.0;
+            double lnV = ( lnRow + 0.5 - lnOutput->imHeight / 2.0 ) / lnFocal;
+
+            /* Face variables */
+            int lnFace = 0;
+
+            /* Face pointer variables */
+            inter_C8_t const * lnBytes = NULL;
+
+            /* Output pointer variables */
+            inter_C8_t * lnPixel = lnOutput->imBytes + ( size_t ) lnRow * lnOutput->imWidth * lnOutput->imLayers;
+
+            /* Process view row */
+            for ( int lnCol = 0; lnCol < lnOutput->imWidth; lnCol ++ ) {
+
+                /* Compute view plane coordinate */
+                lnH = ( lnCol + 0.5 - lnOutput->imWidth / 2.0 ) / lnFocal;
+
+                /* Compute pixel direction */
+                lnD[0] = lnView[0][0] + lnH * lnView[1][0] - lnV * lnView[2][0];
+                lnD[1] = lnView[0][1] + lnH * lnView[1][1] - lnV * lnView[2][1];
+                lnD[2] = lnView[0][2] + lnH * lnView[1][2] - lnV * lnView[2][2];
+
+                /* Select face hit by direction */
+                if ( ( fabs( lnD[0] ) >= fabs( lnD[1] ) ) && ( fabs( lnD[0] ) >= fabs( lnD[2] ) ) ) {
+
+                    /* Front or back face */
+                    lnFace = lnD[0] > 0.0 ? LN_FRONT : LN_BACK;
+
+                } else 
+                if ( fabs( lnD[1] ) >= fabs( lnD[2] ) ) {
+
+                    /* Right or left face */
+                    lnFace = lnD[1] > 0.0 ? LN_RIGHT : LN_LEFT;
+
+                } else {
+
+                    /* Up or down face */
+                    lnFace = lnD[2] > 0.0 ? LN_UP : LN_DOWN;
+
+                }
+
+                /* Compute direction component along face forward vector */
+                lnT = lnD[0] * lnFrame[lnFace][0][0] + lnD[1] * lnFrame[lnFace][0][1] + lnD[2] * lnFrame[lnFace][0][2];
+
+                /* Compute padded face floating pixel coordinates */
+                lnX = ( ( lnD[0] * lnFrame[lnFace][1][0] + lnD[1] * lnFrame[lnFace][1][1] + lnD[2] * lnFrame[lnFace][1][2] ) / lnT + 1.0 ) * 0.5 * lnCube->cbSize - 0.5 + lnCube->cbPad;
+                lnY = ( 1.0 - ( lnD[0] * lnFrame[lnFace][2][0] + lnD[1] * lnFrame[lnFace][2][1] + lnD[2] * lnFrame[lnFace][2][2] ) / lnT ) * 0.5 * lnCube->cbSize - 0.5 + lnCube->cbPad;
+
+                /* Retrieve face bytes */
+                lnBytes = lnCube->cbBytes + ( size_t ) lnFace * lnEdge * lnEdge * lnCube->cbLayers;
+
+                /* Interpolate pixel layers */
+                for ( int lnLayer = 0; lnLayer < lnCube->cbLayers; lnLayer ++ ) {
+
+                    /* Assign interpolated component */
+                    * ( lnPixel ++ ) = lnMethod( lnBytes, lnEdge, lnEdge, lnCube->cbLayers, lnLayer, lnX, lnY );
+
+                }
+
+            }
+
+        }
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - View frame
+ */
+
+    void ln_cube_sight( double const lnAzim, double const lnElev, double const lnRoll, double lnView[3][3] ) {
+
+        /* Compute view forward vector */
+        lnView[0][0] = + cos( lnElev ) * cos( lnAzim );
+        lnView[0][1] = + cos( lnElev ) * sin( lnAzim );
+        lnView[0][2] = + sin( lnElev );
+
+        /* Compute view right vector - rolled */
+        lnView[1][0] = - sin( lnAzim ) * cos( lnRoll ) - sin( lnElev ) * cos( lnAzim ) * sin( lnRoll );
+        lnView[1][1] = + cos( lnAzim ) * cos( lnRoll ) - sin( lnElev ) * sin( lnAzim ) * sin( lnRoll );
+        lnView[1][2] = + cos( lnElev ) * sin( lnRoll );
+
+        /* Compute view up vector - rolled */
+        lnView[2][0] = + sin( lnAzim ) * sin( lnRoll ) - sin( lnElev ) * cos( lnAzim ) * cos( lnRoll );
+        lnView[2][1] = - cos( lnAzim ) * sin( lnRoll ) - sin( lnElev ) * sin( lnAzim ) * cos( lnRoll );
+        lnView[2][2] = + cos( lnElev ) * cos( lnRoll );
+
+    }
+
+/*
+    Source - Cube map deletion
+ */
+
+    void ln_cube_delete( ln_Cube_t * const lnCube ) {
+
+        /* Release faces buffer */
+        free( lnCube->cbBytes );
+
+        /* Reset cube map */
+        lnCube->cbBytes = NULL;
+
+    }
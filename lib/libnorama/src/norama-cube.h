@@ -0,0 +1,308 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama-cube.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Cube mapping
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LN_CUBE__
+    # define __LN_CUBE__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <math.h>
+    # include "norama.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define cube faces */
+    # define LN_FRONT       0
+    # define LN_RIGHT       1
+    # define LN_BACK        2
+    # define LN_LEFT        3
+    # define LN_UP          4
+    # define LN_DOWN        5
+
+    /* Define cube faces count */
+    # define LN_FACES       6
+
+    /* Define cube faces tags */
+    # define LN_FACES_TAGS  "frblud"
+
+    /* Define cube map faces padding */
+    # define LN_CUBE_PAD    4
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct ln_Cube_struct
+     *  \brief Cube map
+     *
+     *  This structure holds the six faces of a cube map in a single buffer,
+     *  in the cube faces indices order. Each face is surrounded by a padding
+     *  border rendered from the mapping beyond the face edges, so that the
+     *  interpolation methods never have to read across faces.
+     *
+     *  \var ln_Cube_struct::cbBytes
+     *  Padded faces bytes buffer
+     *  \var ln_Cube_struct::cbSize
+     *  Faces edge size, in pixels, padding excluded
+     *  \var ln_Cube_struct::cbPad
+     *  Faces padding size, in pixels
+     *  \var ln_Cube_struct::cbLayers
+     *  Faces layers count
+     */
+
+    typedef struct ln_Cube_struct {
+
+        inter_C8_t * cbBytes;
+        int          cbSize;
+        int          cbPad;
+        int          cbLayers;
+
+    } ln_Cube_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Cube face frame
+     *
+     *  This function returns the forward, right and up vectors of the specified
+     *  cube face. The frame is expressed in the mapping frame, x pointing to
+     *  the center of the equirectangular mapping, y pointing to its right
+     *  quarter and z pointing up. The direction of a face pixel of normalized
+     *  coordinates (a,b), in [-1,1], is given by forward + a right - b up.
+     *
+     *  \param lnFace   Cube face index
+     *  \param lnFrame  Returned frame, as forward, right and up rows
+     */
+
+    void ln_cube_frame ( int const lnFace, double lnFrame[3][3] );
+
+    /*! \brief Direction to mapping coordinates
+     *
+     *  This function converts a direction vector, expressed in the mapping
+     *  frame, into floating pixel coordinates of an equirectangular mapping of
+     *  the specified dimensions. The horizontal coordinate is wrapped and the
+     *  vertical one is clamped on the mapping.
+     *
+     *  \param lnX      Direction vector x component
+     *  \param lnY      Direction vector y component
+     *  \param lnZ      Direction vector z component
+     *  \param lnWidth  Mapping width, in pixels
+     *  \param lnHeight Mapping height, in pixels
+     *  \param lnU      Returned horizontal floating pixel coordinate
+     *  \param lnV      Returned vertical floating pixel coordinate
+     */
+
+    void ln_cube_mapping ( double lnX, double lnY, double lnZ, int const lnWidth, int const lnHeight, double * const lnU, double * const lnV );
+
+    /*! \brief Cube face tile
+     *
+     *  This function renders a rectangular region of a cube face from the
+     *  input equirectangular mapping. The face edge size is given in pixels
+     *  and the region corner is given in pixels of the face. The region size
+     *  is the size of the output image, which is expected to have the layers
+     *  count of the input mapping.
+     *
+     *  \param lnInput  Input equirectangular mapping
+     *  \param lnOutput Output tile image
+     *  \param lnFace   Cube face index
+     *  \param lnSize   Cube face edge size, in pixels
+     *  \param lnX      Tile corner x-position in the face, in pixels
+     *  \param lnY      Tile corner y-position in the face, in pixels
+     *  \param lnMethod Interpolation method
+     *  \param lnThread Number of threads
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_cube_tile ( 
+
+        ln_Image_t const * const lnInput, 
+        ln_Image_t       * const lnOutput, 
+        int                const lnFace, 
+        int                const lnSize, 
+        int                const lnX, 
+        int                const lnY, 
+        li_Method_t        const lnMethod, 
+        int                const lnThread 
+
+    );
+
+    /*! \brief Cube map
+     *
+     *  This function renders the six faces of a cube map from the input
+     *  equirectangular mapping in a single pass. The faces geometry is shared :
+     *  the four side faces only differ by a quarter turn in longitude and the
+     *  down face mirrors the up face, so that the mapping coordinates are
+     *  computed once per face pixel for the four side faces and once for the
+     *  two polar faces.
+     *
+     *  The output faces are given in the cube faces indices order and are
+     *  expected to be square images of the same size, with the layers count
+     *  of the input mapping.
+     *
+     *  \param lnInput  Input equirectangular mapping
+     *  \param lnFaces  Output cube faces images array
+     *  \param lnMethod Interpolation method
+     *  \param lnThread Number of threads
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_cubemap ( ln_Image_t const * const lnInput, ln_Image_t * const lnFaces, li_Method_t const lnMethod, int const lnThread );
+
+    /*! \brief Cube map creation
+     *
+     *  This function allocates a cube map structure and renders its padded
+     *  faces from the input equirectangular mapping. The rows of the six faces
+     *  are rendered in parallel.
+     *
+     *  \param lnCube   Cube map structure to create
+     *  \param lnInput  Input equirectangular mapping
+     *  \param lnSize   Faces edge size, in pixels
+     *  \param lnMethod Interpolation method
+     *  \param lnThread Number of threads
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_cube_create ( ln_Cube_t * const lnCube, ln_Image_t const * const lnInput, int const lnSize, li_Method_t const lnMethod, int const lnThread );
+
+    /*! \brief Cube map rectilinear view
+     *
+     *  This function renders a rectilinear view from a cube map. The view is
+     *  oriented in the mapping frame : the azimuth turns the view toward the
+     *  right of the mapping, the elevation raises it and the roll rotates it
+     *  around its sight. The aperture is the horizontal field of view. Each
+     *  view pixel is sampled on the face its direction hits, where a gnomonic
+     *  view maps to a nearly affine region, keeping memory accesses local even
+     *  when looking toward the poles.
+     *
+     *  \param lnCube   Cube map structure
+     *  \param lnOutput Output rectilinear view
+     *  \param lnAzim   View azimuth angle, in radians
+     *  \param lnElev   View elevation angle, in radians
+     *  \param lnRoll   View roll angle, in radians
+     *  \param lnApper  View horizontal aperture, in radians
+     *  \param lnMethod Interpolation method
+     *  \param lnThread Number of threads
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_cube_view ( 
+
+        ln_Cube_t  const * const lnCube, 
+        ln_Image_t       * const lnOutput, 
+        double             const lnAzim, 
+        double             const lnElev, 
+        double             const lnRoll, 
+        double             const lnApper, 
+        li_Method_t        const lnMethod, 
+        int                const lnThread 
+
+    );
+
+    /*! \brief View frame
+     *
+     *  This function computes the frame of a rectilinear view in the mapping
+     *  frame, as used by the cube map views : the forward, right and up
+     *  vectors. A view pixel at plane coordinates (h,v), v pointing down, sees
+     *  along forward + h right - v up.
+     *
+     *  \param lnAzim View azimuth angle, in radians
+     *  \param lnElev View elevation angle, in radians
+     *  \param lnRoll View roll angle, in radians
+     *  \param lnView Returned view frame, forward, right and up vectors
+     */
+
+    void ln_cube_sight ( double const lnAzim, double const lnElev, double const lnRoll, double lnView[3][3] );
+
+    /*! \brief Cube map deletion
+     *
+     *  This function releases the faces buffer of a cube map structure.
+     *
+     *  \param lnCube Cube map structure
+     */
+
+    void ln_cube_delete ( ln_Cube_t * const lnCube );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,226 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama-earth.h"
+
+/*
+    Source - Earth-attached mapping rotation
+ */
+
+    int ln_earth( 
+
+        ln_Image_t const * const lnInput, 
+        ln_Image_t       * const lnOutput, 
+        lp_Real_t                lnMatrix[3][3], 
+        li_Method_t        const lnMethod, 
+        int                const lnThread 
+
+    ) {
+
+        /* Verify image descriptors */
+        if ( ( ln_image( lnInput ) == LN_FALSE ) || ( ln_image( lnOutput ) == LN_FALSE ) ) return( LN_ERROR_IMAGE );
+
+        /* Verify mappings consistency */
+        if ( ( lnInput->imWidth != lnOutput->imWidth ) || ( lnInput->imHeight != lnOutput->imHeight ) || ( lnInput->imLayers != lnOutput->imLayers ) ) return( LN_ERROR_IMAGE );
+
+        /* Apply equirectangular transformation */
+        lg_transform_matrixp( 
+
+            lnInput->imBytes,
+            lnOutput->imBytes,
+            lnInput->imWidth,
+            lnInput->imHeight,
+            lnInput->imLayers,
+            lnMatrix,
+            lnMethod,
+            lnThread
+
+        );
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - CSPS query handles creation
+ */
+
+    int ln_query_create( 
+
+        ln_Query_t      * const lnQuery,
+        lp_Char_t const * const lnPath, 
+        lp_Char_t const * const lnCamTag, 
+        lp_Char_t const * const lnCamMod, 
+        lp_Char_t const * const lnIMUTag, 
+        lp_Char_t const * const lnIMUMod
+
+    ) {
+
+        /* Reset handles state */
+        lnQuery->qrState = LN_FALSE;
+
+        /* Verify switches */
+        if ( ( lnPath == NULL ) || ( lnCamTag == NULL ) || ( lnCamMod == NULL ) || ( lnIMUTag == NULL ) || ( lnIMUMod == NULL ) ) return( LN_ERROR_SWITCH );
+
+        /* Create query structure */
+        lnQuery->qrTrigger = lp_query_trigger_create( lnPath, lnCamTag, lnCamMod );
+
+        /* Verify structure state */
+        if ( lp_query_trigger_state( & lnQuery->qrTrigger ) == LP_FALSE ) return( LN_ERROR_TRIGGER );
+
+        /* Create query structure */
+        lnQuery->qrOrient = lp_query_orientation_create( lnPath, lnIMUTag, lnIMUMod );
+
+        /* Verify structure state */
+        if ( lp_query_orientation_state( & lnQuery->qrOrient ) == LP_FALSE ) {
+
+            /* Release query structure */
+            lp_query_trigger_delete( & lnQuery->qrTrigger );
+
+            /* Send message */
+            return( LN_ERROR_ORIENT );
+
+        }
+
+        /* Update handles state */
+        lnQuery->qrState = LN_TRUE;
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - CSPS query handles orientation query
+ */
+
+    int ln_query_matrix( 
+
+        ln_Query_t * const lnQuery,
+        lp_Time_t    const lnSecond,
+        lp_Time_t    const lnMicro,
+        lp_Real_t          lnMatrix[3][3]
+
+    ) {
+
+        /* Verify handles state */
+        if ( lnQuery->qrState == LN_FALSE ) return( LN_ERROR_SWITCH );
+
+        /* Query master/synchronization time-link */
+        lp_query_trigger_bymaster( & lnQuery->qrTrigger, lp_timestamp_compose( lnSecond, lnMicro ) );
+
+        /* Verify query status */
+        if ( lp_query_trigger_status( & lnQuery->qrTrigger ) == LP_FALSE ) return( LN_ERROR_TIMESTAMP );
+
+        /* Query orientation by timestamp */
+        lp_query_orientation( & lnQuery->qrOrient, lnQuery->qrTrigger.qrSynch );
+
+        /* Verify query status */
+        if ( lp_query_orientation_status( & lnQuery->qrOrient ) == LP_FALSE ) return( LN_ERROR_QUERY );
+
+        /* Rotation matrix method */
+        lp_query_orientation_matrix( & lnQuery->qrOrient, lnMatrix );
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - CSPS query handles deletion
+ */
+
+    void ln_query_delete( ln_Query_t * const lnQuery ) {
+
+        /* Verify handles state */
+        if ( lnQuery->qrState == LN_FALSE ) return;
+
+        /* Release query structures */
+        lp_query_orientation_delete( & lnQuery->qrOrient  );
+        lp_query_trigger_delete    ( & lnQuery->qrTrigger );
+
+        /* Update handles state */
+        lnQuery->qrState = LN_FALSE;
+
+    }
+
+/*
+    Source - CSPS orientation single query
+ */
+
+    int ln_earth_matrix( 
+
+        lp_Char_t const * const lnPath, 
+        lp_Char_t const * const lnCamTag, 
+        lp_Char_t const * const lnCamMod, 
+        lp_Char_t const * const lnIMUTag, 
+        lp_Char_t const * const lnIMUMod, 
+        lp_Time_t const         lnSecond,
+        lp_Time_t const         lnMicro,
+        lp_Real_t               lnMatrix[3][3]
+
+    ) {
+
+        /* Query handles variables */
+        ln_Query_t lnQuery;
+
+        /* Returned value variables */
+        int lnReturn = LN_SUCCESS;
+
+        /* Create query handles */
+        if ( ( lnReturn = ln_query_create( & lnQuery, lnPath, lnCamTag, lnCamMod, lnIMUTag, lnIMUMod ) ) == LN_SUCCESS ) {
+
+            /* Query orientation */
+            lnReturn = ln_query_matrix( & lnQuery, lnSecond, lnMicro, lnMatrix );
+
+            /* Release query handles */
+            ln_query_delete( & lnQuery );
+
+        }
+
+        /* Return status */
+        return( lnReturn );
+
+    }
+
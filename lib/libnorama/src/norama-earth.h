@@ -0,0 +1,241 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama-earth.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Earth-attached orientation
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LN_EARTH__
+    # define __LN_EARTH__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "norama.h"
+    # include <csps-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct ln_Query_struct
+     *  \brief CSPS orientation query handles
+     *
+     *  This structure holds the CSPS query structures opened on the trigger
+     *  and orientation streams. Keeping it opened allows to perform several
+     *  orientation queries without parsing the CSPS streams again.
+     *
+     *  \var ln_Query_struct::qrState
+     *  Query handles state, LN_TRUE if handles are opened
+     *  \var ln_Query_struct::qrTrigger
+     *  Query structure on trigger stream
+     *  \var ln_Query_struct::qrOrient
+     *  Query structure on orientation stream
+     */
+
+    typedef struct ln_Query_struct {
+
+        int          qrState;
+        lp_Trigger_t qrTrigger;
+        lp_Orient_t  qrOrient;
+
+    } ln_Query_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Earth-attached mapping rotation
+     *
+     *  This function applies the rotation matrix on the input equirectangular
+     *  mapping and stores the result in the output mapping. Both mappings have
+     *  to share the same dimensions and layers count. This function is the
+     *  implementation of norama-earth, the matrix being typically obtained
+     *  through CSPS queries.
+     *
+     *  \param lnInput  Input equirectangular mapping
+     *  \param lnOutput Output equirectangular mapping
+     *  \param lnMatrix Rotation matrix
+     *  \param lnMethod Interpolation method
+     *  \param lnThread Number of threads
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_earth ( 
+
+        ln_Image_t const * const lnInput, 
+        ln_Image_t       * const lnOutput, 
+        lp_Real_t                lnMatrix[3][3], 
+        li_Method_t        const lnMethod, 
+        int                const lnThread 
+
+    );
+
+    /*! \brief CSPS query handles creation
+     *
+     *  This function opens the CSPS query structures on the trigger and on the
+     *  orientation streams designated by the provided tags and modules.
+     *
+     *  \param lnQuery  Query handles structure
+     *  \param lnPath   Path to CSPS directory structure
+     *  \param lnCamTag Trigger device CSPS-tag
+     *  \param lnCamMod Trigger module CSPS-name
+     *  \param lnIMUTag Orientation device CSPS-tag
+     *  \param lnIMUMod Orientation device CSPS-module
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_query_create ( 
+
+        ln_Query_t      * const lnQuery,
+        lp_Char_t const * const lnPath, 
+        lp_Char_t const * const lnCamTag, 
+        lp_Char_t const * const lnCamMod, 
+        lp_Char_t const * const lnIMUTag, 
+        lp_Char_t const * const lnIMUMod
+
+    );
+
+    /*! \brief CSPS query handles orientation query
+     *
+     *  This function queries the earth-attached rotation matrix of the camera
+     *  capture pointed by the provided trigger timestamp using the opened query
+     *  handles.
+     *
+     *  \param lnQuery  Query handles structure
+     *  \param lnSecond Orientation query timestamp seconds
+     *  \param lnMicro  Orientation query timestamp micro-seconds
+     *  \param lnMatrix Returned rotation matrix
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_query_matrix ( 
+
+        ln_Query_t * const lnQuery,
+        lp_Time_t    const lnSecond,
+        lp_Time_t    const lnMicro,
+        lp_Real_t          lnMatrix[3][3]
+
+    );
+
+    /*! \brief CSPS query handles deletion
+     *
+     *  This function releases the CSPS query structures opened by the query
+     *  handles creation function. Calling it on closed handles has no effect.
+     *
+     *  \param lnQuery  Query handles structure
+     */
+
+    void ln_query_delete ( ln_Query_t * const lnQuery );
+
+    /*! \brief CSPS orientation single query
+     *
+     *  This function performs a query through CSPS query interface to obtain
+     *  rotation matrix of a camera capture pointed by the timestamp given as
+     *  parameter according to earth local frame. The query handles are opened
+     *  and released by the function.
+     *
+     *  \param lnPath   Path to CSPS directory structure
+     *  \param lnCamTag Trigger device CSPS-tag
+     *  \param lnCamMod Trigger module CSPS-name
+     *  \param lnIMUTag Orientation device CSPS-tag
+     *  \param lnIMUMod Orientation device CSPS-module
+     *  \param lnSecond Orientation query timestamp seconds
+     *  \param lnMicro  Orientation query timestamp micro-seconds
+     *  \param lnMatrix Returned rotation matrix
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_earth_matrix ( 
+
+        lp_Char_t const * const lnPath, 
+        lp_Char_t const * const lnCamTag, 
+        lp_Char_t const * const lnCamMod, 
+        lp_Char_t const * const lnIMUTag, 
+        lp_Char_t const * const lnIMUMod, 
+        lp_Time_t const         lnSecond,
+        lp_Time_t const         lnMicro,
+        lp_Real_t               lnMatrix[3][3]
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
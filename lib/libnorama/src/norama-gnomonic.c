@@ -0,0 +1,493 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama-gnomonic.h"
+
+/*
+    Source - Gnomonic projection
+ */
+
+    int ln_direct( 
+
+        ln_Image_t    const * const lnInput, 
+        ln_Image_t          * const lnOutput, 
+        ln_Gnomonic_t const * const lnGnomonic, 
+        li_Method_t           const lnMethod, 
+        int                   const lnThread 
+
+    ) {
+
+        /* Verify image descriptors */
+        if ( ( ln_image( lnInput ) == LN_FALSE ) || ( ln_image( lnOutput ) == LN_FALSE ) ) return( LN_ERROR_IMAGE );
+
+        /* Select projection model */
+        switch ( lnGnomonic->gnModel ) {
+
+            /* Projection - generic */
+            case ( LN_GENERIC ) : {
+
+                lg_ttg_genericp(
+
+                    lnInput->imBytes,
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    lnInput->imLayers,
+                    lnOutput->imBytes,
+                    lnOutput->imWidth,
+                    lnOutput->imHeight,
+                    lnOutput->imLayers,
+                    lnGnomonic->gnSightX,
+                    lnGnomonic->gnSightY,
+                    lnGnomonic->gnmWidth,
+                    lnGnomonic->gnmHeight,
+                    lnGnomonic->gnmCornerX,
+                    lnGnomonic->gnmCornerY,
+                    lnGnomonic->gnAzim,
+                    lnGnomonic->gnElev,
+                    lnGnomonic->gnRoll,
+                    lnGnomonic->gnFocal,
+                    lnGnomonic->gnPixel,
+                    lnMethod,
+                    lnThread
+
+                );
+
+            } break;
+
+            /* Projection - elphel-specific */
+            case ( LN_ELPHEL ) : {
+
+                lg_ttg_elphelp(
+
+                    lnInput->imBytes,
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    lnInput->imLayers,
+                    lnOutput->imBytes,
+                    lnOutput->imWidth,
+                    lnOutput->imHeight,
+                    lnOutput->imLayers,
+                    lnGnomonic->gnSightX,
+                    lnGnomonic->gnSightY,
+                    lnGnomonic->gnmWidth,
+                    lnGnomonic->gnmHeight,
+                    lnGnomonic->gnmCornerX,
+                    lnGnomonic->gnmCornerY,
+                    lnGnomonic->gnRoll,
+                    lnGnomonic->gnAzim,
+                    lnGnomonic->gnElev,
+                    lnGnomonic->gnHead,
+                    lnGnomonic->gnPixel,
+                    lnGnomonic->gnFocal,
+                    lnMethod,
+                    lnThread
+
+                );
+
+            } break;
+
+            /* Projection - center-specific */
+            case ( LN_CENTER ) : {
+
+                lg_ttg_centerp(
+
+                    lnInput->imBytes,
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    lnInput->imLayers,
+                    lnOutput->imBytes,
+                    lnOutput->imWidth,
+                    lnOutput->imHeight,
+                    lnOutput->imLayers,
+                    lnGnomonic->gnmWidth,
+                    lnGnomonic->gnmHeight,
+                    lnGnomonic->gnmCornerX,
+                    lnGnomonic->gnmCornerY,
+                    lnGnomonic->gnAzim,
+                    lnGnomonic->gnElev,
+                    lnGnomonic->gnRoll,
+                    lnGnomonic->gnFocal,
+                    lnGnomonic->gnPixel,
+                    lnMethod,
+                    lnThread
+
+                );
+
+            } break;
+
+            /* Projection - aperture-specific */
+            case ( LN_COMPLETE ) : {
+
+                lg_etg_apperturep( 
+
+                    lnInput->imBytes,
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    lnInput->imLayers,
+                    lnOutput->imBytes,
+                    lnOutput->imWidth,
+                    lnOutput->imHeight,
+                    lnOutput->imLayers,
+                    lnGnomonic->gnAzim,
+                    lnGnomonic->gnElev,
+                    lnGnomonic->gnRoll,
+                    lnGnomonic->gnApper,
+                    lnMethod,
+                    lnThread
+
+                );
+
+            } break;
+
+            /* Unknown projection model */
+            default : { return( LN_ERROR_MODEL ); }
+
+        };
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - Gnomonic projection footprint
+ */
+
+    int ln_footprint(
+
+        ln_Gnomonic_t const * const lnGnomonic,
+        int                   const lnWidth,
+        int                   const lnHeight,
+        int                   const lnrWidth,
+        int                   const lnrHeight,
+        ln_Region_t         * const lnRegion,
+        int                   const lnThread
+
+    ) {
+
+        /* Probe scale variables */
+        double lnScale = ( lnWidth > LN_PROBE ) ? ( double ) LN_PROBE / lnWidth : 1.0;
+
+        /* Probe parameters variables */
+        ln_Gnomonic_t lnProbe = * lnGnomonic;
+
+        /* Probe images variables */
+        ln_Image_t lnView = { NULL, lnrWidth, lnrHeight, 1 };
+        ln_Image_t lnMap  = { NULL, 0, 0, 1 };
+
+        /* Footprint bounding box variables */
+        int lnLeft   = INT_MAX;
+        int lnRight  = -1;
+        int lnTop    = INT_MAX;
+        int lnBottom = -1;
+
+        /* Status variables */
+        int lnStatus = LN_SUCCESS;
+
+        /* Parsing variables */
+        int lnX = 0;
+        int lnY = 0;
+
+        /* Assign entire mapping region */
+        * lnRegion = ( ln_Region_t ) { 0, 0, lnWidth, lnHeight };
+
+        /* Compute probe mapping size */
+        lnMap.imWidth  = ( int ) ceil( lnWidth  * lnScale );
+        lnMap.imHeight = ( int ) ceil( lnHeight * lnScale );
+
+        /* Scale probe mapping parameters - rectilinear parameters kept */
+        lnProbe.gnmWidth   = ( int ) lround( lnGnomonic->gnmWidth   * lnScale );
+        lnProbe.gnmHeight  = ( int ) lround( lnGnomonic->gnmHeight  * lnScale );
+        lnProbe.gnmCornerX = ( int ) lround( lnGnomonic->gnmCornerX * lnScale );
+        lnProbe.gnmCornerY = ( int ) lround( lnGnomonic->gnmCornerY * lnScale );
+
+        /* Verify probe images size */
+        if ( ( lnView.imWidth <= 0 ) || ( lnView.imHeight <= 0 ) || ( lnMap.imWidth <= 0 ) || ( lnMap.imHeight <= 0 ) ) return( LN_ERROR_IMAGE );
+
+        /* Allocate probe images */
+        if ( ( ( lnView.imBytes = ( inter_C8_t * ) malloc( ( size_t ) lnView.imWidth * lnView.imHeight ) ) == NULL ) || ( ( lnMap.imBytes = ( inter_C8_t * ) calloc( ( size_t ) lnMap.imWidth * lnMap.imHeight, 1 ) ) == NULL ) ) {
+
+            /* Release probe images */
+            free( lnView.imBytes );
+
+            /* Send message */
+            return( LN_ERROR_IMAGE );
+
+        }
+
+        /* Fill rectilinear probe image */
+        memset( lnView.imBytes, 0xFF, ( size_t ) lnView.imWidth * lnView.imHeight );
+
+        /* Render rectilinear image footprint */
+        if ( ( lnStatus = ln_invert( & lnView, & lnMap, & lnProbe, li_bilinearf, lnThread ) ) == LN_SUCCESS ) {
+
+            /* Compute footprint bounding box */
+            for ( lnY = 0; lnY < lnMap.imHeight; lnY ++ ) {
+
+                for ( lnX = 0; lnX < lnMap.imWidth; lnX ++ ) {
+
+                    /* Check footprint pixel */
+                    if ( lnMap.imBytes[( size_t ) lnY * lnMap.imWidth + lnX] != 0 ) {
+
+                        /* Update bounding box */
+                        if ( lnX < lnLeft   ) lnLeft   = lnX;
+                        if ( lnX > lnRight  ) lnRight  = lnX;
+                        if ( lnY < lnTop    ) lnTop    = lnY;
+                        if ( lnY > lnBottom ) lnBottom = lnY;
+
+                    }
+
+                }
+
+            }
+
+            /* Check footprint */
+            if ( lnRight >= 0 ) {
+
+                /* Scale bounding box on mapping - probe pixel and interpolation margins */
+                lnLeft   = ( int ) floor( ( lnLeft - 1 ) / lnScale ) - LN_MARGIN;
+                lnTop    = ( int ) floor( ( lnTop  - 1 ) / lnScale ) - LN_MARGIN;
+                lnRight  = ( int ) ceil ( ( lnRight  + 2 ) / lnScale ) + LN_MARGIN;
+                lnBottom = ( int ) ceil ( ( lnBottom + 2 ) / lnScale ) + LN_MARGIN;
+
+                /* Clamp bounding box on mapping */
+                lnLeft   = lnLeft   < 0        ? 0        : lnLeft;
+                lnTop    = lnTop    < 0        ? 0        : lnTop;
+                lnRight  = lnRight  > lnWidth  ? lnWidth  : lnRight;
+                lnBottom = lnBottom > lnHeight ? lnHeight : lnBottom;
+
+                /* Assign footprint region */
+                * lnRegion = ( ln_Region_t ) { lnLeft, lnTop, lnRight - lnLeft, lnBottom - lnTop };
+
+            }
+
+        }
+
+        /* Release probe images */
+        free( lnView.imBytes );
+        free( lnMap.imBytes );
+
+        /* Return status */
+        return( lnStatus );
+
+    }
+
+/*
+    Source - Gnomonic projection sampling density
+ */
+
+    double ln_density(
+
+        ln_Gnomonic_t const * const lnGnomonic,
+        int                   const lnWidth,
+        int                   const lnrWidth
+
+    ) {
+
+        /* Check projection model */
+        if ( lnGnomonic->gnModel == LN_COMPLETE ) {
+
+            /* Check parameters */
+            if ( ( lnWidth <= 0 ) || ( lnrWidth <= 0 ) || ( lnGnomonic->gnApper <= 0.0 ) ) return( 1.0 );
+
+            /* Return density - rectilinear pixel from aperture */
+            return( ( 2.0 * LG_PI * lnrWidth ) / ( lnWidth * lnGnomonic->gnApper ) );
+
+        } else {
+
+            /* Check parameters */
+            if ( ( lnGnomonic->gnmWidth <= 0 ) || ( lnGnomonic->gnFocal <= 0.0 ) || ( lnGnomonic->gnPixel <= 0.0 ) ) return( 1.0 );
+
+            /* Return density - rectilinear pixel from focal length */
+            return( ( 2.0 * LG_PI * lnGnomonic->gnFocal ) / ( lnGnomonic->gnmWidth * lnGnomonic->gnPixel ) );
+
+        }
+
+    }
+
+/*
+    Source - Inverted gnomonic projection
+ */
+
+    int ln_invert( 
+
+        ln_Image_t    const * const lnInput, 
+        ln_Image_t          * const lnOutput, 
+        ln_Gnomonic_t const * const lnGnomonic, 
+        li_Method_t           const lnMethod, 
+        int                   const lnThread 
+
+    ) {
+
+        /* Verify image descriptors */
+        if ( ( ln_image( lnInput ) == LN_FALSE ) || ( ln_image( lnOutput ) == LN_FALSE ) ) return( LN_ERROR_IMAGE );
+
+        /* Select projection model */
+        switch ( lnGnomonic->gnModel ) {
+
+            /* Projection - generic */
+            case ( LN_GENERIC ) : {
+
+                lg_gtt_genericp(
+
+                    lnOutput->imBytes,
+                    lnOutput->imWidth,
+                    lnOutput->imHeight,
+                    lnOutput->imLayers,
+                    lnInput->imBytes,
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    lnInput->imLayers,
+                    lnGnomonic->gnSightX,
+                    lnGnomonic->gnSightY,
+                    lnGnomonic->gnmWidth,
+                    lnGnomonic->gnmHeight,
+                    lnGnomonic->gnmCornerX,
+                    lnGnomonic->gnmCornerY,
+                    lnGnomonic->gnAzim,
+                    lnGnomonic->gnElev,
+                    lnGnomonic->gnRoll,
+                    lnGnomonic->gnFocal,
+                    lnGnomonic->gnPixel,
+                    lnMethod,
+                    lnThread
+
+                );
+
+            } break;
+
+            /* Projection - elphel-specific */
+            case ( LN_ELPHEL ) : {
+
+                lg_gtt_elphelp(
+
+                    lnOutput->imBytes,
+                    lnOutput->imWidth,
+                    lnOutput->imHeight,
+                    lnOutput->imLayers,
+                    lnInput->imBytes,
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    lnInput->imLayers,
+                    lnGnomonic->gnSightX,
+                    lnGnomonic->gnSightY,
+                    lnGnomonic->gnmWidth,
+                    lnGnomonic->gnmHeight,
+                    lnGnomonic->gnmCornerX,
+                    lnGnomonic->gnmCornerY,
+                    lnGnomonic->gnRoll,
+                    lnGnomonic->gnAzim,
+                    lnGnomonic->gnElev,
+                    lnGnomonic->gnHead,
+                    lnGnomonic->gnPixel,
+                    lnGnomonic->gnFocal,
+                    lnMethod,
+                    lnThread
+
+                );
+
+            } break;
+
+            /* Projection - center-specific */
+            case ( LN_CENTER ) : {
+
+                lg_gtt_centerp(
+
+                    lnOutput->imBytes,
+                    lnOutput->imWidth,
+                    lnOutput->imHeight,
+                    lnOutput->imLayers,
+                    lnInput->imBytes,
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    lnInput->imLayers,
+                    lnGnomonic->gnmWidth,
+                    lnGnomonic->gnmHeight,
+                    lnGnomonic->gnmCornerX,
+                    lnGnomonic->gnmCornerY,
+                    lnGnomonic->gnAzim,
+                    lnGnomonic->gnElev,
+                    lnGnomonic->gnRoll,
+                    lnGnomonic->gnFocal,
+                    lnGnomonic->gnPixel,
+                    lnMethod,
+                    lnThread
+
+                );
+
+            } break;
+
+            /* Projection - aperture-specific */
+            case ( LN_COMPLETE ) : {
+
+                lg_gte_apperturep( 
+
+                    lnOutput->imBytes,
+                    lnOutput->imWidth,
+                    lnOutput->imHeight,
+                    lnOutput->imLayers,
+                    lnInput->imBytes,
+                    lnInput->imWidth,
+                    lnInput->imHeight,
+                    lnInput->imLayers,
+                    lnGnomonic->gnAzim,
+                    lnGnomonic->gnElev,
+                    lnGnomonic->gnRoll,
+                    lnGnomonic->gnApper,
+                    lnMethod,
+                    lnThread
+
+                );
+
+            } break;
+
+            /* Unknown projection model */
+            default : { return( LN_ERROR_MODEL ); }
+
+        };
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
@@ -0,0 +1,307 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama-gnomonic.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Gnomonic projections
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LN_GNOMONIC__
+    # define __LN_GNOMONIC__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <math.h>
+    # include <limits.h>
+    # include "norama.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define projection models */
+    # define LN_GENERIC     0
+    # define LN_ELPHEL      1
+    # define LN_CENTER      2
+    # define LN_COMPLETE    3
+
+    /* Define footprint probe mapping width */
+    # define LN_PROBE       1024
+
+    /* Define footprint margin - interpolation support */
+    # define LN_MARGIN      8
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct ln_Gnomonic_struct
+     *  \brief Gnomonic projection parameters
+     *
+     *  This structure gathers the parameters of the gnomonic projections used
+     *  by norama-direct and norama-invert. The used fields depend on the
+     *  projection model. Angles are expressed in radian.
+     *
+     *  \var ln_Gnomonic_struct::gnModel
+     *  Projection model
+     *  \var ln_Gnomonic_struct::gnSightX
+     *  Projection x-sight in floating pixels
+     *  \var ln_Gnomonic_struct::gnSightY
+     *  Projection y-sight in floating pixels
+     *  \var ln_Gnomonic_struct::gnmWidth
+     *  Entire equirectangular mapping width, in pixels
+     *  \var ln_Gnomonic_struct::gnmHeight
+     *  Entire equirectangular mapping height, in pixels
+     *  \var ln_Gnomonic_struct::gnmCornerX
+     *  Equirectangular tile x-position
+     *  \var ln_Gnomonic_struct::gnmCornerY
+     *  Equirectangular tile y-position
+     *  \var ln_Gnomonic_struct::gnAzim
+     *  Azimuth angle - rotation along z axis
+     *  \var ln_Gnomonic_struct::gnHead
+     *  Heading angle - azimuth correction
+     *  \var ln_Gnomonic_struct::gnElev
+     *  Elevation angle - rotation along y axis
+     *  \var ln_Gnomonic_struct::gnRoll
+     *  Roll angle - rotation along x axis
+     *  \var ln_Gnomonic_struct::gnApper
+     *  Aperture angle
+     *  \var ln_Gnomonic_struct::gnFocal
+     *  Rectilinear focal length, in mm
+     *  \var ln_Gnomonic_struct::gnPixel
+     *  Rectilinear pixel length, in mm
+     */
+
+    typedef struct ln_Gnomonic_struct {
+
+        int    gnModel;
+        double gnSightX;
+        double gnSightY;
+        int    gnmWidth;
+        int    gnmHeight;
+        int    gnmCornerX;
+        int    gnmCornerY;
+        double gnAzim;
+        double gnHead;
+        double gnElev;
+        double gnRoll;
+        double gnApper;
+        double gnFocal;
+        double gnPixel;
+
+    } ln_Gnomonic_t;
+
+    /*! \struct ln_Region_struct
+     *  \brief Image region
+     *
+     *  This structure describes a rectangular region of an image.
+     *
+     *  \var ln_Region_struct::rgX
+     *  Region left column
+     *  \var ln_Region_struct::rgY
+     *  Region top row
+     *  \var ln_Region_struct::rgWidth
+     *  Region width, in pixels
+     *  \var ln_Region_struct::rgHeight
+     *  Region height, in pixels
+     */
+
+    typedef struct ln_Region_struct {
+
+        int rgX;
+        int rgY;
+        int rgWidth;
+        int rgHeight;
+
+    } ln_Region_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Gnomonic projection
+     *
+     *  This function computes the gnomonic projection of the input
+     *  equirectangular mapping, or tile of it, and stores it in the output
+     *  rectilinear image according to the projection model and parameters.
+     *  The output image content is only overwritten where the projection is
+     *  defined, allowing its use as a seed. This function is the
+     *  implementation of norama-direct.
+     *
+     *  \param lnInput      Input equirectangular mapping
+     *  \param lnOutput     Output rectilinear image
+     *  \param lnGnomonic   Projection parameters
+     *  \param lnMethod     Interpolation method
+     *  \param lnThread     Number of threads
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_direct ( 
+
+        ln_Image_t    const * const lnInput, 
+        ln_Image_t          * const lnOutput, 
+        ln_Gnomonic_t const * const lnGnomonic, 
+        li_Method_t           const lnMethod, 
+        int                   const lnThread 
+
+    );
+
+    /*! \brief Gnomonic projection footprint
+     *
+     *  This function computes the region of the input equirectangular mapping,
+     *  or tile of it, that is read by the gnomonic projection of ln_direct. The
+     *  footprint of a rectilinear image of the provided size is rendered by the
+     *  inverted gnomonic projection on a probe mapping of LN_PROBE pixels width
+     *  and its bounding box is scaled back on the mapping. The region is then
+     *  enlarged by one probe pixel and by LN_MARGIN pixels for interpolation. A
+     *  footprint crossing the mapping border results in the entire width, as
+     *  an empty footprint results in the entire mapping.
+     *
+     *  \param lnGnomonic   Projection parameters
+     *  \param lnWidth      Input equirectangular mapping width, in pixels
+     *  \param lnHeight     Input equirectangular mapping height, in pixels
+     *  \param lnrWidth     Output rectilinear image width, in pixels
+     *  \param lnrHeight    Output rectilinear image height, in pixels
+     *  \param lnRegion     Returned input mapping region
+     *  \param lnThread     Number of threads
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_footprint (
+
+        ln_Gnomonic_t const * const lnGnomonic,
+        int                   const lnWidth,
+        int                   const lnHeight,
+        int                   const lnrWidth,
+        int                   const lnrHeight,
+        ln_Region_t         * const lnRegion,
+        int                   const lnThread
+
+    );
+
+    /*! \brief Gnomonic projection sampling density
+     *
+     *  This function computes the sampling density of the input mapping that
+     *  is required by the gnomonic projection, relative to its resolution. It
+     *  is the ratio between the angular size of the mapping pixels and the
+     *  mean angular size of the rectilinear pixels. A density lower than one
+     *  indicates that the mapping can be reduced without loss of details in
+     *  the rectilinear image.
+     *
+     *  \param lnGnomonic   Projection parameters
+     *  \param lnWidth      Input equirectangular mapping width, in pixels
+     *  \param lnrWidth     Output rectilinear image width, in pixels
+     *
+     *  \return Returns required sampling density, one if unknown
+     */
+
+    double ln_density (
+
+        ln_Gnomonic_t const * const lnGnomonic,
+        int                   const lnWidth,
+        int                   const lnrWidth
+
+    );
+
+    /*! \brief Inverted gnomonic projection
+     *
+     *  This function computes the inverted gnomonic projection of the input
+     *  rectilinear image and stores it in the output equirectangular mapping,
+     *  or tile of it, according to the projection model and parameters. The
+     *  output mapping content is only overwritten on the footprint of the
+     *  rectilinear image, allowing its use as a seed. This function is the
+     *  implementation of norama-invert.
+     *
+     *  \param lnInput      Input rectilinear image
+     *  \param lnOutput     Output equirectangular mapping
+     *  \param lnGnomonic   Projection parameters
+     *  \param lnMethod     Interpolation method
+     *  \param lnThread     Number of threads
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_invert ( 
+
+        ln_Image_t    const * const lnInput, 
+        ln_Image_t          * const lnOutput, 
+        ln_Gnomonic_t const * const lnGnomonic, 
+        li_Method_t           const lnMethod, 
+        int                   const lnThread 
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,317 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama-index.h"
+
+/*
+    Source - Orientation index creation
+ */
+
+    int ln_index_create( 
+
+        char       const * const lnFile, 
+        ln_Query_t       * const lnQuery, 
+        lp_Time_t  const * const lnSecond, 
+        lp_Time_t  const * const lnMicro, 
+        size_t             const lnCount, 
+        size_t           * const lnIndexed 
+
+    ) {
+
+        /* Index header variables */
+        ln_Header_t lnHeader = { LN_INDEX_MAGIC, 0, sizeof( ln_Record_t ) };
+
+        /* Index records variables */
+        ln_Record_t * lnRecord = NULL;
+
+        /* Index stream variables */
+        FILE * lnStream = NULL;
+
+        /* Records count variables */
+        size_t lnStore = 0;
+
+        /* Parsing variables */
+        size_t lnParse = 0;
+
+        /* Returned value variables */
+        int lnReturn = LN_SUCCESS;
+
+        /* Allocate records */
+        if ( ( lnRecord = ( ln_Record_t * ) malloc( ( lnCount > 0 ? lnCount : 1 ) * sizeof( ln_Record_t ) ) ) == NULL ) return( LN_ERROR_INDEX );
+
+        /* Query trigger timestamps */
+        for ( lnParse = 0; lnParse < lnCount; lnParse ++ ) {
+
+            /* Query rotation matrix */
+            if ( ln_query_matrix( lnQuery, lnSecond[lnParse], lnMicro[lnParse], lnRecord[lnStore].rcMatrix ) != LN_SUCCESS ) continue;
+
+            /* Assign record timestamps */
+            lnRecord[lnStore].rcMaster = lp_timestamp_compose( lnSecond[lnParse], lnMicro[lnParse] );
+            lnRecord[lnStore].rcSynch  = lnQuery->qrTrigger.qrSynch;
+
+            /* Update records count */
+            lnStore ++;
+
+        }
+
+        /* Sort records by master timestamp */
+        qsort( lnRecord, lnStore, sizeof( ln_Record_t ), & ln_index_order );
+
+        /* Remove duplicated timestamps */
+        for ( lnParse = 1, lnHeader.hdCount = lnStore > 0 ? 1 : 0; lnParse < lnStore; lnParse ++ ) {
+
+            /* Check timestamp duplication */
+            if ( lnRecord[lnParse].rcMaster != lnRecord[lnHeader.hdCount - 1].rcMaster ) lnRecord[lnHeader.hdCount ++] = lnRecord[lnParse];
+
+        }
+
+        /* Create index file */
+        if ( ( lnStream = fopen( lnFile, "wb" ) ) != NULL ) {
+
+            /* Write header and records */
+            if ( ( fwrite( & lnHeader, sizeof( ln_Header_t ), 1, lnStream ) != 1 ) || ( fwrite( lnRecord, sizeof( ln_Record_t ), lnHeader.hdCount, lnStream ) != lnHeader.hdCount ) ) lnReturn = LN_ERROR_INDEX;
+
+            /* Close index file */
+            if ( fclose( lnStream ) != 0 ) lnReturn = LN_ERROR_INDEX;
+
+        } else { lnReturn = LN_ERROR_INDEX; }
+
+        /* Return indexed count */
+        if ( lnIndexed != NULL ) * lnIndexed = lnHeader.hdCount;
+
+        /* Release records */
+        free( lnRecord );
+
+        /* Return status */
+        return( lnReturn );
+
+    }
+
+/*
+    Source - Orientation index opening
+ */
+
+    int ln_index_open( ln_Index_t * const lnIndex, char const * const lnFile ) {
+
+        /* Index header variables */
+        ln_Header_t const * lnHeader = NULL;
+
+        /* File status variables */
+        struct stat lnStat;
+
+        /* File descriptor variables */
+        int lnFD = -1;
+
+        /* Reset index */
+        * lnIndex = ( ln_Index_t ) { NULL, 0, NULL, 0 };
+
+        /* Open index file */
+        if ( ( lnFD = open( lnFile, O_RDONLY ) ) < 0 ) return( LN_ERROR_INDEX );
+
+        /* Verify index file size */
+        if ( ( fstat( lnFD, & lnStat ) != 0 ) || ( lnStat.st_size < ( off_t ) sizeof( ln_Header_t ) ) ) {
+
+            /* Close index file */
+            close( lnFD );
+
+            /* Send message */
+            return( LN_ERROR_INDEX );
+
+        }
+
+        /* Map index file */
+        lnIndex->ixMap = mmap( NULL, lnStat.st_size, PROT_READ, MAP_SHARED, lnFD, 0 );
+
+        /* Close index file - mapping kept */
+        close( lnFD );
+
+        /* Verify mapping */
+        if ( lnIndex->ixMap == MAP_FAILED ) {
+
+            /* Reset mapping */
+            lnIndex->ixMap = NULL;
+
+            /* Send message */
+            return( LN_ERROR_INDEX );
+
+        }
+
+        /* Assign mapping size */
+        lnIndex->ixSize = lnStat.st_size;
+
+        /* Retrieve index header */
+        lnHeader = ( ln_Header_t const * ) lnIndex->ixMap;
+
+        /* Verify index signature and size */
+        if ( ( memcmp( lnHeader->hdMagic, LN_INDEX_MAGIC, 8 ) != 0 ) || ( lnHeader->hdRecord != sizeof( ln_Record_t ) ) || ( lnHeader->hdCount > ( lnIndex->ixSize - sizeof( ln_Header_t ) ) / sizeof( ln_Record_t ) ) ) {
+
+            /* Release mapping */
+            ln_index_close( lnIndex );
+
+            /* Send message */
+            return( LN_ERROR_INDEX );
+
+        }
+
+        /* Assign index records */
+        lnIndex->ixRecord = ( ln_Record_t const * ) ( lnHeader + 1 );
+        lnIndex->ixCount  = lnHeader->hdCount;
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - Orientation index query
+ */
+
+    int ln_index_matrix( 
+
+        ln_Index_t const * const lnIndex, 
+        lp_Time_t          const lnSecond, 
+        lp_Time_t          const lnMicro, 
+        lp_Real_t                lnMatrix[3][3] 
+
+    ) {
+
+        /* Searched timestamp variables */
+        lp_Time_t lnMaster = lp_timestamp_compose( lnSecond, lnMicro );
+
+        /* Bisection variables */
+        size_t lnLow  = 0;
+        size_t lnHigh = lnIndex->ixCount;
+        size_t lnMid  = 0;
+
+        /* Verify index state */
+        if ( lnIndex->ixRecord == NULL ) return( LN_ERROR_INDEX );
+
+        /* Search record by bisection */
+        while ( lnLow < lnHigh ) {
+
+            /* Compute middle record */
+            lnMid = lnLow + ( lnHigh - lnLow ) / 2;
+
+            /* Update bounds */
+            if ( lnIndex->ixRecord[lnMid].rcMaster < lnMaster ) lnLow = lnMid + 1; else lnHigh = lnMid;
+
+        }
+
+        /* Verify record */
+        if ( ( lnLow == lnIndex->ixCount ) || ( lnIndex->ixRecord[lnLow].rcMaster != lnMaster ) ) return( LN_ERROR_TIMESTAMP );
+
+        /* Return rotation matrix */
+        memcpy( lnMatrix, lnIndex->ixRecord[lnLow].rcMatrix, sizeof( lp_Real_t ) * 9 );
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - Orientation index closing
+ */
+
+    void ln_index_close( ln_Index_t * const lnIndex ) {
+
+        /* Verify index state */
+        if ( lnIndex->ixMap == NULL ) return;
+
+        /* Unmap index file */
+        munmap( lnIndex->ixMap, lnIndex->ixSize );
+
+        /* Reset index */
+        * lnIndex = ( ln_Index_t ) { NULL, 0, NULL, 0 };
+
+    }
+
+/*
+    Source - Orientation index single query
+ */
+
+    int ln_index_single( 
+
+        char       const * const lnFile, 
+        lp_Time_t          const lnSecond, 
+        lp_Time_t          const lnMicro, 
+        lp_Real_t                lnMatrix[3][3] 
+
+    ) {
+
+        /* Index variables */
+        ln_Index_t lnIndex;
+
+        /* Returned value variables */
+        int lnReturn = LN_SUCCESS;
+
+        /* Open index */
+        if ( ( lnReturn = ln_index_open( & lnIndex, lnFile ) ) == LN_SUCCESS ) {
+
+            /* Query orientation */
+            lnReturn = ln_index_matrix( & lnIndex, lnSecond, lnMicro, lnMatrix );
+
+            /* Close index */
+            ln_index_close( & lnIndex );
+
+        }
+
+        /* Return status */
+        return( lnReturn );
+
+    }
+
+/*
+    Source - Orientation index records ordering
+ */
+
+    int ln_index_order( void const * lnA, void const * lnB ) {
+
+        /* Records variables */
+        ln_Record_t const * lnRecordA = ( ln_Record_t const * ) lnA;
+        ln_Record_t const * lnRecordB = ( ln_Record_t const * ) lnB;
+
+        /* Compare timestamps */
+        return( lnRecordA->rcMaster < lnRecordB->rcMaster ? -1 : ( lnRecordA->rcMaster > lnRecordB->rcMaster ? 1 : 0 ) );
+
+    }
+
@@ -0,0 +1,284 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama-index.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Earth-attached orientation index
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LN_INDEX__
+    # define __LN_INDEX__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/mman.h>
+    # include <sys/stat.h>
+    # include "norama.h"
+    # include "norama-earth.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define index file signature */
+    # define LN_INDEX_MAGIC "LNINDEX1"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct ln_Record_struct
+     *  \brief Orientation index record
+     *
+     *  This structure is the orientation index record, as stored in the index
+     *  file. The records are sorted by master timestamp.
+     *
+     *  \var ln_Record_struct::rcMaster
+     *  Trigger master timestamp
+     *  \var ln_Record_struct::rcSynch
+     *  Trigger synchronization timestamp
+     *  \var ln_Record_struct::rcMatrix
+     *  Earth-attached rotation matrix
+     */
+
+    typedef struct ln_Record_struct {
+
+        lp_Time_t rcMaster;
+        lp_Time_t rcSynch;
+        lp_Real_t rcMatrix[3][3];
+
+    } ln_Record_t;
+
+    /*! \struct ln_Header_struct
+     *  \brief Orientation index header
+     *
+     *  This structure is the orientation index file header, followed by the
+     *  index records.
+     *
+     *  \var ln_Header_struct::hdMagic
+     *  Index file signature
+     *  \var ln_Header_struct::hdCount
+     *  Index records count
+     *  \var ln_Header_struct::hdRecord
+     *  Index record size, in bytes
+     */
+
+    typedef struct ln_Header_struct {
+
+        char      hdMagic[8];
+        lp_Time_t hdCount;
+        lp_Time_t hdRecord;
+
+    } ln_Header_t;
+
+    /*! \struct ln_Index_struct
+     *  \brief Orientation index
+     *
+     *  This structure holds an orientation index file mapped in memory.
+     *
+     *  \var ln_Index_struct::ixMap
+     *  Mapped index file, NULL if not opened
+     *  \var ln_Index_struct::ixSize
+     *  Mapped index file size, in bytes
+     *  \var ln_Index_struct::ixRecord
+     *  Index records
+     *  \var ln_Index_struct::ixCount
+     *  Index records count
+     */
+
+    typedef struct ln_Index_struct {
+
+        void              * ixMap;
+        size_t              ixSize;
+        ln_Record_t const * ixRecord;
+        size_t              ixCount;
+
+    } ln_Index_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Orientation index creation
+     *
+     *  This function queries the orientation of each provided trigger timestamp
+     *  through the opened query handles and writes the resulting records,
+     *  sorted by master timestamp, in the index file. The timestamps whose
+     *  query fails are not indexed.
+     *
+     *  \param lnFile   Index file path
+     *  \param lnQuery  Query handles structure
+     *  \param lnSecond Trigger timestamps seconds
+     *  \param lnMicro  Trigger timestamps micro-seconds
+     *  \param lnCount  Trigger timestamps count
+     *  \param lnIndexed Returned indexed timestamps count, may be NULL
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_index_create ( 
+
+        char       const * const lnFile, 
+        ln_Query_t       * const lnQuery, 
+        lp_Time_t  const * const lnSecond, 
+        lp_Time_t  const * const lnMicro, 
+        size_t             const lnCount, 
+        size_t           * const lnIndexed 
+
+    );
+
+    /*! \brief Orientation index opening
+     *
+     *  This function maps the provided index file in memory after verification
+     *  of its signature and size.
+     *
+     *  \param lnIndex Orientation index structure
+     *  \param lnFile  Index file path
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_index_open ( ln_Index_t * const lnIndex, char const * const lnFile );
+
+    /*! \brief Orientation index query
+     *
+     *  This function searches, by bisection, the record of the provided
+     *  trigger timestamp and returns its rotation matrix.
+     *
+     *  \param lnIndex  Orientation index structure
+     *  \param lnSecond Trigger timestamp seconds
+     *  \param lnMicro  Trigger timestamp micro-seconds
+     *  \param lnMatrix Returned rotation matrix
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_index_matrix ( 
+
+        ln_Index_t const * const lnIndex, 
+        lp_Time_t          const lnSecond, 
+        lp_Time_t          const lnMicro, 
+        lp_Real_t                lnMatrix[3][3] 
+
+    );
+
+    /*! \brief Orientation index closing
+     *
+     *  This function unmaps the index file. Calling it on a closed index has
+     *  no effect.
+     *
+     *  \param lnIndex Orientation index structure
+     */
+
+    void ln_index_close ( ln_Index_t * const lnIndex );
+
+    /*! \brief Orientation index single query
+     *
+     *  This function returns the rotation matrix of the provided trigger
+     *  timestamp from an index file. The index is opened and closed by the
+     *  function.
+     *
+     *  \param lnFile   Index file path
+     *  \param lnSecond Trigger timestamp seconds
+     *  \param lnMicro  Trigger timestamp micro-seconds
+     *  \param lnMatrix Returned rotation matrix
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_index_single ( 
+
+        char       const * const lnFile, 
+        lp_Time_t          const lnSecond, 
+        lp_Time_t          const lnMicro, 
+        lp_Real_t                lnMatrix[3][3] 
+
+    );
+
+    /*! \brief Orientation index records ordering
+     *
+     *  This function is the comparison function used to sort the records by
+     *  master timestamp.
+     *
+     *  \param lnA First record address
+     *  \param lnB Second record address
+     *
+     *  \return Returns comparison result
+     */
+
+    int ln_index_order ( void const * lnA, void const * lnB );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,88 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama-rotate.h"
+
+/*
+    Source - Equirectangular mapping rotation
+ */
+
+    int ln_rotate( 
+
+        ln_Image_t const * const lnInput, 
+        ln_Image_t       * const lnOutput, 
+        double             const lnAzim, 
+        double             const lnElev, 
+        double             const lnRoll, 
+        li_Method_t        const lnMethod, 
+        int                const lnThread 
+
+    ) {
+
+        /* Verify image descriptors */
+        if ( ( ln_image( lnInput ) == LN_FALSE ) || ( ln_image( lnOutput ) == LN_FALSE ) ) return( LN_ERROR_IMAGE );
+
+        /* Verify mappings consistency */
+        if ( ( lnInput->imWidth != lnOutput->imWidth ) || ( lnInput->imHeight != lnOutput->imHeight ) || ( lnInput->imLayers != lnOutput->imLayers ) ) return( LN_ERROR_IMAGE );
+
+        /* Apply equirectangular transform */
+        lg_transform_rotatep( 
+
+            lnInput->imBytes,
+            lnOutput->imBytes,
+            lnInput->imWidth,
+            lnInput->imHeight,
+            lnInput->imLayers,
+            lnAzim,
+            lnElev,
+            lnRoll,
+            lnMethod,
+            lnThread
+
+        );
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
@@ -0,0 +1,129 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama-rotate.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Equirectangular mapping rotation
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LN_ROTATE__
+    # define __LN_ROTATE__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "norama.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Equirectangular mapping rotation
+     *
+     *  This function applies the rotation defined by the provided angles on
+     *  the input equirectangular mapping and stores the result in the output
+     *  mapping. Both mappings have to share the same dimensions and layers
+     *  count. This function is the implementation of norama-rotate.
+     *
+     *  \param lnInput  Input equirectangular mapping
+     *  \param lnOutput Output equirectangular mapping
+     *  \param lnAzim   Azimuth angle, in radian - rotation along z axis
+     *  \param lnElev   Elevation angle, in radian - rotation along y axis
+     *  \param lnRoll   Roll angle, in radian - rotation along x axis
+     *  \param lnMethod Interpolation method
+     *  \param lnThread Number of threads
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int ln_rotate ( 
+
+        ln_Image_t const * const lnInput, 
+        ln_Image_t       * const lnOutput, 
+        double             const lnAzim, 
+        double             const lnElev, 
+        double             const lnRoll, 
+        li_Method_t        const lnMethod, 
+        int                const lnThread 
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
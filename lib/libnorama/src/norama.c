@@ -0,0 +1,113 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama.h"
+
+/*
+    Source - Error message
+ */
+
+    char const * ln_error( int const lnError ) {
+
+        /* Switch on error code */
+        switch ( lnError ) {
+
+            case ( LN_SUCCESS         ) : return( "Success" );
+            case ( LN_ERROR_IMAGE     ) : return( "Invalid image descriptor" );
+            case ( LN_ERROR_MODEL     ) : return( "Unknown projection model" );
+            case ( LN_ERROR_SWITCH    ) : return( "Invalid CSPS switch specification" );
+            case ( LN_ERROR_TRIGGER   ) : return( "Unable to create query structure on trigger" );
+            case ( LN_ERROR_ORIENT    ) : return( "Unable to create query structure on orientation" );
+            case ( LN_ERROR_TIMESTAMP ) : return( "Unable to query trigger timestamp" );
+            case ( LN_ERROR_QUERY     ) : return( "Unable to query orientation" );
+            case ( LN_ERROR_INDEX     ) : return( "Unable to access orientation index" );
+
+        };
+
+        /* Unknown error code */
+        return( "Unknown error" );
+
+    }
+
+/*
+    Source - Image descriptor verification
+ */
+
+    int ln_image( ln_Image_t const * const lnImage ) {
+
+        /* Verify descriptor */
+        if ( ( lnImage == NULL ) || ( lnImage->imBytes == NULL ) ) return( LN_FALSE );
+
+        /* Verify dimensions */
+        if ( ( lnImage->imWidth <= 0 ) || ( lnImage->imHeight <= 0 ) || ( lnImage->imLayers <= 0 ) ) return( LN_FALSE );
+
+        /* Valid descriptor */
+        return( LN_TRUE );
+
+    }
+
+/*
+    Source - Image clearing
+ */
+
+    void ln_clear( ln_Image_t * const lnImage, inter_C8_t const lnRed, inter_C8_t const lnGreen, inter_C8_t const lnBlue ) {
+
+        /* Color components variables */
+        inter_C8_t lnColor[3] = { lnBlue, lnGreen, lnRed };
+
+        /* Image size variables */
+        size_t lnSize = ( size_t ) lnImage->imWidth * lnImage->imHeight * lnImage->imLayers;
+
+        /* Parsing variables */
+        size_t lnParse = 0;
+
+        /* Assign pixels components */
+        for ( lnParse = 0; lnParse < lnSize; lnParse ++ ) {
+
+            /* Assign component */
+            lnImage->imBytes[lnParse] = ( ( lnParse % lnImage->imLayers ) < 3 ) ? lnColor[lnParse % lnImage->imLayers] : 0;
+
+        }
+
+    }
+
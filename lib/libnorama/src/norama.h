@@ -0,0 +1,222 @@
+/*
+ * norama-suite libnorama - norama-suite tools library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Library common header file
+     */
+
+    /*! \mainpage norama-suite tools library
+     *
+     *  \section norama-suite
+     *  \section _ Panorama tools suite
+     *
+     *  This software suite offers tools for numerical panoramas manipulation.
+     *  Mostly designed for equirectangular mappings, its role is to provide an
+     *  interface to libgnomonic and its algorithms. It then offers an interface
+     *  to projection and transformation features implemented in the gnomonic
+     *  library. The norama-suite is also interfaced with libcsps in order to 
+     *  take advantage of camera motion tracking to operate and align panoramas
+     *  on earth. It also comes with a panorama viewer to complete the suite. 
+     *
+     *  This library gathers the operations performed by the suite tools so that
+     *  they can be called in-process on caller-provided buffers, without file
+     *  input/output nor arguments parsing. The suite tools are front-ends to
+     *  this library.
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/norama-suite/wiki
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LN__
+    # define __LN__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <gnomonic-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define boolean constants */
+    # define LN_FALSE           0
+    # define LN_TRUE            1
+
+    /* Define error codes */
+    # define LN_SUCCESS         0
+    # define LN_ERROR_IMAGE     1
+    # define LN_ERROR_MODEL     2
+    # define LN_ERROR_SWITCH    3
+    # define LN_ERROR_TRIGGER   4
+    # define LN_ERROR_ORIENT    5
+    # define LN_ERROR_TIMESTAMP 6
+    # define LN_ERROR_QUERY     7
+    # define LN_ERROR_INDEX     8
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct ln_Image_struct
+     *  \brief Image buffer descriptor
+     *
+     *  This structure describes a caller-provided image buffer. The pixels are
+     *  stored row by row without padding, each pixel being made of imLayers
+     *  consecutive bytes.
+     *
+     *  \var ln_Image_struct::imBytes
+     *  Pointer to image bytes
+     *  \var ln_Image_struct::imWidth
+     *  Image width, in pixels
+     *  \var ln_Image_struct::imHeight
+     *  Image height, in pixels
+     *  \var ln_Image_struct::imLayers
+     *  Number of layers (chromatic channels) of the image
+     */
+
+    typedef struct ln_Image_struct {
+
+        inter_C8_t * imBytes;
+        int          imWidth;
+        int          imHeight;
+        int          imLayers;
+
+    } ln_Image_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Error message
+     *
+     *  This function returns the message describing the error code returned by
+     *  the library functions.
+     *
+     *  \param lnError Error code
+     *
+     *  \return Returns pointer to constant error message string
+     */
+
+    char const * ln_error ( int const lnError );
+
+    /*! \brief Image descriptor verification
+     *
+     *  This function verifies that the provided image descriptor points to an
+     *  allocated buffer with valid dimensions.
+     *
+     *  \param lnImage Image descriptor
+     *
+     *  \return Returns LN_TRUE if the descriptor is valid, LN_FALSE otherwise
+     */
+
+    int ln_image ( ln_Image_t const * const lnImage );
+
+    /*! \brief Image clearing
+     *
+     *  This function assigns the provided color to each pixel of the image.
+     *  The components are assigned in blue, green, red order on the image
+     *  layers, the additional layers being set to zero.
+     *
+     *  \param lnImage Image descriptor
+     *  \param lnRed   Red component of clear color
+     *  \param lnGreen Green component of clear color
+     *  \param lnBlue  Blue component of clear color
+     */
+
+    void ln_clear ( ln_Image_t * const lnImage, inter_C8_t const lnRed, inter_C8_t const lnGreen, inter_C8_t const lnBlue );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
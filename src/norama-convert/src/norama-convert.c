@@ -0,0 +1,107 @@
+/*
+ * norama suite - Panorama tools suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama-convert.h"
+
+/*
+    Source - Software main function
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Exportation options variables */
+        int nrOption = -1;
+
+        /* Image path variables */
+        char * nriPath = NULL;
+        char * nroPath = NULL;
+
+        /* Image allocation variables */
+        IplImage * nriImage = NULL;
+
+        /* Search in parameters */
+        lc_stdp( lc_stda( argc, argv, "--input" , "-i" ), argv, & nriPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output", "-o" ), argv, & nroPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--export", "-q" ), argv, & nrOption, LC_INT    );
+
+        /* Software swicth */
+        if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
+
+            /* Display usage */
+            fprintf( stdout, NR_HELP );
+
+        } else {
+
+            /* Verify path strings */
+            if ( ( nriPath != NULL ) && ( nroPath != NULL ) ) {
+
+                /* Import input image */
+                nriImage = lc_imread( nriPath, CV_LOAD_IMAGE_UNCHANGED );
+
+                /*  Verify input image reading */
+                if ( nriImage != NULL ) {
+
+                    /* Export output image */
+                    if ( lc_imwrite( nroPath, nriImage, nrOption ) == 0 ) {
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : Unable to write output image\n" );
+
+                    }
+
+                    /* Release image memory */
+                    lc_imrelease( & nriImage );
+
+                /* Display message */
+                } else { fprintf( LC_ERR, "Error : Unable to read input image\n" ); }
+
+            /* Display message */
+            } else { fprintf( LC_ERR, "Error : Invalid path specification\n" ); }
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
@@ -0,0 +1,162 @@
+/*
+ * norama suite - Panorama tools suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama-convert.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Software main header
+     */
+
+    /*! \mainpage norama-convert
+     *
+     *  \section norama-suite
+     *  \section _ Panorama tools suite
+     *
+     *  This software suite offers tools for numerical panoramas manipulation.
+     *  Mostly designed for equirectangular mappings, its role is to provide an 
+     *  interface to libgnomonic and its algorithms. It then offers an interface
+     *  to projection and transformation features implemented in the gnomonic 
+     *  library. The norama-suite is also interfaced with libcsps in order to 
+     *  take advantage of camera motion tracking to operate and align panoramas
+     *  on earth. It also comes with a panorama viewer to complete the suite. 
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/norama-suite/wiki
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __NR_CONVERT__
+    # define __NR_CONVERT__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <opencv/cv.h>
+    # include <opencv/highgui.h>
+    # include <common-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Standard help */
+    # define NR_HELP "Usage summary :\n\n"                  \
+    "\tnorama-convert [Arguments] [Parameters] ...\n\n"     \
+    "Short arguments and parameters summary :\n\n"          \
+    "\t-i\tInput image or raw canvas\n"                     \
+    "\t-o\tOutput image or raw canvas\n"                    \
+    "\t-q\tOutput image exportation options\n\n"            \
+    "norama-convert - norama-suite\n"                       \
+    "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Software main function
+     *  
+     *  The main function frame follows : parameters are initialized and read.
+     *  The input image is loaded and exported in the format deduced from the
+     *  output file extension. It is mainly used to convert the raw canvas
+     *  composited in place by norama-invert, of nrc extension, in a standard
+     *  image format once the compositing is done.
+     *  
+     *  \param argc Standard main parameter
+     *  \param argv Standard main parameter
+     */
+
+    int main ( int argc, char ** argv );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
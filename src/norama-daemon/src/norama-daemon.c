@@ -0,0 +1,1273 @@
+/*
+ * norama suite - Panorama tools suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama-daemon.h"
+
+/*
+    Source - Daemon termination flag
+ */
+
+    static volatile sig_atomic_t nr_daemon_stop = 0;
+
+    static void nr_daemon_signal( int nrSignal ) {
+
+        /* Request daemon loop termination */
+        nr_daemon_stop = 1;
+
+    }
+
+/*
+    Source - Software main function
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Job separator variables */
+        int nrSplit = 1;
+
+        /* Cache size variables */
+        int nrCache = NR_DFT_CACHE;
+
+        /* Socket path variables */
+        char * nrSocket = NULL;
+
+        /* Default socket path variables */
+        char nrPath[PATH_MAX];
+
+        /* Daemon state variables */
+        static nr_Daemon nrDaemon;
+
+        /* Search job separator */
+        while ( ( nrSplit < argc ) && ( strcmp( argv[nrSplit], "--" ) != 0 ) ) nrSplit ++;
+
+        /* Initialize daemon state */
+        memset( & nrDaemon, 0, sizeof( nr_Daemon ) );
+
+        /* Assign default thread count */
+        nrDaemon.dmThread = NR_DFT_THREAD;
+
+        /* Search in parameters */
+        lc_stdp( lc_stda( nrSplit, argv, "--socket" , "-S" ), argv, & nrSocket         , LC_STRING );
+        lc_stdp( lc_stda( nrSplit, argv, "--cache"  , "-c" ), argv, & nrCache          , LC_INT    );
+        lc_stdp( lc_stda( nrSplit, argv, "--threads", "-t" ), argv, & nrDaemon.dmThread, LC_INT    );
+
+        /* Software swicth */
+        if ( lc_stda( nrSplit, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
+
+            /* Display usage */
+            fprintf( stdout, NR_HELP );
+
+        } else
+        if ( ( nrSocket == NULL ) && ( nr_daemon_path( nrPath ) == LC_FALSE ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to create daemon socket directory\n" ); return( EXIT_FAILURE );
+
+        } else
+        if ( nrSplit < argc ) {
+
+            /* Send job to daemon */
+            return( nr_daemon_client( nrSocket != NULL ? nrSocket : nrPath, argc - nrSplit - 1, argv + nrSplit + 1 ) );
+
+        } else {
+
+            /* Compute cache size */
+            nrDaemon.dmBudget = ( size_t ) ( nrCache < 0 ? 0 : nrCache ) * 1024 * 1024;
+
+            /* Start daemon */
+            return( nr_daemon_server( nrSocket != NULL ? nrSocket : nrPath, & nrDaemon ) );
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Daemon server
+ */
+
+    int nr_daemon_server( char const * const nrSocket, nr_Daemon * const nrDaemon ) {
+
+        /* Socket descriptor variables */
+        int nrServer = -1;
+        int nrClient = -1;
+
+        /* Socket address variables */
+        struct sockaddr_un nrAddress;
+
+        /* Peer credentials variables */
+        struct ucred nrPeer;
+        socklen_t    nrLength = sizeof( nrPeer );
+
+        /* Connection timeout variables */
+        struct timeval nrTimeout = { NR_JOB_TIMEOUT, 0 };
+
+        /* Creation mask variables */
+        mode_t nrMask = 0;
+
+        /* Signal action variables */
+        struct sigaction nrAction;
+
+        /* Job buffer variables */
+        char nrJob[NR_JOB_SIZE];
+
+        /* Job arguments variables */
+        char * nrArgv[NR_JOB_ARGS];
+        int    nrArgc = 0;
+
+        /* Job size variables */
+        ssize_t nrRead = 0;
+        size_t  nrSize = 0;
+
+        /* Job reply variables */
+        char const * nrReply = NULL;
+
+        /* Daemon directory variables */
+        char * nrHome = getcwd( NULL, 0 );
+
+        /* Verify socket path length */
+        if ( strlen( nrSocket ) >= sizeof( nrAddress.sun_path ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Socket path too long\n" ); free( nrHome ); return( EXIT_FAILURE );
+
+        }
+
+        /* Create socket */
+        if ( ( nrServer = socket( AF_UNIX, SOCK_STREAM, 0 ) ) < 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to create daemon socket\n" ); free( nrHome ); return( EXIT_FAILURE );
+
+        }
+
+        /* Compose socket address */
+        memset( & nrAddress, 0, sizeof( nrAddress ) );
+
+        /* Assign socket address */
+        nrAddress.sun_family = AF_UNIX; strcpy( nrAddress.sun_path, nrSocket );
+
+        /* Remove previous socket - only if no daemon answers */
+        if ( nr_daemon_probe( nrSocket ) == LC_FALSE ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Daemon socket path already in use\n" );
+
+            /* Close socket */
+            close( nrServer ); free( nrHome ); return( EXIT_FAILURE );
+
+        }
+
+        /* Restrict socket permissions to owner */
+        nrMask = umask( 0177 );
+
+        /* Bind socket */
+        if ( bind( nrServer, ( struct sockaddr * ) & nrAddress, sizeof( nrAddress ) ) < 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to bind daemon socket\n" );
+
+            /* Close socket */
+            umask( nrMask ); close( nrServer ); free( nrHome ); return( EXIT_FAILURE );
+
+        }
+
+        /* Restore creation mask */
+        umask( nrMask );
+
+        /* Listen socket */
+        if ( listen( nrServer, 16 ) < 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to bind daemon socket\n" );
+
+            /* Close and remove socket */
+            close( nrServer ); unlink( nrSocket ); free( nrHome ); return( EXIT_FAILURE );
+
+        }
+
+        /* Compose signal action */
+        memset( & nrAction, 0, sizeof( nrAction ) );
+
+        /* Assign signal handler - accept interruption */
+        nrAction.sa_handler = & nr_daemon_signal;
+
+        /* Install signal handlers */
+        sigaction( SIGINT , & nrAction, NULL );
+        sigaction( SIGTERM, & nrAction, NULL );
+
+        /* Ignore broken connections */
+        signal( SIGPIPE, SIG_IGN );
+
+        /* Daemon loop */
+        while ( nr_daemon_stop == 0 ) {
+
+            /* Wait for job connection */
+            if ( ( nrClient = accept( nrServer, NULL, NULL ) ) < 0 ) continue;
+
+            /* Reset credentials size */
+            nrLength = sizeof( nrPeer );
+
+            /* Verify peer identity - daemon user only */
+            if ( ( getsockopt( nrClient, SOL_SOCKET, SO_PEERCRED, & nrPeer, & nrLength ) != 0 ) || ( nrPeer.uid != getuid() ) ) {
+
+                /* Close connection */
+                close( nrClient ); continue;
+
+            }
+
+            /* Bound connection transfers - stalled client dropped */
+            setsockopt( nrClient, SOL_SOCKET, SO_RCVTIMEO, & nrTimeout, sizeof( nrTimeout ) );
+            setsockopt( nrClient, SOL_SOCKET, SO_SNDTIMEO, & nrTimeout, sizeof( nrTimeout ) );
+
+            /* Reset job size */
+            nrSize = 0;
+
+            /* Read job content */
+            while ( ( nrRead = read( nrClient, nrJob + nrSize, NR_JOB_SIZE - nrSize ) ) > 0 ) {
+
+                /* Update job size */
+                nrSize += nrRead;
+
+                /* Detect job termination */
+                if ( ( nrSize >= 2 ) && ( nrJob[nrSize - 1] == '\0' ) && ( nrJob[nrSize - 2] == '\0' ) ) break;
+
+                /* Detect job overflow */
+                if ( nrSize == NR_JOB_SIZE ) break;
+
+            }
+
+            /* Verify job termination */
+            if ( ( nrSize < 2 ) || ( nrJob[nrSize - 1] != '\0' ) || ( nrJob[nrSize - 2] != '\0' ) ) {
+
+                /* Assign reply */
+                nrReply = "Error : Invalid job format";
+
+            } else {
+
+                /* Decompose job arguments */
+                for ( nrArgc = 0, nrRead = 0; ( nrJob[nrRead] != '\0' ) && ( nrArgc < NR_JOB_ARGS ); nrRead += strlen( nrJob + nrRead ) + 1 ) {
+
+                    /* Assign argument */
+                    nrArgv[nrArgc ++] = nrJob + nrRead;
+
+                }
+
+                /* Verify job arguments */
+                if ( nrArgc < 2 ) {
+
+                    /* Assign reply */
+                    nrReply = "Error : Invalid job format";
+
+                } else
+                if ( chdir( nrArgv[0] ) != 0 ) {
+
+                    /* Assign reply */
+                    nrReply = "Error : Unable to access job working directory";
+
+                } else {
+
+                    /* Process job */
+                    nrReply = nr_daemon_job( nrDaemon, nrArgc - 1, nrArgv + 1 );
+
+                }
+
+            }
+
+            /* Send job reply */
+            dprintf( nrClient, "%s\n", nrReply == NULL ? NR_JOB_SUCCESS : nrReply );
+
+            /* Close connection */
+            close( nrClient );
+
+        }
+
+        /* Close socket */
+        close( nrServer );
+
+        /* Restore daemon directory */
+        if ( nrHome != NULL ) { if ( chdir( nrHome ) != 0 ) fprintf( LC_ERR, "Error : Unable to restore daemon directory\n" ); free( nrHome ); }
+
+        /* Remove socket */
+        unlink( nrSocket );
+
+        /* Release daemon state */
+        nr_daemon_release( nrDaemon );
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Daemon socket
+ */
+
+    int nr_daemon_path( char * const nrPath ) {
+
+        /* Runtime directory variables */
+        char const * nrRuntime = getenv( "XDG_RUNTIME_DIR" );
+
+        /* User directory variables */
+        char nrFolder[PATH_MAX];
+
+        /* Directory status variables */
+        struct stat nrStat;
+
+        /* Check runtime directory */
+        if ( ( nrRuntime != NULL ) && ( nrRuntime[0] != '\0' ) ) {
+
+            /* Compose socket path */
+            return( snprintf( nrPath, PATH_MAX, "%s/%s", nrRuntime, NR_DFT_SOCKET ) < PATH_MAX ? LC_TRUE : LC_FALSE );
+
+        }
+
+        /* Compose user directory path */
+        snprintf( nrFolder, PATH_MAX, NR_DFT_FOLDER, ( unsigned ) getuid() );
+
+        /* Create user directory - existing directory verified */
+        if ( ( mkdir( nrFolder, 0700 ) != 0 ) && ( errno != EEXIST ) ) return( LC_FALSE );
+
+        /* Verify user directory ownership and permissions */
+        if ( ( lstat( nrFolder, & nrStat ) != 0 ) || ( ! S_ISDIR( nrStat.st_mode ) ) || ( nrStat.st_uid != getuid() ) || ( ( nrStat.st_mode & 0077 ) != 0 ) ) return( LC_FALSE );
+
+        /* Compose socket path */
+        return( snprintf( nrPath, PATH_MAX, "%s/%s", nrFolder, NR_DFT_SOCKET ) < PATH_MAX ? LC_TRUE : LC_FALSE );
+
+    }
+
+    int nr_daemon_probe( char const * const nrSocket ) {
+
+        /* Socket descriptor variables */
+        int nrProbe = -1;
+
+        /* Socket address variables */
+        struct sockaddr_un nrAddress;
+
+        /* Path status variables */
+        struct stat nrStat;
+
+        /* Connection status variables */
+        int nrStatus = 0;
+
+        /* Check path existence */
+        if ( lstat( nrSocket, & nrStat ) != 0 ) return( errno == ENOENT ? LC_TRUE : LC_FALSE );
+
+        /* Check socket - other files kept */
+        if ( ! S_ISSOCK( nrStat.st_mode ) ) return( LC_FALSE );
+
+        /* Compose socket address */
+        memset( & nrAddress, 0, sizeof( nrAddress ) );
+
+        /* Assign socket address */
+        nrAddress.sun_family = AF_UNIX; strcpy( nrAddress.sun_path, nrSocket );
+
+        /* Create probe socket */
+        if ( ( nrProbe = socket( AF_UNIX, SOCK_STREAM, 0 ) ) < 0 ) return( LC_FALSE );
+
+        /* Connect to previous daemon */
+        nrStatus = connect( nrProbe, ( struct sockaddr * ) & nrAddress, sizeof( nrAddress ) ) == 0 ? 0 : errno;
+
+        /* Close probe socket */
+        close( nrProbe );
+
+        /* Remove stale socket - no daemon listening */
+        return( ( nrStatus == ECONNREFUSED ) && ( unlink( nrSocket ) == 0 ) ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Daemon client
+ */
+
+    int nr_daemon_client( char const * const nrSocket, int argc, char ** argv ) {
+
+        /* Socket descriptor variables */
+        int nrClient = -1;
+
+        /* Socket address variables */
+        struct sockaddr_un nrAddress;
+
+        /* Working directory variables */
+        char * nrHome = NULL;
+
+        /* Reply buffer variables */
+        char nrReply[1024] = { 0 };
+
+        /* Reply size variables */
+        ssize_t nrRead = 0;
+        size_t  nrSize = 0;
+
+        /* Sending status variables */
+        int nrSend = LC_TRUE;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Verify job and socket path */
+        if ( ( argc < 1 ) || ( strlen( nrSocket ) >= sizeof( nrAddress.sun_path ) ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Invalid job or socket specification\n" ); return( EXIT_FAILURE );
+
+        }
+
+        /* Retrieve working directory */
+        if ( ( nrHome = getcwd( NULL, 0 ) ) == NULL ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to retrieve working directory\n" ); return( EXIT_FAILURE );
+
+        }
+
+        /* Compose socket address */
+        memset( & nrAddress, 0, sizeof( nrAddress ) );
+
+        /* Assign socket address */
+        nrAddress.sun_family = AF_UNIX; strcpy( nrAddress.sun_path, nrSocket );
+
+        /* Create and connect socket */
+        if ( ( ( nrClient = socket( AF_UNIX, SOCK_STREAM, 0 ) ) < 0 ) || ( connect( nrClient, ( struct sockaddr * ) & nrAddress, sizeof( nrAddress ) ) < 0 ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to connect to daemon\n" );
+
+            /* Close socket */
+            if ( nrClient >= 0 ) close( nrClient );
+
+            /* Release working directory */
+            free( nrHome ); return( EXIT_FAILURE );
+
+        }
+
+        /* Send working directory */
+        nrSend = nr_daemon_send( nrClient, nrHome );
+
+        /* Send job arguments */
+        for ( nrParse = 0; ( nrSend == LC_TRUE ) && ( nrParse < argc ); nrParse ++ ) nrSend = nr_daemon_send( nrClient, argv[nrParse] );
+
+        /* Send job termination */
+        if ( ( nrSend == LC_FALSE ) || ( nr_daemon_send( nrClient, "" ) == LC_FALSE ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to send job to daemon\n" );
+
+            /* Close connection */
+            close( nrClient );
+
+            /* Release working directory */
+            free( nrHome ); return( EXIT_FAILURE );
+
+        }
+
+        /* Receive job reply */
+        while ( ( nrSize < sizeof( nrReply ) - 1 ) && ( ( nrRead = read( nrClient, nrReply + nrSize, sizeof( nrReply ) - 1 - nrSize ) ) > 0 ) ) nrSize += nrRead;
+
+        /* Close connection */
+        close( nrClient );
+
+        /* Release working directory */
+        free( nrHome );
+
+        /* Verify job status */
+        if ( strncmp( nrReply, NR_JOB_SUCCESS, strlen( NR_JOB_SUCCESS ) ) != 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "%s", nrSize > 0 ? nrReply : "Error : No reply from daemon\n" ); return( EXIT_FAILURE );
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Daemon client - string sending
+ */
+
+    int nr_daemon_send( int const nrClient, char const * const nrString ) {
+
+        /* String size variables */
+        size_t nrSize = strlen( nrString ) + 1;
+        size_t nrSent = 0;
+
+        /* Written size variables */
+        ssize_t nrWrite = 0;
+
+        /* Sending loop */
+        while ( nrSent < nrSize ) {
+
+            /* Write remaining string part - broken connection reported without signal */
+            if ( ( nrWrite = send( nrClient, nrString + nrSent, nrSize - nrSent, MSG_NOSIGNAL ) ) <= 0 ) {
+
+                /* Retry interrupted write */
+                if ( ( nrWrite < 0 ) && ( errno == EINTR ) ) continue;
+
+                /* Send failure status */
+                return( LC_FALSE );
+
+            }
+
+            /* Update sent size */
+            nrSent += nrWrite;
+
+        }
+
+        /* Send success status */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Job dispatch
+ */
+
+    char const * nr_daemon_job( nr_Daemon * const nrDaemon, int argc, char ** argv ) {
+
+        /* Job reply variables */
+        char const * nrReply = "Error : Unknown job tool";
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Pin images already cached for the job duration */
+        nrDaemon->dmPin = nrDaemon->dmTick;
+
+        /* Switch on tool name */
+        if ( strcmp( argv[0], "norama-rotate" ) == 0 ) {
+
+            /* Process job */
+            nrReply = nr_daemon_rotate( nrDaemon, argc, argv );
+
+        } else
+        if ( strcmp( argv[0], "norama-direct" ) == 0 ) {
+
+            /* Process job */
+            nrReply = nr_daemon_gnomonic( nrDaemon, argc, argv, LC_FALSE );
+
+        } else
+        if ( strcmp( argv[0], "norama-invert" ) == 0 ) {
+
+            /* Process job */
+            nrReply = nr_daemon_gnomonic( nrDaemon, argc, argv, LC_TRUE );
+
+        } else
+        if ( strcmp( argv[0], "norama-earth" ) == 0 ) {
+
+            /* Process job */
+            nrReply = nr_daemon_earth( nrDaemon, argc, argv );
+
+        }
+
+        /* Release job images not kept by cache */
+        for ( nrParse = 0; nrParse < NR_LOOSE_SLOT; nrParse ++ ) {
+
+            /* Release image memory */
+            if ( nrDaemon->dmLoose[nrParse] != NULL ) lc_imrelease( & nrDaemon->dmLoose[nrParse] );
+
+        }
+
+        /* Return job reply */
+        return( nrReply );
+
+    }
+
+/*
+    Source - Job - norama-rotate
+ */
+
+    char const * nr_daemon_rotate( nr_Daemon * const nrDaemon, int argc, char ** argv ) {
+
+        /* Rotation angles variables */
+        double nrAzim = 0.0;
+        double nrElev = 0.0;
+        double nrRoll = 0.0;
+
+        /* Exportation options variables */
+        int nrOption = -1;
+
+        /* Parallel processing variables */
+        int nrThread = nrDaemon->dmThread;
+
+        /* Interpolation descriptor variables */
+        char * nrMethod = NULL;
+
+        /* Image path variables */
+        char * nriPath = NULL;
+        char * nroPath = NULL;
+
+        /* Image allocation variables */
+        IplImage * nriImage = NULL;
+        IplImage * nroImage = NULL;
+
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nroDesc;
+
+        /* Transformation status variables */
+        int nrStatus = LN_SUCCESS;
+
+        /* Search in parameters */
+        lc_stdp( lc_stda( argc, argv, "--input"        , "-i" ), argv, & nriPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"       , "-o" ), argv, & nroPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--azimuth"      , "-a" ), argv, & nrAzim  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--elevation"    , "-e" ), argv, & nrElev  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--roll"         , "-r" ), argv, & nrRoll  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrThread, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--export"       , "-q" ), argv, & nrOption, LC_INT    );
+
+        /* Verify path strings */
+        if ( ( nriPath == NULL ) || ( nroPath == NULL ) ) return( "Error : Invalid path specification" );
+
+        /* Import input image */
+        if ( ( nriImage = nr_daemon_load( nrDaemon, nriPath, CV_LOAD_IMAGE_UNCHANGED ) ) == NULL ) return( "Error : Unable to read input image" );
+
+        /* Create image allocation */
+        if ( ( nroImage = cvCreateImage( cvSize( nriImage->width, nriImage->height ), IPL_DEPTH_8U , nriImage->nChannels ) ) == NULL ) return( "Error : Unable to create output image" );
+
+        /* Compose image descriptors */
+        nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nriImage->imageData, nriImage->width, nriImage->height, nriImage->nChannels };
+        nroDesc = ( ln_Image_t ) { ( inter_C8_t * ) nroImage->imageData, nroImage->width, nroImage->height, nroImage->nChannels };
+
+        /* Apply equirectangular transform */
+        if ( ( nrStatus = ln_rotate( & nriDesc, & nroDesc, nrAzim * ( LG_PI / 180.0 ), nrElev * ( LG_PI / 180.0 ), nrRoll * ( LG_PI / 180.0 ), lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ), nrThread ) ) != LN_SUCCESS ) {
+
+            /* Release image memory */
+            lc_imrelease( & nroImage );
+
+            /* Send message */
+            return( ln_error( nrStatus ) );
+
+        }
+
+        /* Export output image */
+        if ( lc_imwrite( nroPath, nroImage, nrOption ) == 0 ) {
+
+            /* Release image memory */
+            lc_imrelease( & nroImage );
+
+            /* Send message */
+            return( "Error : Unable to write output image" );
+
+        }
+
+        /* Keep exported image */
+        nr_daemon_adopt( nrDaemon, nroPath, nroImage );
+
+        /* Return status */
+        return( NULL );
+
+    }
+
+/*
+    Source - Job - norama-direct and norama-invert
+ */
+
+    char const * nr_daemon_gnomonic( nr_Daemon * const nrDaemon, int argc, char ** argv, int const nrInvert ) {
+
+        /* Image initialization variables */
+        unsigned char nrRed   = 0;
+        unsigned char nrGreen = 0;
+        unsigned char nrBlue  = 0;
+
+        /* Projection parameters variables */
+        ln_Gnomonic_t nrGnomonic = { -1, 0.0, 0.0, 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+        /* Projection integer variables */
+        int nroWidth  = 0;
+        int nroHeight = 0;
+
+        /* Exportation options variables */
+        int nrOption = -1;
+
+        /* Parallel processing variables */
+        int nrThread = nrDaemon->dmThread;
+
+        /* Projection status variables */
+        int nrStatus = LN_SUCCESS;
+
+        /* Interpolation tag variables */
+        char * nrMethod = NULL;
+
+        /* Image path variables */
+        char * nriPath = NULL;
+        char * nroPath = NULL;
+        char * nriSeed = NULL;
+
+        /* Image allocation variables */
+        IplImage * nriImage = NULL;
+        IplImage * nroImage = NULL;
+
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nroDesc;
+
+        /* Search in parameters */
+        lc_stdp( lc_stda( argc, argv, "--aperture"     , "-u" ), argv, & nrGnomonic.gnApper   , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--sight-x"      , "-x" ), argv, & nrGnomonic.gnSightX  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--sight-y"      , "-y" ), argv, & nrGnomonic.gnSightY  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--azimuth"      , "-a" ), argv, & nrGnomonic.gnAzim    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--heading"      , "-d" ), argv, & nrGnomonic.gnHead    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--elevation"    , "-e" ), argv, & nrGnomonic.gnElev    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--roll"         , "-r" ), argv, & nrGnomonic.gnRoll    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--focal"        , "-f" ), argv, & nrGnomonic.gnFocal   , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--pixel"        , "-p" ), argv, & nrGnomonic.gnPixel   , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--red"          , "-R" ), argv, & nrRed                , LC_UCHAR  );
+        lc_stdp( lc_stda( argc, argv, "--green"        , "-G" ), argv, & nrGreen              , LC_UCHAR  );
+        lc_stdp( lc_stda( argc, argv, "--blue"         , "-B" ), argv, & nrBlue               , LC_UCHAR  );
+        lc_stdp( lc_stda( argc, argv, "--map-width"    , "-W" ), argv, & nrGnomonic.gnmWidth  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--map-height"   , "-H" ), argv, & nrGnomonic.gnmHeight , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--tile-x"       , "-X" ), argv, & nrGnomonic.gnmCornerX, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--tile-y"       , "-Y" ), argv, & nrGnomonic.gnmCornerY, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrThread             , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--export"       , "-q" ), argv, & nrOption             , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--input"        , "-i" ), argv, & nriPath              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"       , "-o" ), argv, & nroPath              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--seed"         , "-s" ), argv, & nriSeed              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod             , LC_STRING );
+
+        /* Search in parameters - tool-specific output dimensions */
+        lc_stdp( lc_stda( argc, argv, nrInvert == LC_TRUE ? "--eqr-width"  : "--rect-width" , "-k" ), argv, & nroWidth , LC_INT );
+        lc_stdp( lc_stda( argc, argv, nrInvert == LC_TRUE ? "--eqr-height" : "--rect-height", "-l" ), argv, & nroHeight, LC_INT );
+
+        /* Select projection model */
+        if ( lc_stda( argc, argv, "--generic" , "-N" ) ) nrGnomonic.gnModel = LN_GENERIC;  else
+        if ( lc_stda( argc, argv, "--elphel"  , "-E" ) ) nrGnomonic.gnModel = LN_ELPHEL;   else
+        if ( lc_stda( argc, argv, "--center"  , "-T" ) ) nrGnomonic.gnModel = LN_CENTER;   else
+        if ( lc_stda( argc, argv, "--complete", "-P" ) ) nrGnomonic.gnModel = LN_COMPLETE;
+
+        /* Convert angles to radian */
+        nrGnomonic.gnApper *= ( LG_PI / 180.0 );
+        nrGnomonic.gnAzim  *= ( LG_PI / 180.0 );
+        nrGnomonic.gnHead  *= ( LG_PI / 180.0 );
+        nrGnomonic.gnElev  *= ( LG_PI / 180.0 );
+        nrGnomonic.gnRoll  *= ( LG_PI / 180.0 );
+
+        /* Verify path strings */
+        if ( ( nriPath == NULL ) || ( nroPath == NULL ) ) return( "Error : Invalid path specification" );
+
+        /* Import input image */
+        if ( ( nriImage = nr_daemon_load( nrDaemon, nriPath, lc_stda( argc, argv, "--force-rgb", "-F" ) ? CV_LOAD_IMAGE_COLOR : CV_LOAD_IMAGE_UNCHANGED ) ) == NULL ) return( "Error : Unable to read input image" );
+
+        /* Check for image seed */
+        if ( nriSeed == NULL ) {
+
+            /* Create image allocation */
+            nroImage = cvCreateImage( cvSize( nroWidth, nroHeight ), IPL_DEPTH_8U , nriImage->nChannels );
+
+        } else {
+
+            /* Duplicate cached image seed */
+            if ( ( nroImage = nr_daemon_load( nrDaemon, nriSeed, CV_LOAD_IMAGE_UNCHANGED ) ) != NULL ) nroImage = cvCloneImage( nroImage );
+
+        }
+
+        /* Verify allocation creation */
+        if ( nroImage == NULL ) return( "Error : Unable to create output image or read output image seed" );
+
+        /* Compose image descriptors */
+        nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nriImage->imageData, nriImage->width, nriImage->height, nriImage->nChannels };
+        nroDesc = ( ln_Image_t ) { ( inter_C8_t * ) nroImage->imageData, nroImage->width, nroImage->height, nroImage->nChannels };
+
+        /* Image initialization swicth */
+        if ( lc_stda( argc, argv, "--clear", "-C" ) ) {
+
+            /* Initialize image background */
+            ln_clear( & nroDesc, nrRed, nrGreen, nrBlue );
+
+        }
+
+        /* Compute gnomonic projection */
+        if ( nrInvert == LC_TRUE ) {
+
+            /* Projection - inverted */
+            nrStatus = ln_invert( & nriDesc, & nroDesc, & nrGnomonic, lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ), nrThread );
+
+        } else {
+
+            /* Projection - direct */
+            nrStatus = ln_direct( & nriDesc, & nroDesc, & nrGnomonic, lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ), nrThread );
+
+        }
+
+        /* Verify projection status */
+        if ( nrStatus != LN_SUCCESS ) {
+
+            /* Release image memory */
+            lc_imrelease( & nroImage );
+
+            /* Send message */
+            return( ln_error( nrStatus ) );
+
+        }
+
+        /* Export output image */
+        if ( lc_imwrite( nroPath, nroImage, nrOption ) == 0 ) {
+
+            /* Release image memory */
+            lc_imrelease( & nroImage );
+
+            /* Send message */
+            return( "Error : Unable to write output image" );
+
+        }
+
+        /* Keep exported image */
+        nr_daemon_adopt( nrDaemon, nroPath, nroImage );
+
+        /* Return status */
+        return( NULL );
+
+    }
+
+/*
+    Source - Job - norama-earth
+ */
+
+    char const * nr_daemon_earth( nr_Daemon * const nrDaemon, int argc, char ** argv ) {
+
+        /* Exportation options variables */
+        int nrOption = -1;
+
+        /* Parallel processing variables */
+        int nrThread = nrDaemon->dmThread;
+
+        /* Interpolation descriptor variables */
+        char * nrMethod = NULL;
+
+        /* Image path variables */
+        char * nriPath = NULL;
+        char * nroPath = NULL;
+        char * nrcPath = NULL;
+
+        /* CSPS switch variables */
+        char * nrcTag = NULL;
+        char * nrcMod = NULL;
+        char * nroTag = NULL;
+        char * nroMod = NULL;
+
+        /* Timestamp variables */
+        lp_Time_t nrtSec = lp_Time_s( 0 );
+        lp_Time_t nrtUse = lp_Time_s( 0 );
+
+        /* Image allocation variables */
+        IplImage * nriImage = NULL;
+        IplImage * nroImage = NULL;
+
+        /* Rotation matrix variables */
+        lp_Real_t nrMatrix[3][3] = { { 0.0 } };
+
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nroDesc;
+
+        /* Transformation status variables */
+        int nrStatus = LN_SUCCESS;
+
+        /* Search in parameters */
+        lc_stdp( lc_stda( argc, argv, "--input"        , "-a" ), argv, & nriPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"       , "-b" ), argv, & nroPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--path"         , "-p" ), argv, & nrcPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--cam-tag"      , "-c" ), argv, & nrcTag  , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--cam-mod"      , "-m" ), argv, & nrcMod  , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--imu-tag"      , "-i" ), argv, & nroTag  , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--imu-mod"      , "-s" ), argv, & nroMod  , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--second"       , "-u" ), argv, & nrtSec  , LC_ULLONG );
+        lc_stdp( lc_stda( argc, argv, "--micro-second" , "-v" ), argv, & nrtUse  , LC_ULLONG );
+        lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrThread, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--export"       , "-q" ), argv, & nrOption, LC_INT    );
+
+        /* Verify path strings */
+        if ( ( nriPath == NULL ) || ( nroPath == NULL ) || ( nrcPath == NULL ) ) return( "Error : Invalid path specification" );
+
+        /* Query rotation matrix */
+        if ( ( nrStatus = nr_daemon_matrix( nrDaemon, nrcPath, nrcTag, nrcMod, nroTag, nroMod, nrtSec, nrtUse, nrMatrix ) ) != LN_SUCCESS ) return( ln_error( nrStatus ) );
+
+        /* Import input image */
+        if ( ( nriImage = nr_daemon_load( nrDaemon, nriPath, CV_LOAD_IMAGE_UNCHANGED ) ) == NULL ) return( "Error : Unable to read input image" );
+
+        /* Create image allocation */
+        if ( ( nroImage = cvCreateImage( cvSize( nriImage->width, nriImage->height ), IPL_DEPTH_8U , nriImage->nChannels ) ) == NULL ) return( "Error : Unable to create output image" );
+
+        /* Compose image descriptors */
+        nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nriImage->imageData, nriImage->width, nriImage->height, nriImage->nChannels };
+        nroDesc = ( ln_Image_t ) { ( inter_C8_t * ) nroImage->imageData, nroImage->width, nroImage->height, nroImage->nChannels };
+
+        /* Apply equirectangular transformation */
+        if ( ( nrStatus = ln_earth( & nriDesc, & nroDesc, nrMatrix, lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ), nrThread ) ) != LN_SUCCESS ) {
+
+            /* Release image memory */
+            lc_imrelease( & nroImage );
+
+            /* Send message */
+            return( ln_error( nrStatus ) );
+
+        }
+
+        /* Export output image */
+        if ( lc_imwrite( nroPath, nroImage, nrOption ) == 0 ) {
+
+            /* Release image memory */
+            lc_imrelease( & nroImage );
+
+            /* Send message */
+            return( "Error : Unable to write output image" );
+
+        }
+
+        /* Keep exported image */
+        nr_daemon_adopt( nrDaemon, nroPath, nroImage );
+
+        /* Return status */
+        return( NULL );
+
+    }
+
+/*
+    Source - Cache - image loading
+ */
+
+    IplImage * nr_daemon_load( nr_Daemon * const nrDaemon, char const * const nrPath, int const nrFlag ) {
+
+        /* File status variables */
+        struct stat nrStat;
+
+        /* Image allocation variables */
+        IplImage * nrImage = NULL;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Retrieve file status */
+        if ( stat( nrPath, & nrStat ) != 0 ) return( NULL );
+
+        /* Search cache slots */
+        for ( nrParse = 0; nrParse < NR_CACHE_SLOT; nrParse ++ ) {
+
+            /* Cache slot pointer variables */
+            nr_Cache * nrSlot = nrDaemon->dmCache + nrParse;
+
+            /* Check slot file identity */
+            if ( ( nrSlot->chImage == NULL ) || ( nrSlot->chDevice != nrStat.st_dev ) || ( nrSlot->chInode != nrStat.st_ino ) || ( nrSlot->chFlag != nrFlag ) ) continue;
+
+            /* Check slot file modification */
+            if ( ( nrSlot->chTime == nrStat.st_mtim.tv_sec ) && ( nrSlot->chNano == nrStat.st_mtim.tv_nsec ) && ( nrSlot->chSize == nrStat.st_size ) ) {
+
+                /* Update slot usage */
+                nrSlot->chUsed = ++ nrDaemon->dmTick;
+
+                /* Return cached image */
+                return( nrSlot->chImage );
+
+            } else
+            if ( nrSlot->chUsed <= nrDaemon->dmPin ) {
+
+                /* Release outdated slot */
+                lc_imrelease( & nrSlot->chImage );
+
+            }
+
+        }
+
+        /* Import image */
+        if ( ( nrImage = lc_imread( nrPath, nrFlag ) ) == NULL ) return( NULL );
+
+        /* Store image in cache */
+        if ( nr_daemon_store( nrDaemon, & nrStat, nrFlag, nrImage ) == LC_TRUE ) return( nrImage );
+
+        /* Search free job image slot */
+        for ( nrParse = 0; ( nrParse < NR_LOOSE_SLOT ) && ( nrDaemon->dmLoose[nrParse] != NULL ); nrParse ++ );
+
+        /* Check job image slot availability */
+        if ( nrParse == NR_LOOSE_SLOT ) {
+
+            /* Release image memory */
+            lc_imrelease( & nrImage );
+
+            /* Send message */
+            return( NULL );
+
+        }
+
+        /* Keep image for job duration */
+        nrDaemon->dmLoose[nrParse] = nrImage;
+
+        /* Return decoded image */
+        return( nrImage );
+
+    }
+
+/*
+    Source - Cache - image adoption
+ */
+
+    void nr_daemon_adopt( nr_Daemon * const nrDaemon, char const * const nrPath, IplImage * nrImage ) {
+
+        /* Lossless formats variables */
+        static char const * const nrLossless[] = { "png", "tif", "tiff", "bmp", "ppm", "pgm", "pbm", NULL };
+
+        /* Extension pointer variables */
+        char const * nrExt = strrchr( nrPath, '.' );
+
+        /* File status variables */
+        struct stat nrStat;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Search lossless extension */
+        while ( ( nrExt != NULL ) && ( nrLossless[nrParse] != NULL ) && ( strcasecmp( nrExt + 1, nrLossless[nrParse] ) != 0 ) ) nrParse ++;
+
+        /* Check exported image format and file status */
+        if ( ( nrExt != NULL ) && ( nrLossless[nrParse] != NULL ) && ( stat( nrPath, & nrStat ) == 0 ) ) {
+
+            /* Store image in cache - released if no slot is available */
+            if ( nr_daemon_store( nrDaemon, & nrStat, CV_LOAD_IMAGE_UNCHANGED, nrImage ) == LC_FALSE ) lc_imrelease( & nrImage );
+
+        } else {
+
+            /* Release image memory */
+            lc_imrelease( & nrImage );
+
+        }
+
+    }
+
+/*
+    Source - Cache - slot insertion
+ */
+
+    int nr_daemon_store( nr_Daemon * const nrDaemon, struct stat const * const nrStat, int const nrFlag, IplImage * nrImage ) {
+
+        /* Cache occupation variables */
+        size_t nrSize = nrImage->imageSize;
+
+        /* Slot index variables */
+        int nrEmpty = -1;
+        int nrOlder = -1;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Compute occupation of slots pinned by current job */
+        for ( nrParse = 0; nrParse < NR_CACHE_SLOT; nrParse ++ ) {
+
+            /* Update occupation */
+            if ( ( nrDaemon->dmCache[nrParse].chImage != NULL ) && ( nrDaemon->dmCache[nrParse].chUsed > nrDaemon->dmPin ) ) nrSize += nrDaemon->dmCache[nrParse].chImage->imageSize;
+
+        }
+
+        /* Check that eviction can make room - image kept by caller */
+        if ( nrSize > nrDaemon->dmBudget ) return( LC_FALSE );
+
+        /* Eviction loop */
+        do {
+
+            /* Reset occupation and indexes */
+            nrSize  = nrImage->imageSize;
+            nrEmpty = -1;
+            nrOlder = -1;
+
+            /* Parse cache slots */
+            for ( nrParse = 0; nrParse < NR_CACHE_SLOT; nrParse ++ ) {
+
+                /* Check slot state */
+                if ( nrDaemon->dmCache[nrParse].chImage == NULL ) {
+
+                    /* Memorize empty slot */
+                    if ( nrEmpty < 0 ) nrEmpty = nrParse;
+
+                } else {
+
+                    /* Update occupation */
+                    nrSize += nrDaemon->dmCache[nrParse].chImage->imageSize;
+
+                    /* Search least recently used slot not pinned by current job */
+                    if ( ( nrDaemon->dmCache[nrParse].chUsed <= nrDaemon->dmPin ) && ( ( nrOlder < 0 ) || ( nrDaemon->dmCache[nrParse].chUsed < nrDaemon->dmCache[nrOlder].chUsed ) ) ) nrOlder = nrParse;
+
+                }
+
+            }
+
+            /* Check eviction necessity */
+            if ( ( nrOlder >= 0 ) && ( ( nrSize > nrDaemon->dmBudget ) || ( nrEmpty < 0 ) ) ) {
+
+                /* Evict least recently used slot */
+                lc_imrelease( & nrDaemon->dmCache[nrOlder].chImage );
+
+            } else {
+
+                /* Stop eviction */
+                nrOlder = -1;
+
+            }
+
+        } while ( nrOlder >= 0 );
+
+        /* Check slot availability and cache size - image kept by caller */
+        if ( ( nrEmpty < 0 ) || ( nrSize > nrDaemon->dmBudget ) ) return( LC_FALSE );
+
+        /* Assign slot */
+        nrDaemon->dmCache[nrEmpty].chDevice = nrStat->st_dev;
+        nrDaemon->dmCache[nrEmpty].chInode  = nrStat->st_ino;
+        nrDaemon->dmCache[nrEmpty].chTime   = nrStat->st_mtim.tv_sec;
+        nrDaemon->dmCache[nrEmpty].chNano   = nrStat->st_mtim.tv_nsec;
+        nrDaemon->dmCache[nrEmpty].chSize   = nrStat->st_size;
+        nrDaemon->dmCache[nrEmpty].chFlag   = nrFlag;
+        nrDaemon->dmCache[nrEmpty].chUsed   = ++ nrDaemon->dmTick;
+        nrDaemon->dmCache[nrEmpty].chImage  = nrImage;
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Cache - release
+ */
+
+    void nr_daemon_release( nr_Daemon * const nrDaemon ) {
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Release cached images */
+        for ( nrParse = 0; nrParse < NR_CACHE_SLOT; nrParse ++ ) {
+
+            /* Release image memory */
+            if ( nrDaemon->dmCache[nrParse].chImage != NULL ) lc_imrelease( & nrDaemon->dmCache[nrParse].chImage );
+
+        }
+
+        /* Release job images */
+        for ( nrParse = 0; nrParse < NR_LOOSE_SLOT; nrParse ++ ) {
+
+            /* Release image memory */
+            if ( nrDaemon->dmLoose[nrParse] != NULL ) lc_imrelease( & nrDaemon->dmLoose[nrParse] );
+
+        }
+
+        /* Release query handles */
+        nr_daemon_release_query( & nrDaemon->dmQuery );
+
+    }
+
+/*
+    Source - Cache - CSPS query handles release
+ */
+
+    void nr_daemon_release_query( nr_Query * const nrQuery ) {
+
+        /* Release query handles */
+        ln_query_delete( & nrQuery->qrHandle );
+
+        /* Release query key */
+        free( nrQuery->qrKey ); nrQuery->qrKey = NULL;
+
+    }
+
+/*
+    Source - CSPS interface methods
+ */
+
+    int nr_daemon_matrix( 
+
+        nr_Daemon       * const nrDaemon,
+        lp_Char_t const * const nrPath, 
+        lp_Char_t const * const nrCamTag, 
+        lp_Char_t const * const nrCamMod, 
+        lp_Char_t const * const nrIMUTag, 
+        lp_Char_t const * const nrIMUMod, 
+        lp_Time_t const         nrSecond,
+        lp_Time_t const         nrMicro,
+        lp_Real_t               nrMatrix[3][3]
+
+    ) {
+
+        /* Query handles pointer variables */
+        nr_Query * nrQuery = & nrDaemon->dmQuery;
+
+        /* Query key variables */
+        char * nrKey = NULL;
+
+        /* Returned value variables */
+        int nrReturn = LN_SUCCESS;
+
+        /* Verify switches */
+        if ( ( nrCamTag == NULL ) || ( nrCamMod == NULL ) || ( nrIMUTag == NULL ) || ( nrIMUMod == NULL ) ) return( LN_ERROR_SWITCH );
+
+        /* Allocate query key */
+        if ( ( nrKey = malloc( strlen( nrPath ) + strlen( nrCamTag ) + strlen( nrCamMod ) + strlen( nrIMUTag ) + strlen( nrIMUMod ) + 5 ) ) == NULL ) return( LN_ERROR_SWITCH );
+
+        /* Compose query key */
+        sprintf( nrKey, "%s\n%s\n%s\n%s\n%s", nrPath, nrCamTag, nrCamMod, nrIMUTag, nrIMUMod );
+
+        /* Check opened handles */
+        if ( ( nrQuery->qrHandle.qrState == LN_FALSE ) || ( strcmp( nrQuery->qrKey, nrKey ) != 0 ) ) {
+
+            /* Release previous handles */
+            nr_daemon_release_query( nrQuery );
+
+            /* Assign query key */
+            nrQuery->qrKey = nrKey;
+
+            /* Create query handles */
+            if ( ( nrReturn = ln_query_create( & nrQuery->qrHandle, nrPath, nrCamTag, nrCamMod, nrIMUTag, nrIMUMod ) ) != LN_SUCCESS ) return( nrReturn );
+
+        } else {
+
+            /* Release query key */
+            free( nrKey );
+
+        }
+
+        /* Query orientation */
+        return( ln_query_matrix( & nrQuery->qrHandle, nrSecond, nrMicro, nrMatrix ) );
+
+    }
+
@@ -0,0 +1,547 @@
+/*
+ * norama suite - Panorama tools suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama-daemon.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Software main header
+     */
+
+    /*! \mainpage norama-daemon
+     *
+     *  \section norama-suite
+     *  \section _ Panorama tools suite
+     *
+     *  This software suite offers tools for numerical panoramas manipulation.
+     *  Mostly designed for equirectangular mappings, its role is to provide an 
+     *  interface to libgnomonic and its algorithms. It then offers an interface
+     *  to projection and transformation features implemented in the gnomonic 
+     *  library. The norama-suite is also interfaced with libcsps in order to 
+     *  take advantage of camera motion tracking to operate and align panoramas
+     *  on earth. It also comes with a panorama viewer to complete the suite. 
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/norama-suite/wiki
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __NR_DAEMON__
+    # define __NR_DAEMON__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # ifndef _GNU_SOURCE
+    # define _GNU_SOURCE
+    # endif
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <errno.h>
+    # include <limits.h>
+    # include <signal.h>
+    # include <unistd.h>
+    # include <sys/stat.h>
+    # include <sys/time.h>
+    # include <sys/types.h>
+    # include <sys/socket.h>
+    # include <sys/un.h>
+    # include <opencv/cv.h>
+    # include <opencv/highgui.h>
+    # include <gnomonic-all.h>
+    # include <csps-all.h>
+    # include <common-all.h>
+    # include <norama-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Standard help */
+    # define NR_HELP "Usage summary :\n\n"                             \
+    "\tnorama-daemon [Arguments] [Parameters] ...\n"                   \
+    "\tnorama-daemon [Parameters] -- norama-[tool] [Arguments] ...\n\n" \
+    "Short arguments and parameters summary :\n\n"                     \
+    "\t-S\tDaemon UNIX socket path\n"                                  \
+    "\t-c\tDecoded images cache size, in megabytes, 0 to disable\n"    \
+    "\t-t\tNumber of threads used when not specified by job\n\n"       \
+    "Job tools summary :\n\n"                                          \
+    "\tnorama-rotate, norama-direct, norama-invert, norama-earth\n\n"  \
+    "norama-daemon - norama-suite\n"                                   \
+    "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
+
+    /* Define default values */
+    # define NR_DFT_SOCKET  "norama-daemon.sock"
+    # define NR_DFT_FOLDER  "/tmp/norama-daemon-%u"
+    # define NR_DFT_CACHE   2048
+    # define NR_DFT_THREAD  1
+
+    /* Define job constraints */
+    # define NR_JOB_SIZE    65536
+    # define NR_JOB_ARGS    256
+    # define NR_JOB_TIMEOUT 5
+
+    /* Define cache constraints */
+    # define NR_CACHE_SLOT  64
+
+    /* Define job uncached images count */
+    # define NR_LOOSE_SLOT  2
+
+    /* Define job replies */
+    # define NR_JOB_SUCCESS "Success"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct nr_Cache_struct
+     *  \brief Decoded image cache slot
+     *
+     *  This structure holds a decoded image kept in memory between two jobs.
+     *  The image is identified by its file identity and modification time, so
+     *  that any modification of the file on disk invalidates the slot.
+     *
+     *  \var nr_Cache_struct::chDevice
+     *  Device of the image file
+     *  \var nr_Cache_struct::chInode
+     *  Inode of the image file
+     *  \var nr_Cache_struct::chTime
+     *  Modification time of the image file, in seconds
+     *  \var nr_Cache_struct::chNano
+     *  Modification time of the image file, nano-seconds part
+     *  \var nr_Cache_struct::chSize
+     *  Size of the image file, in bytes
+     *  \var nr_Cache_struct::chFlag
+     *  Loading flag used to decode the image
+     *  \var nr_Cache_struct::chUsed
+     *  Last usage tick, used for least recently used eviction
+     *  \var nr_Cache_struct::chImage
+     *  Decoded image, NULL for empty slot
+     */
+
+    typedef struct nr_Cache_struct {
+
+        dev_t      chDevice;
+        ino_t      chInode;
+        time_t     chTime;
+        long       chNano;
+        off_t      chSize;
+        int        chFlag;
+        long       chUsed;
+        IplImage * chImage;
+
+    } nr_Cache;
+
+    /*! \struct nr_Query_struct
+     *  \brief CSPS query handles
+     *
+     *  This structure keeps the CSPS query handles opened on trigger and
+     *  orientation streams so that successive earth jobs performed on the same
+     *  CSPS structure do not have to parse the streams again.
+     *
+     *  \var nr_Query_struct::qrKey
+     *  Concatenation of CSPS path, tags and modules identifying the handles
+     *  \var nr_Query_struct::qrHandle
+     *  Query handles on trigger and orientation streams
+     */
+
+    typedef struct nr_Query_struct {
+
+        char *     qrKey;
+        ln_Query_t qrHandle;
+
+    } nr_Query;
+
+    /*! \struct nr_Daemon_struct
+     *  \brief Daemon warm state
+     *
+     *  This structure gathers the state kept by the daemon between two jobs.
+     *  The worker threads are kept alive by the OpenMP runtime of the process
+     *  and are then not stored here.
+     *
+     *  \var nr_Daemon_struct::dmThread
+     *  Number of threads used when not specified by job
+     *  \var nr_Daemon_struct::dmBudget
+     *  Decoded images cache size, in bytes
+     *  \var nr_Daemon_struct::dmTick
+     *  Cache usage counter
+     *  \var nr_Daemon_struct::dmPin
+     *  Cache usage counter value at job start - slots used since are pinned
+     *  \var nr_Daemon_struct::dmCache
+     *  Decoded images cache slots
+     *  \var nr_Daemon_struct::dmLoose
+     *  Images decoded by current job that the cache could not keep
+     *  \var nr_Daemon_struct::dmQuery
+     *  CSPS query handles
+     */
+
+    typedef struct nr_Daemon_struct {
+
+        int      dmThread;
+        size_t   dmBudget;
+        long     dmTick;
+        long     dmPin;
+        nr_Cache   dmCache[NR_CACHE_SLOT];
+        IplImage * dmLoose[NR_LOOSE_SLOT];
+        nr_Query   dmQuery;
+
+    } nr_Daemon;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Software main function
+     *  
+     *  The main function reads the daemon parameters and starts the daemon on
+     *  the specified socket. If a double-dash separator is found in arguments,
+     *  the software acts as a client : the arguments following the separator
+     *  are sent as a job to the daemon and the reply is displayed.
+     *  
+     *  \param argc Standard main parameter
+     *  \param argv Standard main parameter
+     */
+
+    int main ( int argc, char ** argv );
+
+    /*! \brief Daemon server
+     *
+     *  This function creates the UNIX socket and enters the daemon loop. Each
+     *  connection carries a single job made of the client working directory,
+     *  the tool name and the tool arguments, each terminated by a null
+     *  character, the job being terminated by an empty string. The job is
+     *  executed and a single line reply is sent back before the connection is
+     *  closed. The loop ends on interruption or termination signal.
+     *
+     *  The socket is created with owner only permissions and connections of
+     *  other users are refused by checking the peer credentials. A previous
+     *  socket is only removed if no daemon answers on it anymore. Reading a
+     *  job and sending its reply are bounded by a timeout, so that a stalled
+     *  client cannot hold the daemon.
+     *
+     *  \param nrSocket Daemon UNIX socket path
+     *  \param nrDaemon Daemon warm state structure
+     *
+     *  \return Returns EXIT_SUCCESS or EXIT_FAILURE
+     */
+
+    int nr_daemon_server ( char const * const nrSocket, nr_Daemon * const nrDaemon );
+
+    /*! \brief Daemon client
+     *
+     *  This function sends the provided arguments as a job to the daemon and
+     *  displays the reply. The current working directory is sent along the job
+     *  so that relative paths are resolved as for a direct tool invocation.
+     *
+     *  \param nrSocket Daemon UNIX socket path
+     *  \param argc     Number of job arguments
+     *  \param argv     Job arguments, starting with the tool name
+     *
+     *  \return Returns EXIT_SUCCESS if the job succeed, EXIT_FAILURE otherwise
+     */
+
+    int nr_daemon_client ( char const * const nrSocket, int argc, char ** argv );
+
+    /*! \brief Daemon client - string sending
+     *
+     *  This function sends the provided string, including its terminating
+     *  null character, on the connection to the daemon. Partial writes are
+     *  continued until the whole string is sent.
+     *
+     *  \param nrClient Connected socket descriptor
+     *  \param nrString String to send
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_daemon_send ( int const nrClient, char const * const nrString );
+
+    /*! \brief Daemon default socket path
+     *
+     *  This function composes the default socket path in the user runtime
+     *  directory given by XDG_RUNTIME_DIR. Without runtime directory, a per
+     *  user directory is created in /tmp with owner only permissions, the
+     *  function failing if an existing directory is not owned by the user or
+     *  accessible by others.
+     *
+     *  \param nrPath Returned socket path, of PATH_MAX bytes
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_daemon_path ( char * const nrPath );
+
+    /*! \brief Daemon previous socket removal
+     *
+     *  This function checks if a socket remains at the provided path and
+     *  removes it if no daemon accepts connections on it anymore, the path
+     *  being left untouched if it is not a socket.
+     *
+     *  \param nrSocket Daemon UNIX socket path
+     *
+     *  \return Returns LC_TRUE if the path is free, LC_FALSE otherwise
+     */
+
+    int nr_daemon_probe ( char const * const nrSocket );
+
+    /*! \brief Job dispatch
+     *
+     *  This function calls the job function corresponding to the tool name
+     *  found in the first job argument. The images decoded by the job that
+     *  the cache could not keep are released once the job is done.
+     *
+     *  \param nrDaemon Daemon warm state structure
+     *  \param argc     Number of job arguments
+     *  \param argv     Job arguments, starting with the tool name
+     *
+     *  \return Returns NULL on success, an error message otherwise
+     */
+
+    char const * nr_daemon_job ( nr_Daemon * const nrDaemon, int argc, char ** argv );
+
+    /*! \brief Job - norama-rotate
+     *
+     *  This function performs the norama-rotate operation using the provided
+     *  arguments and parameters.
+     *
+     *  \param nrDaemon Daemon warm state structure
+     *  \param argc     Number of job arguments
+     *  \param argv     Job arguments
+     *
+     *  \return Returns NULL on success, an error message otherwise
+     */
+
+    char const * nr_daemon_rotate ( nr_Daemon * const nrDaemon, int argc, char ** argv );
+
+    /*! \brief Job - norama-direct and norama-invert
+     *
+     *  This function performs the norama-direct or norama-invert operation
+     *  using the provided arguments and parameters. The two tools share the
+     *  same arguments and only differ by the direction of the projection.
+     *
+     *  \param nrDaemon Daemon warm state structure
+     *  \param argc     Number of job arguments
+     *  \param argv     Job arguments
+     *  \param nrInvert LC_TRUE for norama-invert, LC_FALSE for norama-direct
+     *
+     *  \return Returns NULL on success, an error message otherwise
+     */
+
+    char const * nr_daemon_gnomonic ( nr_Daemon * const nrDaemon, int argc, char ** argv, int const nrInvert );
+
+    /*! \brief Job - norama-earth
+     *
+     *  This function performs the norama-earth operation using the provided
+     *  arguments and parameters. The CSPS query handles are kept opened in
+     *  the daemon state for the following jobs.
+     *
+     *  \param nrDaemon Daemon warm state structure
+     *  \param argc     Number of job arguments
+     *  \param argv     Job arguments
+     *
+     *  \return Returns NULL on success, an error message otherwise
+     */
+
+    char const * nr_daemon_earth ( nr_Daemon * const nrDaemon, int argc, char ** argv );
+
+    /*! \brief Cache - image loading
+     *
+     *  This function returns the decoded image corresponding to the provided
+     *  path. If the file identity and modification time match a cache slot,
+     *  the cached image is returned. Otherwise, the image is decoded and
+     *  stored in the cache, evicting the least recently used images if the
+     *  cache size is exceeded.
+     *
+     *  The returned image belongs to the cache and has to be considered as
+     *  read-only by the caller. When all the cache slots are pinned by the
+     *  current job, the decoded image is kept aside by the daemon state and
+     *  released at the end of the job.
+     *
+     *  \param nrDaemon Daemon warm state structure
+     *  \param nrPath   Path of the image file
+     *  \param nrFlag   OpenCV image loading flag
+     *
+     *  \return Returns pointer to the cached image, NULL on failure
+     */
+
+    IplImage * nr_daemon_load ( nr_Daemon * const nrDaemon, char const * const nrPath, int const nrFlag );
+
+    /*! \brief Cache - image adoption
+     *
+     *  This function stores an image that has just been exported by a job in
+     *  the cache using the identity of the written file. The cache takes the
+     *  ownership of the image. This allows a following job to use the exported
+     *  image as input or seed without decoding it. Images exported in a lossy
+     *  format are not adopted, as their decoded content differs from the image
+     *  in memory, and are released.
+     *
+     *  \param nrDaemon Daemon warm state structure
+     *  \param nrPath   Path of the exported image file
+     *  \param nrImage  Exported image
+     */
+
+    void nr_daemon_adopt ( nr_Daemon * const nrDaemon, char const * const nrPath, IplImage * nrImage );
+
+    /*! \brief Cache - slot insertion
+     *
+     *  This function stores the provided image in a cache slot, evicting the
+     *  least recently used images until the cache size is respected. The
+     *  image is refused when it cannot fit in the cache size, even after the
+     *  eviction of all the slots not pinned by the current job, so that a
+     *  null cache size disables the cache. The cache takes the ownership of
+     *  the image only when it is stored, the image remaining the caller's
+     *  otherwise.
+     *
+     *  \param nrDaemon Daemon warm state structure
+     *  \param nrStat   File status of the image
+     *  \param nrFlag   OpenCV image loading flag
+     *  \param nrImage  Image to store in the cache
+     *
+     *  \return Returns LC_TRUE if the image is stored, LC_FALSE otherwise
+     */
+
+    int nr_daemon_store ( nr_Daemon * const nrDaemon, struct stat const * const nrStat, int const nrFlag, IplImage * nrImage );
+
+    /*! \brief Cache - release
+     *
+     *  This function releases all the images and the CSPS query handles kept
+     *  in the daemon state.
+     *
+     *  \param nrDaemon Daemon warm state structure
+     */
+
+    void nr_daemon_release ( nr_Daemon * const nrDaemon );
+
+    /*! \brief Cache - CSPS query handles release
+     *
+     *  This function releases the CSPS query handles and the query key kept
+     *  in the daemon state.
+     *
+     *  \param nrQuery CSPS query handles structure
+     */
+
+    void nr_daemon_release_query ( nr_Query * const nrQuery );
+
+    /*! \brief CSPS interface methods
+     *
+     *  This function performs the same query as norama-earth but keeps the
+     *  CSPS query structures opened in the daemon state. The structures are
+     *  only re-created when the CSPS path, tags or modules differ from the
+     *  ones of the previous query.
+     *
+     *  \param  nrDaemon Daemon warm state structure
+     *  \param  nrPath   Path to CSPS directory structure
+     *  \param  nrCamTag Trigger device CSPS-tag
+     *  \param  nrCamMod Trigger module CSPS-name
+     *  \param  nrIMUTag Orientation device CSPS-tag
+     *  \param  nrIMUMod Orientation device CSPS-module
+     *  \param  nrSecond Orientation query timestamp seconds
+     *  \param  nrMicro  Orientation query timestamp micro-seconds
+     *  \param  nrMatrix Returned rotation matrix
+     *
+     *  \return Returns LN_SUCCESS or an error code
+     */
+
+    int nr_daemon_matrix( 
+
+        nr_Daemon       * const nrDaemon,
+        lp_Char_t const * const nrPath, 
+        lp_Char_t const * const nrCamTag, 
+        lp_Char_t const * const nrCamMod, 
+        lp_Char_t const * const nrIMUTag, 
+        lp_Char_t const * const nrIMUMod, 
+        lp_Time_t const         nrSecond,
+        lp_Time_t const         nrMicro,
+        lp_Real_t               nrMatrix[3][3]
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
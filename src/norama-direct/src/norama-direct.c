@@ -54,24 +54,12 @@
         unsigned char nrGreen = 0;
         unsigned char nrBlue = 0;
 
-        /* Projection float variables */
-        double nrApper  = 0.0;
-        double nrSightX = 0.0;
-        double nrSightY = 0.0;
-        double nrAzim   = 0.0;
-        double nrHead   = 0.0;
-        double nrElev   = 0.0;
-        double nrRoll   = 0.0;
-        double nrFocal  = 0.0;
-        double nrPixel  = 0.0;
+        /* Projection parameters variables */
+        ln_Gnomonic_t nrGnomonic = { -1, 0.0, 0.0, 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
 
         /* Projection integer variables */
         int nrrWidth   = 0;
         int nrrHeight  = 0;
-        int nrmWidth   = 0;
-        int nrmHeight  = 0;
-        int nrmCornerX = 0;
-        int nrmCornerY = 0;
 
         /* Exportation options variables */
         int nrOption = -1;
@@ -79,9 +67,15 @@
         /* Parallel processing variables */
         int nrThread = 1;
 
+        /* Projection status variables */
+        int nrStatus = LN_SUCCESS;
+
         /* Interpolation tag variables */
         char * nrMethod = NULL;
 
+        /* Cube map layout variables */
+        char * nrLayout = NULL;
+
         /* Image path variables */
         char * nriPath = NULL;
         char * nroPath = NULL;
@@ -91,31 +85,49 @@
         IplImage * nriImage = NULL;
         IplImage * nroImage = NULL;
 
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nroDesc;
+
         /* Search in parameters */
-        lc_stdp( lc_stda( argc, argv, "--aperture"     , "-u" ), argv, & nrApper   , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--sight-x"      , "-x" ), argv, & nrSightX  , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--sight-y"      , "-y" ), argv, & nrSightY  , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--azimuth"      , "-a" ), argv, & nrAzim    , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--heading"      , "-d" ), argv, & nrHead    , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--elevation"    , "-e" ), argv, & nrElev    , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--roll"         , "-r" ), argv, & nrRoll    , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--focal"        , "-f" ), argv, & nrFocal   , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--pixel"        , "-p" ), argv, & nrPixel   , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--red"          , "-R" ), argv, & nrRed     , LC_UCHAR  );
-        lc_stdp( lc_stda( argc, argv, "--green"        , "-G" ), argv, & nrGreen   , LC_UCHAR  );
-        lc_stdp( lc_stda( argc, argv, "--blue"         , "-B" ), argv, & nrBlue    , LC_UCHAR  );
-        lc_stdp( lc_stda( argc, argv, "--rect-width"   , "-k" ), argv, & nrrWidth  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--rect-height"  , "-l" ), argv, & nrrHeight , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--map-width"    , "-W" ), argv, & nrmWidth  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--map-height"   , "-H" ), argv, & nrmHeight , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--tile-x"       , "-X" ), argv, & nrmCornerX, LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--tile-y"       , "-Y" ), argv, & nrmCornerY, LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrThread  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--export"       , "-q" ), argv, & nrOption  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--input"        , "-i" ), argv, & nriPath   , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--output"       , "-o" ), argv, & nroPath   , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--seed"         , "-s" ), argv, & nriSeed   , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod  , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--aperture"     , "-u" ), argv, & nrGnomonic.gnApper   , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--sight-x"      , "-x" ), argv, & nrGnomonic.gnSightX  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--sight-y"      , "-y" ), argv, & nrGnomonic.gnSightY  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--azimuth"      , "-a" ), argv, & nrGnomonic.gnAzim    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--heading"      , "-d" ), argv, & nrGnomonic.gnHead    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--elevation"    , "-e" ), argv, & nrGnomonic.gnElev    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--roll"         , "-r" ), argv, & nrGnomonic.gnRoll    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--focal"        , "-f" ), argv, & nrGnomonic.gnFocal   , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--pixel"        , "-p" ), argv, & nrGnomonic.gnPixel   , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--red"          , "-R" ), argv, & nrRed                , LC_UCHAR  );
+        lc_stdp( lc_stda( argc, argv, "--green"        , "-G" ), argv, & nrGreen              , LC_UCHAR  );
+        lc_stdp( lc_stda( argc, argv, "--blue"         , "-B" ), argv, & nrBlue               , LC_UCHAR  );
+        lc_stdp( lc_stda( argc, argv, "--rect-width"   , "-k" ), argv, & nrrWidth             , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--rect-height"  , "-l" ), argv, & nrrHeight            , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--map-width"    , "-W" ), argv, & nrGnomonic.gnmWidth  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--map-height"   , "-H" ), argv, & nrGnomonic.gnmHeight , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--tile-x"       , "-X" ), argv, & nrGnomonic.gnmCornerX, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--tile-y"       , "-Y" ), argv, & nrGnomonic.gnmCornerY, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrThread             , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--export"       , "-q" ), argv, & nrOption             , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--input"        , "-i" ), argv, & nriPath              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"       , "-o" ), argv, & nroPath              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--seed"         , "-s" ), argv, & nriSeed              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod             , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--layout"       , "-L" ), argv, & nrLayout             , LC_STRING );
+
+        /* Select projection model */
+        if ( lc_stda( argc, argv, "--generic" , "-N" ) ) nrGnomonic.gnModel = LN_GENERIC;  else
+        if ( lc_stda( argc, argv, "--elphel"  , "-E" ) ) nrGnomonic.gnModel = LN_ELPHEL;   else
+        if ( lc_stda( argc, argv, "--center"  , "-T" ) ) nrGnomonic.gnModel = LN_CENTER;   else
+        if ( lc_stda( argc, argv, "--complete", "-P" ) ) nrGnomonic.gnModel = LN_COMPLETE;
+
+        /* Convert angles to radian */
+        nrGnomonic.gnApper *= ( LG_PI / 180.0 );
+        nrGnomonic.gnAzim  *= ( LG_PI / 180.0 );
+        nrGnomonic.gnHead  *= ( LG_PI / 180.0 );
+        nrGnomonic.gnElev  *= ( LG_PI / 180.0 );
+        nrGnomonic.gnRoll  *= ( LG_PI / 180.0 );
 
         /* Software swicth */
         if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
@@ -128,166 +140,72 @@
             /* Verify path strings */
             if ( ( nriPath != NULL ) && ( nroPath != NULL ) ) {
 
-                /* Import input image */
-                nriImage = cvLoadImage( nriPath, lc_stda( argc, argv, "--force-rgb", "-F" ) ? CV_LOAD_IMAGE_COLOR : CV_LOAD_IMAGE_UNCHANGED );
+                /* Import input image - projection footprint only */
+                nriImage = nr_direct_import( nriPath, lc_stda( argc, argv, "--force-rgb", "-F" ) ? CV_LOAD_IMAGE_COLOR : CV_LOAD_IMAGE_UNCHANGED, lc_stda( argc, argv, "--cubemap", "-M" ) ? NULL : & nrGnomonic, nrrWidth, nrrHeight, nriSeed, nrThread );
 
                 /*  Verify input image reading */
                 if ( nriImage != NULL ) {
 
-                    /* Check for image seed */
-                    if ( nriSeed == NULL ) {
+                    /* Check for cube map exportation */
+                    if ( lc_stda( argc, argv, "--cubemap", "-M" ) ) {
 
-                        /* Create image allocation */
-                        nroImage = cvCreateImage( cvSize( nrrWidth, nrrHeight ), IPL_DEPTH_8U , nriImage->nChannels );
+                        /* Export cube map */
+                        nr_direct_cubemap( nriImage, nroPath, nrrWidth, nrLayout, nrOption, lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ), nrThread );
 
                     } else {
 
-                        /* Load image seed */
-                        nroImage = cvLoadImage( nriSeed, CV_LOAD_IMAGE_UNCHANGED );
-
-                    }
+                        /* Check for image seed */
+                        if ( nriSeed == NULL ) {
 
-                    /* Verify allocation creation */
-                    if ( nroImage != NULL ) {
+                            /* Create image allocation */
+                            nroImage = cvCreateImage( cvSize( nrrWidth, nrrHeight ), IPL_DEPTH_8U , nriImage->nChannels );
 
-                        /* Image initialization swicth */
-                        if ( lc_stda( argc, argv, "--clear", "-C" ) ) {
+                        } else {
 
-                            /* Initialize image background */
-                            cvSet( nroImage, CV_RGB( nrRed, nrGreen, nrBlue ), NULL );
+                            /* Load image seed */
+                            nroImage = lc_imread( nriSeed, CV_LOAD_IMAGE_UNCHANGED );
 
                         }
 
-                        /* Select projection model */
-                        if ( lc_stda( argc, argv, "--generic", "-N" ) ) {
-
-                            /* Projection - generic */
-                            lg_ttg_genericp(
-
-                                ( inter_C8_t * ) nriImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                ( inter_C8_t * ) nroImage->imageData,
-                                nroImage->width,
-                                nroImage->height,
-                                nroImage->nChannels,
-                                nrSightX,
-                                nrSightY,
-                                nrmWidth,
-                                nrmHeight,
-                                nrmCornerX,
-                                nrmCornerY,
-                                nrAzim  * ( LG_PI / 180.0 ),
-                                nrElev  * ( LG_PI / 180.0 ),
-                                nrRoll  * ( LG_PI / 180.0 ),
-                                nrFocal,
-                                nrPixel,
-                                lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                                nrThread
-
-                            );
-
-                        } else
-                        if ( lc_stda( argc, argv, "--elphel", "-E" ) ) {
-
-                            /* Projection - elphel-specific */
-                            lg_ttg_elphelp(
-
-                                ( inter_C8_t * ) nriImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                ( inter_C8_t * ) nroImage->imageData,
-                                nroImage->width,
-                                nroImage->height,
-                                nroImage->nChannels,
-                                nrSightX,
-                                nrSightY,
-                                nrmWidth,
-                                nrmHeight,
-                                nrmCornerX,
-                                nrmCornerY,
-                                nrRoll * ( LG_PI / 180.0 ),
-                                nrAzim * ( LG_PI / 180.0 ),
-                                nrElev * ( LG_PI / 180.0 ),
-                                nrHead * ( LG_PI / 180.0 ),
-                                nrPixel,
-                                nrFocal,
-                                lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                                nrThread
-
-                            );
-
-                        } else
-                        if ( lc_stda( argc, argv, "--center", "-T" ) ) {
-
-                            /* Projection - center-specific */
-                            lg_ttg_centerp(
-
-                                ( inter_C8_t * ) nriImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                ( inter_C8_t * ) nroImage->imageData,
-                                nroImage->width,
-                                nroImage->height,
-                                nroImage->nChannels,
-                                nrmWidth,
-                                nrmHeight,
-                                nrmCornerX,
-                                nrmCornerY,
-                                nrAzim * ( LG_PI / 180.0 ),
-                                nrElev * ( LG_PI / 180.0 ),
-                                nrRoll * ( LG_PI / 180.0 ),
-                                nrFocal,
-                                nrPixel,
-                                lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                                nrThread
-
-                            );
-
-                        } else
-                        if ( lc_stda( argc, argv, "--complete", "-P" ) ) {
-
-                            /* Projection - aperture-specific */
-                            lg_etg_apperturep( 
-
-                                ( inter_C8_t * ) nriImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                ( inter_C8_t * ) nroImage->imageData,
-                                nroImage->width,
-                                nroImage->height,
-                                nroImage->nChannels,
-                                nrAzim  * ( LG_PI / 180.0 ),
-                                nrElev  * ( LG_PI / 180.0 ),
-                                nrRoll  * ( LG_PI / 180.0 ),
-                                nrApper * ( LG_PI / 180.0 ),
-                                lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                                nrThread
-
-                            );
+                        /* Verify allocation creation */
+                        if ( nroImage != NULL ) {
 
-                        }
+                            /* Compose image descriptors */
+                            nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nriImage->imageData, nriImage->width, nriImage->height, nriImage->nChannels };
+                            nroDesc = ( ln_Image_t ) { ( inter_C8_t * ) nroImage->imageData, nroImage->width, nroImage->height, nroImage->nChannels };
 
-                        /* Export output image */
-                        if ( lc_imwrite( nroPath, nroImage, nrOption ) == 0 ) {
+                            /* Image initialization swicth */
+                            if ( lc_stda( argc, argv, "--clear", "-C" ) ) {
 
-                            /* Display message */
-                            fprintf( LC_ERR, "Error : Unable to write output image\n" );
+                                /* Initialize image background */
+                                ln_clear( & nroDesc, nrRed, nrGreen, nrBlue );
 
-                        }
+                            }
 
-                        /* Release image memory */
-                        cvReleaseImage( & nroImage );
+                            /* Compute gnomonic projection */
+                            if ( ( nrStatus = ln_direct( & nriDesc, & nroDesc, & nrGnomonic, lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ), nrThread ) ) != LN_SUCCESS ) {
 
-                    /* Display message */
-                    } else { fprintf( LC_ERR, "Error : Unable to create output image or read output image seed\n" ); }
+                                /* Display message */
+                                fprintf( LC_ERR, "Error : %s\n", ln_error( nrStatus ) );
+
+                            } else
+                            if ( lc_imwrite( nroPath, nroImage, nrOption ) == 0 ) {
+
+                                /* Display message */
+                                fprintf( LC_ERR, "Error : Unable to write output image\n" );
+
+                            }
+
+                            /* Release image memory */
+                            lc_imrelease( & nroImage );
+
+                        /* Display message */
+                        } else { fprintf( LC_ERR, "Error : Unable to create output image or read output image seed\n" ); }
+
+                    }
 
                     /* Release image memory */
-                    cvReleaseImage( & nriImage );
+                    lc_imrelease( & nriImage );
 
                 /* Display message */
                 } else { fprintf( LC_ERR, "Error : Unable to read input image\n" ); }
@@ -302,3 +220,247 @@
 
     }
 
+
+/*
+    Source - Cube map exportation
+ */
+
+    int nr_direct_cubemap( IplImage * const nrImage, char * const nrPath, int nrSize, char const * const nrLayout, int const nrOption, li_Method_t const nrMethod, int const nrThread ) {
+
+        /* Cross layout faces positions */
+        static int const nrCross[LN_FACES][2] = { { 1, 1 }, { 2, 1 }, { 3, 1 }, { 0, 1 }, { 1, 0 }, { 1, 2 } };
+
+        /* Layout variables */
+        int nrMode = NR_LAYOUT_FACES;
+
+        /* Status variables */
+        int nrStatus = LN_SUCCESS;
+
+        /* Exportation failures variables */
+        int nrFail = 0;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Image allocation variables */
+        IplImage * nrFace[LN_FACES] = { NULL };
+        IplImage * nrAssembly = NULL;
+
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nrfDesc[LN_FACES];
+
+        /* Select layout */
+        if ( ( nrLayout == NULL ) || ( strcmp( nrLayout, "faces" ) == 0 ) ) nrMode = NR_LAYOUT_FACES; else
+        if ( strcmp( nrLayout, "strip" ) == 0 ) nrMode = NR_LAYOUT_STRIP; else
+        if ( strcmp( nrLayout, "cross" ) == 0 ) nrMode = NR_LAYOUT_CROSS; else {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unknown cube map layout\n" ); return( LC_FALSE );
+
+        }
+
+        /* Assign default face size - input sampling density */
+        if ( nrSize <= 0 ) nrSize = nrImage->width / 4;
+
+        /* Compose input image descriptor */
+        nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nrImage->imageData, nrImage->width, nrImage->height, nrImage->nChannels };
+
+        /* Create faces images */
+        for ( nrParse = 0; nrParse < LN_FACES; nrParse ++ ) {
+
+            /* Create face image */
+            if ( ( nrFace[nrParse] = cvCreateImage( cvSize( nrSize, nrSize ), IPL_DEPTH_8U, nrImage->nChannels ) ) == NULL ) break;
+
+            /* Compose face image descriptor */
+            nrfDesc[nrParse] = ( ln_Image_t ) { ( inter_C8_t * ) nrFace[nrParse]->imageData, nrSize, nrSize, nrImage->nChannels };
+
+        }
+
+        /* Render cube map */
+        if ( nrParse < LN_FACES ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to create cube map faces images\n" ); nrFail = 1;
+
+        } else
+        if ( ( nrStatus = ln_cubemap( & nriDesc, nrfDesc, nrMethod, nrThread ) ) != LN_SUCCESS ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : %s\n", ln_error( nrStatus ) ); nrFail = 1;
+
+        } else
+        if ( nrMode == NR_LAYOUT_FACES ) {
+
+            /* Export faces in parallel */
+            # pragma omp parallel for num_threads( nrThread < LN_FACES ? nrThread : LN_FACES ) reduction( + : nrFail )
+            for ( int nrIndex = 0; nrIndex < LN_FACES; nrIndex ++ ) {
+
+                /* Face path variables */
+                char nrFile[PATH_MAX];
+
+                /* Extension pointer variables */
+                char * nrExt = strrchr( nrPath, '.' );
+
+                /* Check extension position */
+                if ( ( nrExt == NULL ) || ( strchr( nrExt, '/' ) != NULL ) ) nrExt = nrPath + strlen( nrPath );
+
+                /* Compose face path - face tag before extension */
+                snprintf( nrFile, PATH_MAX, "%.*s_%c%s", ( int ) ( nrExt - nrPath ), nrPath, LN_FACES_TAGS[nrIndex], nrExt );
+
+                /* Export face image */
+                if ( lc_imwrite( nrFile, nrFace[nrIndex], nrOption ) == 0 ) nrFail ++;
+
+            }
+
+            /* Display message */
+            if ( nrFail > 0 ) fprintf( LC_ERR, "Error : Unable to write output image\n" );
+
+        } else {
+
+            /* Create assembly image */
+            if ( ( nrAssembly = cvCreateImage( nrMode == NR_LAYOUT_STRIP ? cvSize( nrSize * LN_FACES, nrSize ) : cvSize( nrSize * 4, nrSize * 3 ), IPL_DEPTH_8U, nrImage->nChannels ) ) != NULL ) {
+
+                /* Clear assembly image */
+                cvSetZero( nrAssembly );
+
+                /* Assemble faces */
+                for ( nrParse = 0; nrParse < LN_FACES; nrParse ++ ) {
+
+                    /* Select face region */
+                    if ( nrMode == NR_LAYOUT_STRIP ) {
+
+                        /* Strip layout region */
+                        cvSetImageROI( nrAssembly, cvRect( nrParse * nrSize, 0, nrSize, nrSize ) );
+
+                    } else {
+
+                        /* Cross layout region */
+                        cvSetImageROI( nrAssembly, cvRect( nrCross[nrParse][0] * nrSize, nrCross[nrParse][1] * nrSize, nrSize, nrSize ) );
+
+                    }
+
+                    /* Copy face */
+                    cvCopy( nrFace[nrParse], nrAssembly, NULL );
+
+                }
+
+                /* Reset assembly region */
+                cvResetImageROI( nrAssembly );
+
+                /* Export assembly image */
+                if ( lc_imwrite( nrPath, nrAssembly, nrOption ) == 0 ) {
+
+                    /* Display message */
+                    fprintf( LC_ERR, "Error : Unable to write output image\n" ); nrFail = 1;
+
+                }
+
+                /* Release assembly image */
+                lc_imrelease( & nrAssembly );
+
+            } else {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : Unable to create cube map assembly image\n" ); nrFail = 1;
+
+            }
+
+        }
+
+        /* Release faces images */
+        for ( nrParse = 0; nrParse < LN_FACES; nrParse ++ ) if ( nrFace[nrParse] != NULL ) lc_imrelease( & nrFace[nrParse] );
+
+        /* Return status */
+        return( nrFail == 0 ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Input image importation
+ */
+
+    IplImage * nr_direct_import( 
+
+        char          const * const nrPath, 
+        int                   const nrFlag, 
+        ln_Gnomonic_t       * const nrGnomonic, 
+        int                         nrrWidth, 
+        int                         nrrHeight, 
+        char          const * const nrSeed, 
+        int                   const nrThread 
+
+    ) {
+
+        /* Image size variables */
+        CvSize nrSize;
+
+        /* Footprint region variables */
+        ln_Region_t nrRegion;
+        CvRect      nrRect;
+
+        /* Reduced decoding scale variables */
+        int    nrScale   = LC_JPEG_SCALE;
+        double nrDensity = 1.0;
+
+        /* Image allocation variables */
+        IplImage * nrImage = NULL;
+
+        /* Check footprint importation */
+        if ( nrGnomonic == NULL ) return( lc_imread( nrPath, nrFlag ) );
+
+        /* Check image seed */
+        if ( nrSeed != NULL ) {
+
+            /* Retrieve output image size from seed headers */
+            if ( lc_imsize( nrSeed, & nrSize ) == LC_TRUE ) {
+
+                /* Assign output image size */
+                nrrWidth  = nrSize.width;
+                nrrHeight = nrSize.height;
+
+            /* Unknown output image size */
+            } else { nrrWidth = 0; }
+
+        }
+
+        /* Retrieve input image size - entire importation on failure */
+        if ( ( nrrWidth <= 0 ) || ( nrrHeight <= 0 ) || ( lc_imsize( nrPath, & nrSize ) == LC_FALSE ) ) return( lc_imread( nrPath, nrFlag ) );
+
+        /* Compute projection footprint - entire image on failure */
+        if ( ln_footprint( nrGnomonic, nrSize.width, nrSize.height, nrrWidth, nrrHeight, & nrRegion, nrThread ) != LN_SUCCESS ) nrRegion = ( ln_Region_t ) { 0, 0, nrSize.width, nrSize.height };
+
+        /* Compose footprint region */
+        nrRect = cvRect( nrRegion.rgX, nrRegion.rgY, nrRegion.rgWidth, nrRegion.rgHeight );
+
+        /* Compute required sampling density */
+        nrDensity = ln_density( nrGnomonic, nrSize.width, nrrWidth );
+
+        /* Select reduced decoding scale - exact division of image size and mapping parameters */
+        while ( ( nrScale > 1 ) && ( ( nrDensity * nrScale > 1.0 ) || ( nrSize.width % nrScale ) || ( nrSize.height % nrScale ) || ( ( nrGnomonic->gnModel != LN_COMPLETE ) && (
+            ( nrGnomonic->gnmWidth % nrScale ) || ( nrGnomonic->gnmHeight % nrScale ) || ( nrGnomonic->gnmCornerX % nrScale ) || ( nrGnomonic->gnmCornerY % nrScale ) ) ) ) ) nrScale >>= 1;
+
+        /* Import input image footprint */
+        if ( ( nrImage = lc_imread_partial( nrPath, nrFlag, & nrRect, 1.0 / nrScale ) ) != NULL ) {
+
+            /* Retrieve applied decoding scale */
+            nrScale = nrSize.width / nrImage->width;
+
+            /* Check projection model */
+            if ( ( nrScale > 1 ) && ( nrGnomonic->gnModel != LN_COMPLETE ) ) {
+
+                /* Reduce mapping parameters */
+                nrGnomonic->gnmWidth   /= nrScale;
+                nrGnomonic->gnmHeight  /= nrScale;
+                nrGnomonic->gnmCornerX /= nrScale;
+                nrGnomonic->gnmCornerY /= nrScale;
+
+            }
+
+        }
+
+        /* Return imported image */
+        return( nrImage );
+
+    }
+
@@ -99,10 +99,13 @@
 
     # include <stdio.h>
     # include <stdlib.h>
+    # include <string.h>
+    # include <limits.h>
     # include <opencv/cv.h>
     # include <opencv/highgui.h>
     # include <gnomonic-all.h>
     # include <common-all.h>
+    # include <norama-all.h>
 
 /* 
     Header - Preprocessor definitions
@@ -118,6 +121,7 @@
     "\t-E\tElphel-specific projection\n"                       \
     "\t-T\tCentered-specific projection\n"                     \
     "\t-P\tAperture-specific projection\n"                     \
+    "\t-M\tCube map export - six faces of -k pixels\n"         \
     "\t-i\tInput equirectangular image\n"                      \
     "\t-o\tOutput rectilinear image\n"                         \
     "\t-s\tOutput rectilinear image seed\n"                    \
@@ -141,10 +145,16 @@
     "\t-Y\tEquirectangular tile y-position\n"                  \
     "\t-t\tNumber of threads\n"                                \
     "\t-n\tInterpolation method\n"                             \
+    "\t-L\tCube map layout - faces, strip or cross\n"          \
     "\t-q\tOutput image exportation options\n\n"               \
     "norama-direct - norama-suite\n"                           \
     "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
 
+    /* Define cube map layouts */
+    # define NR_LAYOUT_FACES 0
+    # define NR_LAYOUT_STRIP 1
+    # define NR_LAYOUT_CROSS 2
+
 /* 
     Header - Preprocessor macros
  */
@@ -174,6 +184,67 @@
 
     int main ( int argc, char ** argv );
 
+    /*! \brief Cube map exportation
+     *
+     *  This function renders the six faces of a cube map in a single pass
+     *  over the input image and exports them. The faces are either written
+     *  in six files, the face tag being appended to the output file name
+     *  before its extension, and encoded in parallel, or assembled in a
+     *  single strip or cross layout image.
+     *
+     *  \param nrImage  Input equirectangular image
+     *  \param nrPath   Output image path
+     *  \param nrSize   Faces size, in pixels, input width quarter if zero
+     *  \param nrLayout Layout tag - faces, strip or cross - faces if NULL
+     *  \param nrOption Output image exportation options
+     *  \param nrMethod Interpolation method
+     *  \param nrThread Number of threads
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_direct_cubemap ( IplImage * const nrImage, char * const nrPath, int nrSize, char const * const nrLayout, int const nrOption, li_Method_t const nrMethod, int const nrThread );
+
+    /*! \brief Input image importation
+     *
+     *  This function imports the input equirectangular image, restricting its
+     *  decoding to the footprint of the gnomonic projection. The footprint is
+     *  computed from the projection parameters and from the input and output
+     *  images sizes, read from the images headers. If one of the sizes cannot
+     *  be read without decoding the image, the input image is imported in its
+     *  entirety. Tiled TIFF images are only decoded on the tiles intersecting
+     *  the footprint, allowing mappings larger than the available memory.
+     *
+     *  When the projection samples the input image sparsely, the image is also
+     *  decoded at a reduced scale of 1/2, 1/4 or 1/8 by the JPEG codec. For
+     *  tile models, the scale is limited to the one dividing the mapping size
+     *  and tile corner. The mapping parameters are then reduced according to
+     *  the applied scale.
+     *
+     *  \param nrPath     Input image path
+     *  \param nrFlag     OpenCV importation flag
+     *  \param nrGnomonic Projection parameters, NULL for entire importation,
+     *                    updated according to the applied scale
+     *  \param nrrWidth   Output rectilinear image width, in pixels
+     *  \param nrrHeight  Output rectilinear image height, in pixels
+     *  \param nrSeed     Output rectilinear image seed path, NULL if none
+     *  \param nrThread   Number of threads
+     *
+     *  \return Returns imported image, NULL on failure
+     */
+
+    IplImage * nr_direct_import ( 
+
+        char          const * const nrPath, 
+        int                   const nrFlag, 
+        ln_Gnomonic_t       * const nrGnomonic, 
+        int                         nrrWidth, 
+        int                         nrrHeight, 
+        char          const * const nrSeed, 
+        int                   const nrThread 
+
+    );
+
 /* 
     Header - C/C++ compatibility
  */
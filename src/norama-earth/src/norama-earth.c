@@ -55,6 +55,9 @@
         /* Parallel processing variables */
         int nrThread = 1;
 
+        /* Transformation status variables */
+        int nrStatus = LN_SUCCESS;
+
         /* Interpolation descriptor variables */
         char * nrMethod = NULL;
 
@@ -77,9 +80,31 @@
         IplImage * nriImage = NULL;
         IplImage * nroImage = NULL;
 
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nroDesc;
+
         /* Rotation matrix variables */
         lp_Real_t nrMatrix[3][3] = { { 0.0 } };
 
+        /* Batch path variables */
+        char * nrlPath = NULL;
+        char * nrdPath = NULL;
+        char * nrePath = NULL;
+
+        /* Orientation index path variables */
+        char * nrkPath = NULL;
+        char * nrjPath = NULL;
+
+        /* Batch workers variables */
+        int nrWorkers = NR_DFT_WORKER;
+
+        /* Batch variables */
+        nr_Batch nrBatch = { NULL, 0, 0, 0, 0, NULL, 1, -1, PTHREAD_MUTEX_INITIALIZER };
+
+        /* Parsing variables */
+        long nrParse = 0;
+
         /* Search in parameters */
         lc_stdp( lc_stda( argc, argv, "--input"        , "-a" ), argv, & nriPath , LC_STRING );
         lc_stdp( lc_stda( argc, argv, "--output"       , "-b" ), argv, & nroPath , LC_STRING );
@@ -93,6 +118,12 @@
         lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod, LC_STRING );
         lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrThread, LC_INT    );
         lc_stdp( lc_stda( argc, argv, "--export"       , "-q" ), argv, & nrOption, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--list"         , "-l" ), argv, & nrlPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--directory"    , "-d" ), argv, & nrdPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output-dir"   , "-o" ), argv, & nrePath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--workers"      , "-w" ), argv, & nrWorkers, LC_INT   );
+        lc_stdp( lc_stda( argc, argv, "--build-index"  , "-k" ), argv, & nrkPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--index"        , "-j" ), argv, & nrjPath , LC_STRING );
 
         /* Software swicth */
         if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
@@ -100,13 +131,76 @@
             /* Display usage */
             fprintf( stdout, NR_HELP );
 
+        } else
+        if ( ( nrlPath != NULL ) || ( nrdPath != NULL ) ) {
+
+            /* Verify path strings - index building requires CSPS */
+            if ( ( ( nrcPath != NULL ) || ( ( nrjPath != NULL ) && ( nrkPath == NULL ) ) ) && ( ( nrlPath != NULL ) || ( nrePath != NULL ) || ( nrkPath != NULL ) ) ) {
+
+                /* Read batch entries */
+                if ( ( nrlPath != NULL ? nr_earth_list( & nrBatch, nrlPath ) : nr_earth_directory( & nrBatch, nrdPath, nrePath != NULL ? nrePath : nrdPath ) ) == LC_TRUE ) {
+
+                    /* Check index building */
+                    if ( nrkPath != NULL ) {
+
+                        /* Build orientation index */
+                        if ( ( nrStatus = nr_earth_index( & nrBatch, nrkPath, nrcPath, nrcTag, nrcMod, nroTag, nroMod ) ) != LN_SUCCESS ) {
+
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : %s\n", ln_error( nrStatus ) );
+
+                        }
+
+                    } else {
+
+                        /* Assign batch parameters */
+                        nrBatch.btMethod = lc_method( nrMethod == NULL ? "bicubicf" : nrMethod );
+                        nrBatch.btOption = nrOption;
+
+                        /* Share threads among workers */
+                        nrBatch.btThread = nrThread / ( nrWorkers > 0 ? nrWorkers : 1 ) > 0 ? nrThread / ( nrWorkers > 0 ? nrWorkers : 1 ) : 1;
+
+                        /* Process batch */
+                        if ( ( nrStatus = nr_earth_batch( & nrBatch, nrcPath, nrcTag, nrcMod, nroTag, nroMod, nrjPath, nrWorkers ) ) != LN_SUCCESS ) {
+
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : %s\n", ln_error( nrStatus ) );
+
+                        } else
+                        if ( nrBatch.btFailed > 0 ) {
+
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : %li of %li mapping(s) not processed\n", nrBatch.btFailed, nrBatch.btCount );
+
+                        }
+
+                    }
+
+                /* Display message */
+                } else { fprintf( LC_ERR, "Error : Unable to read batch entries\n" ); }
+
+                /* Release batch entries */
+                for ( nrParse = 0; nrParse < nrBatch.btCount; nrParse ++ ) {
+
+                    /* Release entry paths */
+                    free( nrBatch.btEntry[nrParse].enInput  );
+                    free( nrBatch.btEntry[nrParse].enOutput );
+
+                }
+
+                /* Release batch entries array */
+                free( nrBatch.btEntry );
+
+            /* Display message */
+            } else { fprintf( LC_ERR, "Error : Invalid path specification\n" ); }
+
         } else {
 
             /* Verify path strings */
-            if ( ( nriPath != NULL ) && ( nroPath != NULL ) && ( nrcPath != NULL ) ) {
+            if ( ( nriPath != NULL ) && ( nroPath != NULL ) && ( ( nrcPath != NULL ) || ( nrjPath != NULL ) ) ) {
 
                 /* Import input image */
-                nriImage = cvLoadImage( nriPath, CV_LOAD_IMAGE_UNCHANGED );
+                nriImage = lc_imread( nriPath, CV_LOAD_IMAGE_UNCHANGED );
 
                 /*  Verify input image reading */
                 if ( nriImage != NULL ) {
@@ -117,41 +211,38 @@
                     /* Verify allocation creation */
                     if ( nroImage != NULL ) {
 
-                        /* Query rotation matrix */
-                        if ( nr_earth_matrix( nrcPath, nrcTag, nrcMod, nroTag, nroMod, nrtSec, nrtUse, nrMatrix ) == LC_TRUE ) {
+                        /* Compose image descriptors */
+                        nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nriImage->imageData, nriImage->width, nriImage->height, nriImage->nChannels };
+                        nroDesc = ( ln_Image_t ) { ( inter_C8_t * ) nroImage->imageData, nroImage->width, nroImage->height, nroImage->nChannels };
 
-                            /* Apply equirectangular transformation */
-                            lg_transform_matrixp( 
+                        /* Query rotation matrix - from index if provided */
+                        if ( ( nrStatus = ( nrjPath != NULL ) ? ln_index_single( nrjPath, nrtSec, nrtUse, nrMatrix ) : ln_earth_matrix( nrcPath, nrcTag, nrcMod, nroTag, nroMod, nrtSec, nrtUse, nrMatrix ) ) != LN_SUCCESS ) {
 
-                                ( inter_C8_t * ) nriImage->imageData,
-                                ( inter_C8_t * ) nroImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                nrMatrix,
-                                lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                                nrThread
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : %s\n", ln_error( nrStatus ) );
 
-                            );
+                        } else
+                        if ( ( nrStatus = ln_earth( & nriDesc, & nroDesc, nrMatrix, lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ), nrThread ) ) != LN_SUCCESS ) {
 
-                            /* Export output image */
-                            if ( lc_imwrite( nroPath, nroImage, nrOption ) == 0 ) {
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : %s\n", ln_error( nrStatus ) );
 
-                                /* Display message */
-                                fprintf( LC_ERR, "Error : Unable to write output image\n" );
+                        } else
+                        if ( lc_imwrite( nroPath, nroImage, nrOption ) == 0 ) {
 
-                            }
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : Unable to write output image\n" );
 
                         }
 
                         /* Release image memory */
-                        cvReleaseImage( & nroImage );
+                        lc_imrelease( & nroImage );
 
                     /* Display message */
                     } else { fprintf( LC_ERR, "Error : Unable to create output image\n" ); }
 
                     /* Release image memory */
-                    cvReleaseImage( & nriImage );
+                    lc_imrelease( & nriImage );
 
                 /* Display message */
                 } else { fprintf( LC_ERR, "Error : Unable to read input image\n" ); }
@@ -167,105 +258,465 @@
     }
 
 /*
-    Source - CSPS interface methods
+    Source - Batch processing
  */
 
-    int nr_earth_matrix( 
+    int nr_earth_batch( 
 
-        lp_Char_t const * const nrPath, 
-        lp_Char_t const * const nrCamTag, 
-        lp_Char_t const * const nrCamMod, 
-        lp_Char_t const * const nrIMUTag, 
-        lp_Char_t const * const nrIMUMod, 
-        lp_Time_t const         nrSecond,
-        lp_Time_t const         nrMicro,
-        lp_Real_t               nrMatrix[3][3]
+        nr_Batch       * const nrBatch, 
+        char     const * const nrPath, 
+        char     const * const nrCamTag, 
+        char     const * const nrCamMod, 
+        char     const * const nrIMUTag, 
+        char     const * const nrIMUMod, 
+        char     const * const nrIndex, 
+        int              const nrWorkers 
 
     ) {
 
-        /* Query structure variables */
-        lp_Orient_t  nrOrient;
-        lp_Trigger_t nrTrigger;
+        /* Query handles variables */
+        ln_Query_t nrQuery;
+
+        /* Orientation index variables */
+        ln_Index_t nrIndexes;
 
         /* Returned value variables */
-        int nrReturn = LC_FALSE;
+        int nrReturn = LN_SUCCESS;
 
-        /* Verify switches */
-        if ( ( nrCamTag == NULL ) || ( nrCamMod == NULL ) || ( nrIMUTag == NULL ) || ( nrIMUMod == NULL ) ) {
+        /* Workers variables */
+        pthread_t * nrWorker = NULL;
 
-                /* Display message */
-                fprintf( LC_ERR, "Error : Invalid CSPS switch specification\n" );
+        /* Workers count variables */
+        int nrCount = 0;
+
+        /* Parsing variables */
+        long nrParse = 0;
+
+        /* Sort entries by timestamp */
+        qsort( nrBatch->btEntry, nrBatch->btCount, sizeof( nr_Entry ), & nr_earth_order );
+
+        /* Check orientation index */
+        if ( nrIndex != NULL ) {
+
+            /* Open orientation index */
+            if ( ( nrReturn = ln_index_open( & nrIndexes, nrIndex ) ) != LN_SUCCESS ) return( nrReturn );
+
+            /* Search rotation matrices */
+            for ( nrParse = 0; nrParse < nrBatch->btCount; nrParse ++ ) {
+
+                /* Search rotation matrix */
+                nrBatch->btEntry[nrParse].enStatus = ln_index_matrix( & nrIndexes, nrBatch->btEntry[nrParse].enSecond, nrBatch->btEntry[nrParse].enMicro, nrBatch->btEntry[nrParse].enMatrix );
+
+            }
+
+            /* Close orientation index */
+            ln_index_close( & nrIndexes );
 
         } else {
 
-            /* Create query structure */
-            nrTrigger = lp_query_trigger_create( nrPath, nrCamTag, nrCamMod );
+            /* Create query handles - streams parsed once for the batch */
+            if ( ( nrReturn = ln_query_create( & nrQuery, nrPath, nrCamTag, nrCamMod, nrIMUTag, nrIMUMod ) ) != LN_SUCCESS ) return( nrReturn );
+
+            /* Query rotation matrices in timestamp order */
+            for ( nrParse = 0; nrParse < nrBatch->btCount; nrParse ++ ) {
+
+                /* Query rotation matrix */
+                nrBatch->btEntry[nrParse].enStatus = ln_query_matrix( & nrQuery, nrBatch->btEntry[nrParse].enSecond, nrBatch->btEntry[nrParse].enMicro, nrBatch->btEntry[nrParse].enMatrix );
 
-            /* Verify structure state */
-            if ( lp_query_trigger_state( & nrTrigger ) == LP_FALSE ) {
+            }
+
+            /* Release query handles */
+            ln_query_delete( & nrQuery );
+
+        }
+
+        /* Allocate workers handles */
+        if ( ( nrWorker = ( pthread_t * ) malloc( ( nrWorkers > 0 ? nrWorkers : 1 ) * sizeof( pthread_t ) ) ) != NULL ) {
+
+            /* Create workers - no more than entries */
+            for ( nrCount = 0; ( nrCount < nrWorkers ) && ( nrCount < nrBatch->btCount ); nrCount ++ ) {
+
+                /* Create worker */
+                if ( pthread_create( nrWorker + nrCount, NULL, & nr_earth_worker, nrBatch ) != 0 ) break;
+
+            }
+
+        }
+
+        /* Process entries in calling thread if no worker is available */
+        if ( nrCount == 0 ) nr_earth_worker( nrBatch );
+
+        /* Wait workers */
+        for ( nrParse = 0; nrParse < nrCount; nrParse ++ ) pthread_join( nrWorker[nrParse], NULL );
+
+        /* Release workers handles */
+        free( nrWorker );
+
+        /* Return status */
+        return( LN_SUCCESS );
+
+    }
+
+/*
+    Source - Batch orientation index
+ */
+
+    int nr_earth_index( 
+
+        nr_Batch const * const nrBatch, 
+        char     const * const nrFile, 
+        char     const * const nrPath, 
+        char     const * const nrCamTag, 
+        char     const * const nrCamMod, 
+        char     const * const nrIMUTag, 
+        char     const * const nrIMUMod 
+
+    ) {
+
+        /* Query handles variables */
+        ln_Query_t nrQuery;
+
+        /* Timestamps variables */
+        lp_Time_t * nrSecond = NULL;
+        lp_Time_t * nrMicro  = NULL;
+
+        /* Indexed count variables */
+        size_t nrIndexed = 0;
+
+        /* Returned value variables */
+        int nrReturn = LN_SUCCESS;
+
+        /* Parsing variables */
+        long nrParse = 0;
+
+        /* Allocate timestamps */
+        nrSecond = ( lp_Time_t * ) malloc( nrBatch->btCount * sizeof( lp_Time_t ) );
+        nrMicro  = ( lp_Time_t * ) malloc( nrBatch->btCount * sizeof( lp_Time_t ) );
+
+        /* Verify allocations */
+        if ( ( nrSecond != NULL ) && ( nrMicro != NULL ) ) {
+
+            /* Gather entries timestamps */
+            for ( nrParse = 0; nrParse < nrBatch->btCount; nrParse ++ ) {
+
+                /* Assign timestamp */
+                nrSecond[nrParse] = nrBatch->btEntry[nrParse].enSecond;
+                nrMicro [nrParse] = nrBatch->btEntry[nrParse].enMicro;
+
+            }
+
+            /* Create query handles - streams parsed once for the index */
+            if ( ( nrReturn = ln_query_create( & nrQuery, nrPath, nrCamTag, nrCamMod, nrIMUTag, nrIMUMod ) ) == LN_SUCCESS ) {
+
+                /* Build orientation index */
+                nrReturn = ln_index_create( nrFile, & nrQuery, nrSecond, nrMicro, nrBatch->btCount, & nrIndexed );
+
+                /* Release query handles */
+                ln_query_delete( & nrQuery );
+
+            }
+
+            /* Check indexed timestamps */
+            if ( ( nrReturn == LN_SUCCESS ) && ( nrIndexed < ( size_t ) nrBatch->btCount ) ) {
 
                 /* Display message */
-                fprintf( LC_ERR, "Error : Unable to create query structure on trigger\n" );
+                fprintf( LC_ERR, "Error : %li of %li timestamp(s) not indexed\n", nrBatch->btCount - ( long ) nrIndexed, nrBatch->btCount );
 
-            } else {
+            }
 
-                /* Create query structure */
-                nrOrient = lp_query_orientation_create( nrPath, nrIMUTag, nrIMUMod );
+        } else { nrReturn = LN_ERROR_INDEX; }
 
-                /* Verify structure state */
-                if ( lp_query_orientation_state( & nrOrient ) == LP_FALSE ) {
+        /* Release timestamps */
+        free( nrSecond );
+        free( nrMicro  );
 
-                    /* Display message */
-                    fprintf( LC_ERR, "Error : Unable to create query structure on orientation\n" );
+        /* Return status */
+        return( nrReturn );
 
-                } else {
+    }
 
-                    /* Query master/synchronization time-link */
-                    lp_query_trigger_bymaster( & nrTrigger, lp_timestamp_compose( nrSecond, nrMicro ) );
+/*
+    Source - Batch worker
+ */
 
-                    /* Verify query status */
-                    if ( lp_query_trigger_status( & nrTrigger ) == LP_FALSE ) {
+    void * nr_earth_worker( void * nrData ) {
 
-                        /* Display message */
-                        fprintf( LC_ERR, "Error : Unable to query trigger timestamp\n" );
+        /* Batch variables */
+        nr_Batch * nrBatch = ( nr_Batch * ) nrData;
 
-                    } else {
+        /* Entry variables */
+        nr_Entry * nrEntry = NULL;
 
-                        /* Query orientation by timestamp */
-                        lp_query_orientation( & nrOrient, nrTrigger.qrSynch );
+        /* Transformation status variables */
+        int nrStatus = LN_SUCCESS;
 
-                        /* Verify query status */
-                        if ( lp_query_orientation_status( & nrOrient ) == LP_FALSE ) {
+        /* Image allocation variables */
+        IplImage * nriImage = NULL;
+        IplImage * nroImage = NULL;
 
-                            /* Display message */
-                            fprintf( LC_ERR, "Error : Unable to query orientation\n" );
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nroDesc;
 
-                        } else {
+        /* Processing loop */
+        for ( ; ; ) {
 
-                            /* Rotation matrix method */
-                            lp_query_orientation_matrix( & nrOrient, nrMatrix );
+            /* Take next entry */
+            pthread_mutex_lock( & nrBatch->btMutex );
+            nrEntry = ( nrBatch->btNext < nrBatch->btCount ) ? nrBatch->btEntry + ( nrBatch->btNext ++ ) : NULL;
+            pthread_mutex_unlock( & nrBatch->btMutex );
 
-                            /* Update status */
-                            nrReturn = LC_TRUE;
+            /* Check remaining entries */
+            if ( nrEntry == NULL ) break;
 
-                        }
+            /* Check entry orientation */
+            if ( ( nrStatus = nrEntry->enStatus ) != LN_SUCCESS ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : %s : %s\n", nrEntry->enInput, ln_error( nrStatus ) );
+
+            } else
+            if ( ( nriImage = lc_imread( nrEntry->enInput, CV_LOAD_IMAGE_UNCHANGED ) ) == NULL ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : %s : Unable to read input image\n", nrEntry->enInput );
+
+                /* Update status */
+                nrStatus = LN_ERROR_IMAGE;
+
+            } else {
+
+                /* Create image allocation */
+                if ( ( nroImage = cvCreateImage( cvSize( nriImage->width, nriImage->height ), IPL_DEPTH_8U , nriImage->nChannels ) ) != NULL ) {
+
+                    /* Compose image descriptors */
+                    nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nriImage->imageData, nriImage->width, nriImage->height, nriImage->nChannels };
+                    nroDesc = ( ln_Image_t ) { ( inter_C8_t * ) nroImage->imageData, nroImage->width, nroImage->height, nroImage->nChannels };
+
+                    /* Apply rotation */
+                    if ( ( nrStatus = ln_earth( & nriDesc, & nroDesc, nrEntry->enMatrix, nrBatch->btMethod, nrBatch->btThread ) ) != LN_SUCCESS ) {
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : %s : %s\n", nrEntry->enInput, ln_error( nrStatus ) );
+
+                    } else
+                    if ( lc_imwrite( nrEntry->enOutput, nroImage, nrBatch->btOption ) == 0 ) {
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : %s : Unable to write output image\n", nrEntry->enOutput );
+
+                        /* Update status */
+                        nrStatus = LN_ERROR_IMAGE;
 
                     }
 
-                    /* Release query structure */
-                    lp_query_orientation_delete( & nrOrient );
+                    /* Release image memory */
+                    lc_imrelease( & nroImage );
+
+                } else {
+
+                    /* Display message */
+                    fprintf( LC_ERR, "Error : %s : Unable to create output image\n", nrEntry->enInput );
+
+                    /* Update status */
+                    nrStatus = LN_ERROR_IMAGE;
 
                 }
 
-                /* Release query structure */
-                lp_query_trigger_delete( & nrTrigger );
+                /* Release image memory */
+                lc_imrelease( & nriImage );
+
+            }
+
+            /* Check entry status */
+            if ( nrStatus != LN_SUCCESS ) {
+
+                /* Update failed entries count */
+                pthread_mutex_lock( & nrBatch->btMutex );
+                nrBatch->btFailed ++;
+                pthread_mutex_unlock( & nrBatch->btMutex );
 
             }
 
         }
 
-        /* Return status */
-        return( nrReturn );
+        /* Return thread result */
+        return( NULL );
+
+    }
+
+/*
+    Source - Batch list reading
+ */
+
+    int nr_earth_list( nr_Batch * const nrBatch, char const * const nrPath ) {
+
+        /* List stream variables */
+        FILE * nrStream = NULL;
+
+        /* Line variables */
+        char nrLine[PATH_MAX * 2];
+
+        /* Entry paths variables */
+        char nriPath[PATH_MAX];
+        char nroPath[PATH_MAX];
+
+        /* Timestamp variables */
+        unsigned long long nrSecond = 0;
+        unsigned long long nrMicro  = 0;
+
+        /* Returned value variables */
+        int nrReturn = LC_TRUE;
+
+        /* Open list */
+        if ( ( nrStream = fopen( nrPath, "r" ) ) == NULL ) return( LC_FALSE );
+
+        /* Read list lines */
+        while ( ( nrReturn == LC_TRUE ) && ( fgets( nrLine, PATH_MAX * 2, nrStream ) != NULL ) ) {
+
+            /* Skip comment lines */
+            if ( nrLine[strspn( nrLine, " \t" )] == '#' ) continue;
+
+            /* Parse entry */
+            if ( sscanf( nrLine, "%4095s %4095s %llu %llu", nriPath, nroPath, & nrSecond, & nrMicro ) == 4 ) {
+
+                /* Append entry */
+                nrReturn = nr_earth_add( nrBatch, nriPath, nroPath, lp_Time_s( nrSecond ), lp_Time_s( nrMicro ) );
+
+            } else
+            if ( nrLine[strspn( nrLine, " \t\r\n" )] != '\0' ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : Invalid batch entry %s", nrLine );
+
+            }
+
+        }
+
+        /* Close list */
+        fclose( nrStream );
+
+        /* Send message */
+        return( ( nrReturn == LC_TRUE ) && ( nrBatch->btCount > 0 ) ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Batch directory reading
+ */
+
+    int nr_earth_directory( nr_Batch * const nrBatch, char const * const nriPath, char const * const nroPath ) {
+
+        /* Directory variables */
+        DIR * nrDirectory = NULL;
+
+        /* Entry variables */
+        struct dirent * nrEntry = NULL;
+
+        /* Entry paths variables */
+        char nrInput [PATH_MAX];
+        char nrOutput[PATH_MAX];
+
+        /* Timestamp variables */
+        unsigned long long nrSecond = 0;
+        unsigned long long nrMicro  = 0;
+
+        /* Returned value variables */
+        int nrReturn = LC_TRUE;
+
+        /* Open directory */
+        if ( ( nrDirectory = opendir( nriPath ) ) == NULL ) return( LC_FALSE );
+
+        /* Enumerate directory entries */
+        while ( ( nrReturn == LC_TRUE ) && ( ( nrEntry = readdir( nrDirectory ) ) != NULL ) ) {
+
+            /* Parse entry timestamp */
+            if ( ( nrEntry->d_name[0] == '.' ) || ( sscanf( nrEntry->d_name, "%llu_%llu", & nrSecond, & nrMicro ) != 2 ) ) continue;
+
+            /* Compose entry paths */
+            snprintf( nrInput , PATH_MAX, "%s/%s", nriPath, nrEntry->d_name );
+            snprintf( nrOutput, PATH_MAX, "%s/%s", nroPath, nrEntry->d_name );
+
+            /* Append entry */
+            nrReturn = nr_earth_add( nrBatch, nrInput, nrOutput, lp_Time_s( nrSecond ), lp_Time_s( nrMicro ) );
+
+        }
+
+        /* Close directory */
+        closedir( nrDirectory );
+
+        /* Send message */
+        return( ( nrReturn == LC_TRUE ) && ( nrBatch->btCount > 0 ) ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Batch entry
+ */
+
+    int nr_earth_add( 
+
+        nr_Batch       * const nrBatch, 
+        char     const * const nriPath, 
+        char     const * const nroPath, 
+        lp_Time_t        const nrSecond, 
+        lp_Time_t        const nrMicro 
+
+    ) {
+
+        /* Reallocation variables */
+        nr_Entry * nrRealloc = NULL;
+
+        /* Entry variables */
+        nr_Entry * nrEntry = NULL;
+
+        /* Check entries capacity */
+        if ( nrBatch->btCount == nrBatch->btSize ) {
+
+            /* Reallocate entries */
+            if ( ( nrRealloc = ( nr_Entry * ) realloc( nrBatch->btEntry, ( nrBatch->btSize ? nrBatch->btSize * 2 : 256 ) * sizeof( nr_Entry ) ) ) == NULL ) return( LC_FALSE );
+
+            /* Update entries capacity */
+            nrBatch->btSize = nrBatch->btSize ? nrBatch->btSize * 2 : 256;
+
+            /* Assign entries */
+            nrBatch->btEntry = nrRealloc;
+
+        }
+
+        /* Retrieve new entry */
+        nrEntry = nrBatch->btEntry + nrBatch->btCount;
+
+        /* Assign entry */
+        nrEntry->enInput  = strdup( nriPath );
+        nrEntry->enOutput = strdup( nroPath );
+        nrEntry->enSecond = nrSecond;
+        nrEntry->enMicro  = nrMicro;
+        nrEntry->enStatus = LN_ERROR_QUERY;
+
+        /* Update entries count */
+        nrBatch->btCount ++;
+
+        /* Verify paths copies */
+        return( ( nrEntry->enInput != NULL ) && ( nrEntry->enOutput != NULL ) ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Batch entries ordering
+ */
+
+    int nr_earth_order( void const * nrA, void const * nrB ) {
+
+        /* Entries variables */
+        nr_Entry const * nrEntryA = ( nr_Entry const * ) nrA;
+        nr_Entry const * nrEntryB = ( nr_Entry const * ) nrB;
+
+        /* Compare timestamps */
+        if ( nrEntryA->enSecond != nrEntryB->enSecond ) return( nrEntryA->enSecond < nrEntryB->enSecond ? -1 : 1 );
+
+        /* Compare timestamps */
+        return( nrEntryA->enMicro < nrEntryB->enMicro ? -1 : ( nrEntryA->enMicro > nrEntryB->enMicro ? 1 : 0 ) );
 
     }
 
@@ -100,11 +100,15 @@
     # include <stdio.h>
     # include <stdlib.h>
     # include <string.h>
+    # include <limits.h>
+    # include <dirent.h>
+    # include <pthread.h>
     # include <opencv/cv.h>
     # include <opencv/highgui.h>
     # include <gnomonic-all.h>
     # include <csps-all.h>
     # include <common-all.h>
+    # include <norama-all.h>
 
 /* 
     Header - Preprocessor definitions
@@ -125,10 +129,19 @@
     "\t-v\tTimestamp micro-seconds\n"                       \
     "\t-n\tInterpolation method\n"                          \
     "\t-t\tNumber of threads\n"                             \
-    "\t-q\tEquirectangular mapping exportation options\n\n" \
+    "\t-q\tEquirectangular mapping exportation options\n"   \
+    "\t-l\tBatch list file\n"                               \
+    "\t-d\tBatch input directory\n"                         \
+    "\t-o\tBatch output directory\n"                        \
+    "\t-w\tNumber of batch workers\n"                       \
+    "\t-k\tOrientation index file to build from batch\n"    \
+    "\t-j\tOrientation index file used instead of CSPS\n\n" \
     "norama-earth - norama-suite\n"                         \
     "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
 
+    /* Define default values */
+    # define NR_DFT_WORKER 2
+
 /* 
     Header - Preprocessor macros
  */
@@ -141,6 +154,76 @@
     Header - Structures
  */
 
+    /*! \struct nr_Entry_struct
+     *  \brief Batch entry structure
+     *
+     *  This structure describes a mapping to earth-align in batch mode.
+     *
+     *  \var nr_Entry_struct::enInput
+     *  Input mapping path
+     *  \var nr_Entry_struct::enOutput
+     *  Output mapping path
+     *  \var nr_Entry_struct::enSecond
+     *  Timestamp seconds
+     *  \var nr_Entry_struct::enMicro
+     *  Timestamp micro-seconds
+     *  \var nr_Entry_struct::enMatrix
+     *  Earth-attached rotation matrix
+     *  \var nr_Entry_struct::enStatus
+     *  Orientation query status
+     */
+
+    typedef struct nr_Entry_struct {
+
+        char *    enInput;
+        char *    enOutput;
+        lp_Time_t enSecond;
+        lp_Time_t enMicro;
+        lp_Real_t enMatrix[3][3];
+        int       enStatus;
+
+    } nr_Entry;
+
+    /*! \struct nr_Batch_struct
+     *  \brief Batch structure
+     *
+     *  This structure holds the batch entries and the state shared by the
+     *  batch workers, which take the entries in timestamp order.
+     *
+     *  \var nr_Batch_struct::btEntry
+     *  Batch entries array
+     *  \var nr_Batch_struct::btCount
+     *  Batch entries count
+     *  \var nr_Batch_struct::btSize
+     *  Batch entries array capacity
+     *  \var nr_Batch_struct::btNext
+     *  Next entry to process
+     *  \var nr_Batch_struct::btFailed
+     *  Failed entries count
+     *  \var nr_Batch_struct::btMethod
+     *  Interpolation method
+     *  \var nr_Batch_struct::btThread
+     *  Number of threads of each worker
+     *  \var nr_Batch_struct::btOption
+     *  Exportation options
+     *  \var nr_Batch_struct::btMutex
+     *  Batch state mutex
+     */
+
+    typedef struct nr_Batch_struct {
+
+        nr_Entry *      btEntry;
+        long            btCount;
+        long            btSize;
+        long            btNext;
+        long            btFailed;
+        li_Method_t     btMethod;
+        int             btThread;
+        int             btOption;
+        pthread_mutex_t btMutex;
+
+    } nr_Batch;
+
 /* 
     Header - Function prototypes
  */
@@ -151,7 +234,10 @@
      *  and allocating the output one. The query on CSPS is made by timestamp to
      *  retrive the mapping earth-attached orientation in matrix form. The 
      *  rotation is applied on the input mapping and stored in output mapping
-     *  that is finally saved.
+     *  that is finally saved. In batch mode, the entries given by a list file
+     *  or an input directory are processed through the batch function, or
+     *  used to build an orientation index. When an index is provided, the
+     *  rotation matrices are searched in the index instead of CSPS.
      *  
      *  \param argc Standard main parameter
      *  \param argv Standard main parameter
@@ -159,38 +245,147 @@
 
     int main ( int argc, char ** argv );
 
-    /*! \brief CSPS interface methods
+    /*! \brief Batch processing
      *
-     *  This function performs a query through CSPS query interface to obtain
-     *  rotation matrix of a camera capture pointed by the timestamp given as
-     *  parameter according to earth local frame. The matrix provided as 
-     *  parameter is filled with the CSPS query coefficients.
+     *  This function earth-aligns the batch entries. The entries are sorted by
+     *  timestamp and their rotation matrices are queried in this order through
+     *  CSPS query handles opened once for the whole batch. The mappings are
+     *  then imported, rotated and exported by a pool of workers, so that the
+     *  decoding, rotation and encoding of successive entries overlap.
      *
-     *  \param  nrPath   Path to CSPS directory structure
-     *  \param  nrCamTag Trigger device CSPS-tag
-     *  \param  nrCamMod Trigger module CSPS-name
-     *  \param  nrIMUTag Orientation device CSPS-tag
-     *  \param  nrIMUMod Orientation device CSPS-module
-     *  \param  nrSecond Orientation query timestamp seconds
-     *  \param  nrMicro  Orientation query timestamp micro-seconds
-     *  \param  nrMatrix Returned rotation matrix
+     *  \param nrBatch   Batch structure
+     *  \param nrPath    Path to CSPS directory structure
+     *  \param nrCamTag  Trigger device CSPS-tag
+     *  \param nrCamMod  Trigger module CSPS-name
+     *  \param nrIMUTag  Orientation device CSPS-tag
+     *  \param nrIMUMod  Orientation module CSPS-name
+     *  \param nrIndex   Orientation index file, NULL to query CSPS
+     *  \param nrWorkers Number of batch workers
      *
-     *  \return Returns query on orientation status
+     *  \return Returns LN_SUCCESS on success, an error code otherwise
      */
 
-    int nr_earth_matrix( 
+    int nr_earth_batch ( 
 
-        lp_Char_t const * const nrPath, 
-        lp_Char_t const * const nrCamTag, 
-        lp_Char_t const * const nrCamMod, 
-        lp_Char_t const * const nrIMUTag, 
-        lp_Char_t const * const nrIMUMod, 
-        lp_Time_t const         nrSecond,
-        lp_Time_t const         nrMicro,
-        lp_Real_t               nrMatrix[3][3]
+        nr_Batch       * const nrBatch, 
+        char     const * const nrPath, 
+        char     const * const nrCamTag, 
+        char     const * const nrCamMod, 
+        char     const * const nrIMUTag, 
+        char     const * const nrIMUMod, 
+        char     const * const nrIndex, 
+        int              const nrWorkers 
 
     );
 
+    /*! \brief Batch orientation index
+     *
+     *  This function builds the orientation index of the batch entries
+     *  timestamps through CSPS query handles opened once. The entries whose
+     *  orientation cannot be queried are reported and not indexed.
+     *
+     *  \param nrBatch  Batch structure
+     *  \param nrFile   Index file path
+     *  \param nrPath   Path to CSPS directory structure
+     *  \param nrCamTag Trigger device CSPS-tag
+     *  \param nrCamMod Trigger module CSPS-name
+     *  \param nrIMUTag Orientation device CSPS-tag
+     *  \param nrIMUMod Orientation module CSPS-name
+     *
+     *  \return Returns LN_SUCCESS on success, an error code otherwise
+     */
+
+    int nr_earth_index ( 
+
+        nr_Batch const * const nrBatch, 
+        char     const * const nrFile, 
+        char     const * const nrPath, 
+        char     const * const nrCamTag, 
+        char     const * const nrCamMod, 
+        char     const * const nrIMUTag, 
+        char     const * const nrIMUMod 
+
+    );
+
+    /*! \brief Batch worker
+     *
+     *  This function is the batch workers main function. It takes the next
+     *  batch entry, imports its mapping, applies the rotation and exports the
+     *  result, until no entry remains.
+     *
+     *  \param nrData Batch structure
+     *
+     *  \return Returns NULL pointer
+     */
+
+    void * nr_earth_worker ( void * nrData );
+
+    /*! \brief Batch list reading
+     *
+     *  This function reads the batch entries from a list file. Each line gives
+     *  the input and output mappings paths and the timestamp seconds and
+     *  micro-seconds, empty lines and lines starting with # being ignored.
+     *
+     *  \param nrBatch Batch structure
+     *  \param nrPath  List file path
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_earth_list ( nr_Batch * const nrBatch, char const * const nrPath );
+
+    /*! \brief Batch directory reading
+     *
+     *  This function creates the batch entries from the mappings of a
+     *  directory, whose names start with the timestamp as seconds and
+     *  micro-seconds separated by an underscore. The outputs are written in
+     *  the output directory under the same names.
+     *
+     *  \param nrBatch  Batch structure
+     *  \param nriPath  Input directory path
+     *  \param nroPath  Output directory path
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_earth_directory ( nr_Batch * const nrBatch, char const * const nriPath, char const * const nroPath );
+
+    /*! \brief Batch entry
+     *
+     *  This function appends an entry to the batch, the paths being copied.
+     *
+     *  \param nrBatch  Batch structure
+     *  \param nriPath  Input mapping path
+     *  \param nroPath  Output mapping path
+     *  \param nrSecond Timestamp seconds
+     *  \param nrMicro  Timestamp micro-seconds
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_earth_add ( 
+
+        nr_Batch       * const nrBatch, 
+        char     const * const nriPath, 
+        char     const * const nroPath, 
+        lp_Time_t        const nrSecond, 
+        lp_Time_t        const nrMicro 
+
+    );
+
+    /*! \brief Batch entries ordering
+     *
+     *  This function is the comparison function used to sort the batch
+     *  entries by timestamp.
+     *
+     *  \param nrA First entry address
+     *  \param nrB Second entry address
+     *
+     *  \return Returns comparison result
+     */
+
+    int nr_earth_order ( void const * nrA, void const * nrB );
+
 /* 
     Header - C/C++ compatibility
  */
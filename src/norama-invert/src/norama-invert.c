@@ -54,24 +54,12 @@
         unsigned char nrGreen = 0;
         unsigned char nrBlue  = 0;
 
-        /* Projection float variables */
-        double nrApper  = 0.0;
-        double nrSightX = 0.0;
-        double nrSightY = 0.0;
-        double nrAzim   = 0.0;
-        double nrHead   = 0.0;
-        double nrElev   = 0.0;
-        double nrRoll   = 0.0;
-        double nrFocal  = 0.0;
-        double nrPixel  = 0.0;
+        /* Projection parameters variables */
+        ln_Gnomonic_t nrGnomonic = { -1, 0.0, 0.0, 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
 
         /* Projection integer variables */
         int nreWidth   = 0;
         int nreHeight  = 0;
-        int nrmWidth   = 0;
-        int nrmHeight  = 0;
-        int nrmCornerX = 0;
-        int nrmCornerY = 0;
 
         /* Exportation options variables */
         int nrOption = -1;
@@ -79,6 +67,15 @@
         /* Parallel processing variables */
         int nrThread = 1;
 
+        /* Projection status variables */
+        int nrStatus = LN_SUCCESS;
+
+        /* Output canvas variables */
+        int nrCanvas = LC_FALSE;
+
+        /* Extension pointer variables */
+        char * nrExt = NULL;
+
         /* Interpolation tag variables */
         char * nrMethod = NULL;
 
@@ -87,35 +84,55 @@
         char * nroPath = NULL;
         char * nriSeed = NULL;
 
-        /* Image allocations variables */
+        /* Image allocation variables */
         IplImage * nriImage = NULL;
         IplImage * nroImage = NULL;
 
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nroDesc;
+
+        /* Modified region variables */
+        ln_Region_t nrRegion;
+
         /* Search in parameters */
-        lc_stdp( lc_stda( argc, argv, "--aperture"     , "-u" ), argv, & nrApper   , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--sight-x"      , "-x" ), argv, & nrSightX  , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--sight-y"      , "-y" ), argv, & nrSightY  , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--azimuth"      , "-a" ), argv, & nrAzim    , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--heading"      , "-d" ), argv, & nrHead    , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--elevation"    , "-e" ), argv, & nrElev    , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--roll"         , "-r" ), argv, & nrRoll    , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--focal"        , "-f" ), argv, & nrFocal   , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--pixel"        , "-p" ), argv, & nrPixel   , LC_DOUBLE );
-        lc_stdp( lc_stda( argc, argv, "--red"          , "-R" ), argv, & nrRed     , LC_UCHAR  );
-        lc_stdp( lc_stda( argc, argv, "--green"        , "-G" ), argv, & nrGreen   , LC_UCHAR  );
-        lc_stdp( lc_stda( argc, argv, "--blue"         , "-B" ), argv, & nrBlue    , LC_UCHAR  );
-        lc_stdp( lc_stda( argc, argv, "--eqr-width"    , "-k" ), argv, & nreWidth  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--eqr-height"   , "-l" ), argv, & nreHeight , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--map-width"    , "-W" ), argv, & nrmWidth  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--map-height"   , "-H" ), argv, & nrmHeight , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--tile-x"       , "-X" ), argv, & nrmCornerX, LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--tile-y"       , "-Y" ), argv, & nrmCornerY, LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrThread  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--export"       , "-q" ), argv, & nrOption  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--input"        , "-i" ), argv, & nriPath   , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--output"       , "-o" ), argv, & nroPath   , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--seed"         , "-s" ), argv, & nriSeed   , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod  , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--aperture"     , "-u" ), argv, & nrGnomonic.gnApper   , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--sight-x"      , "-x" ), argv, & nrGnomonic.gnSightX  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--sight-y"      , "-y" ), argv, & nrGnomonic.gnSightY  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--azimuth"      , "-a" ), argv, & nrGnomonic.gnAzim    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--heading"      , "-d" ), argv, & nrGnomonic.gnHead    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--elevation"    , "-e" ), argv, & nrGnomonic.gnElev    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--roll"         , "-r" ), argv, & nrGnomonic.gnRoll    , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--focal"        , "-f" ), argv, & nrGnomonic.gnFocal   , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--pixel"        , "-p" ), argv, & nrGnomonic.gnPixel   , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--red"          , "-R" ), argv, & nrRed                , LC_UCHAR  );
+        lc_stdp( lc_stda( argc, argv, "--green"        , "-G" ), argv, & nrGreen              , LC_UCHAR  );
+        lc_stdp( lc_stda( argc, argv, "--blue"         , "-B" ), argv, & nrBlue               , LC_UCHAR  );
+        lc_stdp( lc_stda( argc, argv, "--eqr-width"    , "-k" ), argv, & nreWidth             , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--eqr-height"   , "-l" ), argv, & nreHeight            , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--map-width"    , "-W" ), argv, & nrGnomonic.gnmWidth  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--map-height"   , "-H" ), argv, & nrGnomonic.gnmHeight , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--tile-x"       , "-X" ), argv, & nrGnomonic.gnmCornerX, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--tile-y"       , "-Y" ), argv, & nrGnomonic.gnmCornerY, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrThread             , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--export"       , "-q" ), argv, & nrOption             , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--input"        , "-i" ), argv, & nriPath              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"       , "-o" ), argv, & nroPath              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--seed"         , "-s" ), argv, & nriSeed              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod             , LC_STRING );
+
+        /* Select projection model */
+        if ( lc_stda( argc, argv, "--generic" , "-N" ) ) nrGnomonic.gnModel = LN_GENERIC;  else
+        if ( lc_stda( argc, argv, "--elphel"  , "-E" ) ) nrGnomonic.gnModel = LN_ELPHEL;   else
+        if ( lc_stda( argc, argv, "--center"  , "-T" ) ) nrGnomonic.gnModel = LN_CENTER;   else
+        if ( lc_stda( argc, argv, "--complete", "-P" ) ) nrGnomonic.gnModel = LN_COMPLETE;
+
+        /* Convert angles to radian */
+        nrGnomonic.gnApper *= ( LG_PI / 180.0 );
+        nrGnomonic.gnAzim  *= ( LG_PI / 180.0 );
+        nrGnomonic.gnHead  *= ( LG_PI / 180.0 );
+        nrGnomonic.gnElev  *= ( LG_PI / 180.0 );
+        nrGnomonic.gnRoll  *= ( LG_PI / 180.0 );
 
         /* Software swicth */
         if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
@@ -129,12 +146,21 @@
             if ( ( nriPath != NULL ) && ( nroPath != NULL ) ) {
 
                 /* Import input image */
-                nriImage = cvLoadImage( nriPath, lc_stda( argc, argv, "--force-rgb", "-F" ) ? CV_LOAD_IMAGE_COLOR : CV_LOAD_IMAGE_UNCHANGED );
+                nriImage = lc_imread( nriPath, lc_stda( argc, argv, "--force-rgb", "-F" ) ? CV_LOAD_IMAGE_COLOR : CV_LOAD_IMAGE_UNCHANGED );
+
+                /* Detect output raw canvas */
+                nrCanvas = ( ( ( nrExt = strrchr( nroPath, '.' ) ) != NULL ) && ( strcasecmp( nrExt + 1, "nrc" ) == 0 ) ) ? LC_TRUE : LC_FALSE;
 
                 /*  Verify input image reading */
                 if ( nriImage != NULL ) {
 
-                    /* Check for image seed */
+                    /* Check for output canvas */
+                    if ( nrCanvas == LC_TRUE ) {
+
+                        /* Map output canvas */
+                        nroImage = nr_invert_canvas( nroPath, nriSeed, nreWidth, nreHeight, nriImage->nChannels );
+
+                    } else
                     if ( nriSeed == NULL ) {
 
                         /* Create image allocation */
@@ -143,136 +169,51 @@
                     } else {
 
                         /* Load image seed */
-                        nroImage = cvLoadImage( nriSeed, CV_LOAD_IMAGE_UNCHANGED );
+                        nroImage = lc_imread( nriSeed, CV_LOAD_IMAGE_UNCHANGED );
 
                     }
 
                     /* Verify allocation creation */
                     if ( nroImage != NULL ) {
 
+                        /* Compose image descriptors */
+                        nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nriImage->imageData, nriImage->width, nriImage->height, nriImage->nChannels };
+                        nroDesc = ( ln_Image_t ) { ( inter_C8_t * ) nroImage->imageData, nroImage->width, nroImage->height, nroImage->nChannels };
+
                         /* Image initialization swicth */
                         if ( lc_stda( argc, argv, "--clear", "-C" ) ) {
 
                             /* Initialize image background */
-                            cvSet( nroImage, CV_RGB( nrRed, nrGreen, nrBlue ), NULL );
+                            ln_clear( & nroDesc, nrRed, nrGreen, nrBlue );
 
                         }
 
-                        /* Select projection model */
-                        if ( lc_stda( argc, argv, "--generic", "-N" ) ) {
-
-                            /* Projection - generic */
-                            lg_gtt_genericp(
-
-                                ( inter_C8_t * ) nroImage->imageData,
-                                nroImage->width,
-                                nroImage->height,
-                                nroImage->nChannels,
-                                ( inter_C8_t * ) nriImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                nrSightX,
-                                nrSightY,
-                                nrmWidth,
-                                nrmHeight,
-                                nrmCornerX,
-                                nrmCornerY,
-                                nrAzim  * ( LG_PI / 180.0 ),
-                                nrElev  * ( LG_PI / 180.0 ),
-                                nrRoll  * ( LG_PI / 180.0 ),
-                                nrFocal,
-                                nrPixel,
-                                lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                                nrThread
-
-                            );
+                        /* Compute inverted gnomonic projection */
+                        if ( ( nrStatus = ln_invert( & nriDesc, & nroDesc, & nrGnomonic, lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ), nrThread ) ) != LN_SUCCESS ) {
 
-                        } else
-                        if ( lc_stda( argc, argv, "--elphel", "-E" ) ) {
-
-                            /* Projection - elphel-specific */
-                            lg_gtt_elphelp(
-
-                                ( inter_C8_t * ) nroImage->imageData,
-                                nroImage->width,
-                                nroImage->height,
-                                nroImage->nChannels,
-                                ( inter_C8_t * ) nriImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                nrSightX,
-                                nrSightY,
-                                nrmWidth,
-                                nrmHeight,
-                                nrmCornerX,
-                                nrmCornerY,
-                                nrRoll * ( LG_PI / 180.0 ),
-                                nrAzim * ( LG_PI / 180.0 ),
-                                nrElev * ( LG_PI / 180.0 ),
-                                nrHead * ( LG_PI / 180.0 ),
-                                nrPixel,
-                                nrFocal,
-                                lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                                nrThread
-
-                            );
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : %s\n", ln_error( nrStatus ) );
 
                         } else
-                        if ( lc_stda( argc, argv, "--center", "-T" ) ) {
-
-                            /* Projection - center-specific */
-                            lg_gtt_centerp(
-
-                                ( inter_C8_t * ) nroImage->imageData,
-                                nroImage->width,
-                                nroImage->height,
-                                nroImage->nChannels,
-                                ( inter_C8_t * ) nriImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                nrmWidth,
-                                nrmHeight,
-                                nrmCornerX,
-                                nrmCornerY,
-                                nrAzim * ( LG_PI / 180.0 ),
-                                nrElev * ( LG_PI / 180.0 ),
-                                nrRoll * ( LG_PI / 180.0 ),
-                                nrFocal,
-                                nrPixel,
-                                lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                                nrThread
-
-                            );
+                        if ( nrCanvas == LC_TRUE ) {
 
-                        } else
-                        if ( lc_stda( argc, argv, "--complete", "-P" ) ) {
-
-                            /* Projection - aperture-specific */
-                            lg_gte_apperturep( 
-
-                                ( inter_C8_t * ) nroImage->imageData,
-                                nroImage->width,
-                                nroImage->height,
-                                nroImage->nChannels,
-                                ( inter_C8_t * ) nriImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                nrAzim  * ( LG_PI / 180.0 ),
-                                nrElev  * ( LG_PI / 180.0 ),
-                                nrRoll  * ( LG_PI / 180.0 ),
-                                nrApper * ( LG_PI / 180.0 ),
-                                lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                                nrThread
-
-                            );
+                            /* Compute modified region - entire canvas if cleared */
+                            if ( lc_stda( argc, argv, "--clear", "-C" ) || ( ln_footprint( & nrGnomonic, nroImage->width, nroImage->height, nriImage->width, nriImage->height, & nrRegion, nrThread ) != LN_SUCCESS ) ) {
 
-                        }
+                                /* Assign entire canvas */
+                                nrRegion = ( ln_Region_t ) { 0, 0, nroImage->width, nroImage->height };
+
+                            }
+
+                            /* Write modified canvas pages */
+                            if ( lc_canvas_sync( nroImage, cvRect( nrRegion.rgX, nrRegion.rgY, nrRegion.rgWidth, nrRegion.rgHeight ) ) == LC_FALSE ) {
+
+                                /* Display message */
+                                fprintf( LC_ERR, "Error : Unable to write output canvas\n" );
 
-                        /* Export output image */
+                            }
+
+                        } else
                         if ( lc_imwrite( nroPath, nroImage, nrOption ) == 0 ) {
 
                             /* Display message */
@@ -280,14 +221,14 @@
 
                         }
 
-                        /* Release image memory */
-                        cvReleaseImage( & nroImage );
+                        /* Release image memory - unmap output canvas */
+                        lc_imrelease( & nroImage );
 
                     /* Display message */
                     } else { fprintf( LC_ERR, "Error : Unable to create output image or read output image seed\n" ); }
 
                     /* Release image memory */
-                    cvReleaseImage( & nriImage );
+                    lc_imrelease( & nriImage );
 
                 /* Display message */
                 } else { fprintf( LC_ERR, "Error : Unable to read input image\n" ); }
@@ -302,3 +243,58 @@
 
     }
 
+/*
+    Source - Output canvas mapping
+ */
+
+    IplImage * nr_invert_canvas( 
+
+        char const * const nrPath, 
+        char const * const nrSeed, 
+        int          const nrWidth, 
+        int          const nrHeight, 
+        int          const nrLayers 
+
+    ) {
+
+        /* Image variables */
+        IplImage * nrImage = NULL;
+
+        /* Check for canvas seed */
+        if ( nrSeed == NULL ) {
+
+            /* Create zero initialized canvas */
+            return( lc_canvas_create( nrPath, nrWidth, nrHeight, nrLayers ) );
+
+        } else
+        if ( strcmp( nrSeed, nrPath ) == 0 ) {
+
+            /* Map canvas in place */
+            return( lc_canvas_open( nrPath ) );
+
+        } else {
+
+            /* Import canvas seed */
+            if ( ( nrImage = lc_imread( nrSeed, CV_LOAD_IMAGE_UNCHANGED ) ) == NULL ) return( NULL );
+
+            /* Convert canvas seed */
+            if ( lc_canvas_write( nrPath, nrImage ) == 0 ) {
+
+                /* Release image memory */
+                lc_imrelease( & nrImage );
+
+                /* Send message */
+                return( NULL );
+
+            }
+
+            /* Release image memory */
+            lc_imrelease( & nrImage );
+
+            /* Map converted canvas */
+            return( lc_canvas_open( nrPath ) );
+
+        }
+
+    }
+
@@ -99,10 +99,12 @@
 
     # include <stdio.h>
     # include <stdlib.h>
+    # include <string.h>
     # include <opencv/cv.h>
     # include <opencv/highgui.h>
     # include <gnomonic-all.h>
     # include <common-all.h>
+    # include <norama-all.h>
 
 /* 
     Header - Preprocessor definitions
@@ -119,7 +121,7 @@
     "\t-T\tCentered-specific projection\n"                     \
     "\t-P\tAperture-specific projection\n"                     \
     "\t-i\tInput rectilinear image\n"                          \
-    "\t-o\tOutput equirectangular image\n"                     \
+    "\t-o\tOutput equirectangular image or canvas\n"           \
     "\t-s\tOutput equirectangular image seed\n"                \
     "\t-u\tAperture angle [°]\n"                               \
     "\t-x\tProjection x-sight in floating pixels\n"            \
@@ -166,7 +168,9 @@
      *  The main function is responsible for input image importation and output
      *  image initialization. According to parameters, the invert gnomonic
      *  projection algorithm is called and the computed output image is then
-     *  exported.
+     *  exported. Raw canvas outputs are mapped in memory and only the pages of
+     *  the projection footprint are written back, the canvas being converted
+     *  to a standard format by norama-convert.
      *  
      *  \param argc Standard main parameter
      *  \param argv Standard main parameter
@@ -174,6 +178,34 @@
 
     int main ( int argc, char ** argv );
 
+    /*! \brief Output canvas mapping
+     *
+     *  This function maps the output raw canvas in memory, allowing the
+     *  inverted projection to be written in place. If the seed is the output
+     *  canvas itself, the canvas is mapped as is and the projection is
+     *  composited on its content. If another seed is provided, it is imported
+     *  and converted in the output canvas before mapping. Without seed, a
+     *  zero initialized canvas of the provided size is created.
+     *
+     *  \param nrPath   Output canvas path
+     *  \param nrSeed   Output canvas seed path, NULL if none
+     *  \param nrWidth  Output canvas width, in pixels
+     *  \param nrHeight Output canvas height, in pixels
+     *  \param nrLayers Output canvas layers count
+     *
+     *  \return Returns mapped canvas image, NULL on failure
+     */
+
+    IplImage * nr_invert_canvas ( 
+
+        char const * const nrPath, 
+        char const * const nrSeed, 
+        int          const nrWidth, 
+        int          const nrHeight, 
+        int          const nrLayers 
+
+    );
+
 /* 
     Header - C/C++ compatibility
  */
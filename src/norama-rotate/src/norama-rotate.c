@@ -60,6 +60,9 @@
         /* Parallel processing variables */
         int nrThread = 1;
 
+        /* Transformation status variables */
+        int nrStatus = LN_SUCCESS;
+
         /* Interpolation descriptor variables */
         char * nrMethod = NULL;
 
@@ -71,6 +74,10 @@
         IplImage * nriImage = NULL;
         IplImage * nroImage = NULL;
 
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nroDesc;
+
         /* Search in parameters */
         lc_stdp( lc_stda( argc, argv, "--input"        , "-i" ), argv, & nriPath , LC_STRING );
         lc_stdp( lc_stda( argc, argv, "--output"       , "-o" ), argv, & nroPath , LC_STRING );
@@ -93,7 +100,7 @@
             if ( ( nriPath != NULL ) && ( nroPath != NULL ) ) {
 
                 /* Import input image */
-                nriImage = cvLoadImage( nriPath, CV_LOAD_IMAGE_UNCHANGED );
+                nriImage = lc_imread( nriPath, CV_LOAD_IMAGE_UNCHANGED );
 
                 /*  Verify input image reading */
                 if ( nriImage != NULL ) {
@@ -104,23 +111,17 @@
                     /* Verify allocation creation */
                     if ( nroImage != NULL ) {
 
+                        /* Compose image descriptors */
+                        nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nriImage->imageData, nriImage->width, nriImage->height, nriImage->nChannels };
+                        nroDesc = ( ln_Image_t ) { ( inter_C8_t * ) nroImage->imageData, nroImage->width, nroImage->height, nroImage->nChannels };
+
                         /* Apply equirectangular transform */
-                        lg_transform_rotatep( 
-
-                            ( inter_C8_t * ) nriImage->imageData,
-                            ( inter_C8_t * ) nroImage->imageData,
-                            nriImage->width,
-                            nriImage->height,
-                            nriImage->nChannels,
-                            nrAzim * ( LG_PI / 180.0 ),
-                            nrElev * ( LG_PI / 180.0 ),
-                            nrRoll * ( LG_PI / 180.0 ),
-                            lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ),
-                            nrThread
-
-                        );
-
-                        /* Export output image */
+                        if ( ( nrStatus = ln_rotate( & nriDesc, & nroDesc, nrAzim * ( LG_PI / 180.0 ), nrElev * ( LG_PI / 180.0 ), nrRoll * ( LG_PI / 180.0 ), lc_method( nrMethod == NULL ? "bicubicf" : nrMethod ), nrThread ) ) != LN_SUCCESS ) {
+
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : %s\n", ln_error( nrStatus ) );
+
+                        } else
                         if ( lc_imwrite( nroPath, nroImage, nrOption ) == 0 ) {
 
                             /* Display message */
@@ -129,13 +130,13 @@
                         }
 
                         /* Release image memory */
-                        cvReleaseImage( & nroImage );
+                        lc_imrelease( & nroImage );
 
                     /* Display message */
                     } else { fprintf( LC_ERR, "Error : Unable to create output image\n" ); }
 
                     /* Release image memory */
-                    cvReleaseImage( & nriImage );
+                    lc_imrelease( & nriImage );
 
                 /* Display message */
                 } else { fprintf( LC_ERR, "Error : Unable to read input image\n" ); }
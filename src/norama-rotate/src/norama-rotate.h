@@ -103,6 +103,7 @@
     # include <opencv/highgui.h>
     # include <gnomonic-all.h>
     # include <common-all.h>
+    # include <norama-all.h>
 
 /* 
     Header - Preprocessor definitions
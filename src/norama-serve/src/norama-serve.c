@@ -0,0 +1,1668 @@
+/*
+ * norama suite - Panorama tools suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama-serve.h"
+
+/*
+    Source - Server termination flag
+ */
+
+    static volatile sig_atomic_t nr_serve_stop = 0;
+
+    static void nr_serve_signal( int nrSignal ) {
+
+        /* Request event loop termination */
+        nr_serve_stop = 1;
+
+    }
+
+/*
+    Source - Software main function
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Server port variables */
+        int nrPort = NR_DFT_PORT;
+
+        /* Memory budgets variables */
+        int nrMemory = NR_DFT_MEMORY;
+        int nrCache  = NR_DFT_CACHE;
+
+        /* Root directory variables */
+        char * nrRoot = NULL;
+
+        /* Interpolation tag variables */
+        char * nrMethod = NULL;
+
+        /* Server state variables */
+        static nr_Serve nrServe;
+
+        /* Initialize server state */
+        memset( & nrServe, 0, sizeof( nr_Serve ) );
+
+        /* Assign default configuration */
+        nrServe.svTile    = NR_DFT_TILE;
+        nrServe.svQuality = NR_DFT_QUALITY;
+        nrServe.svThread  = NR_DFT_THREAD;
+        nrServe.svWorker  = NR_DFT_WORKER;
+
+        /* Search in parameters */
+        lc_stdp( lc_stda( argc, argv, "--root"         , "-r" ), argv, & nrRoot            , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--port"         , "-p" ), argv, & nrPort            , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--workers"      , "-w" ), argv, & nrServe.svWorker  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrServe.svThread  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--memory"       , "-m" ), argv, & nrMemory          , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--cache"        , "-c" ), argv, & nrCache           , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--tile"         , "-z" ), argv, & nrServe.svTile    , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--quality"      , "-q" ), argv, & nrServe.svQuality , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod          , LC_STRING );
+
+        /* Software swicth */
+        if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
+
+            /* Display usage */
+            fprintf( stdout, NR_HELP );
+
+        } else {
+
+            /* Verify configuration */
+            if ( ( nrRoot == NULL ) || ( nrServe.svTile <= 0 ) || ( nrServe.svWorker <= 0 ) || ( nrServe.svThread <= 0 ) ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : Invalid root directory, tile size, workers or threads specification\n" ); return( EXIT_FAILURE );
+
+            }
+
+            /* Assign configuration */
+            nrServe.svRoot   = nrRoot;
+            nrServe.svMethod = lc_method( nrMethod == NULL ? "bilinearf" : nrMethod );
+
+            /* Compute memory budgets */
+            nrServe.svPanoBudget = ( size_t ) ( nrMemory < 0 ? 0 : nrMemory ) * 1024 * 1024;
+            nrServe.svBudget     = ( size_t ) ( nrCache  < 0 ? 0 : nrCache  ) * 1024 * 1024;
+
+            /* Start server */
+            return( nr_serve_server( & nrServe, nrPort ) );
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Server
+ */
+
+    int nr_serve_server( nr_Serve * const nrServe, int const nrPort ) {
+
+        /* Socket address variables */
+        struct sockaddr_in nrAddress;
+
+        /* Socket option variables */
+        int nrReuse = 1;
+
+        /* Event loop variables */
+        struct epoll_event nrEvent;
+        struct epoll_event nrEvents[NR_EVENTS];
+
+        /* Event count variables */
+        int nrCount = 0;
+
+        /* Signal action variables */
+        struct sigaction nrAction;
+
+        /* Workers variables */
+        pthread_t * nrWorker = NULL;
+        int         nrActive = 0;
+
+        /* Signal masks variables */
+        sigset_t nrBlock;
+        sigset_t nrMask;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Release variables */
+        nr_Connect * nrConnect = NULL;
+        nr_Job     * nrJob     = NULL;
+
+        /* Create listening socket, event loop and completion descriptor */
+        nrServe->svListen = socket( AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0 );
+        nrServe->svPoll   = epoll_create1( 0 );
+        nrServe->svEvent  = eventfd( 0, EFD_NONBLOCK );
+
+        /* Verify descriptors */
+        if ( ( nrServe->svListen < 0 ) || ( nrServe->svPoll < 0 ) || ( nrServe->svEvent < 0 ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to create server descriptors\n" ); return( EXIT_FAILURE );
+
+        }
+
+        /* Allow immediate server restart */
+        setsockopt( nrServe->svListen, SOL_SOCKET, SO_REUSEADDR, & nrReuse, sizeof( nrReuse ) );
+
+        /* Compose socket address */
+        memset( & nrAddress, 0, sizeof( nrAddress ) );
+
+        /* Assign socket address - loopback only */
+        nrAddress.sin_family      = AF_INET;
+        nrAddress.sin_port        = htons( nrPort );
+        nrAddress.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+
+        /* Bind and listen socket */
+        if ( ( bind( nrServe->svListen, ( struct sockaddr * ) & nrAddress, sizeof( nrAddress ) ) < 0 ) || ( listen( nrServe->svListen, NR_BACKLOG ) < 0 ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to bind server socket\n" );
+
+            /* Close descriptors */
+            close( nrServe->svListen ); close( nrServe->svPoll ); close( nrServe->svEvent ); return( EXIT_FAILURE );
+
+        }
+
+        /* Register listening socket */
+        nrEvent.events = EPOLLIN; nrEvent.data.ptr = NULL;
+
+        /* Register listening socket */
+        epoll_ctl( nrServe->svPoll, EPOLL_CTL_ADD, nrServe->svListen, & nrEvent );
+
+        /* Register completion descriptor */
+        nrEvent.events = EPOLLIN; nrEvent.data.ptr = & nrServe->svEvent;
+
+        /* Register completion descriptor */
+        epoll_ctl( nrServe->svPoll, EPOLL_CTL_ADD, nrServe->svEvent, & nrEvent );
+
+        /* Initialize synchronization */
+        pthread_mutex_init( & nrServe->svLock    , NULL );
+        pthread_mutex_init( & nrServe->svPanoLock, NULL );
+        pthread_cond_init ( & nrServe->svWake    , NULL );
+        pthread_cond_init ( & nrServe->svPanoWake, NULL );
+
+        /* Compose signal action */
+        memset( & nrAction, 0, sizeof( nrAction ) );
+
+        /* Assign signal handler - interrupt event loop waiting */
+        nrAction.sa_handler = & nr_serve_signal;
+
+        /* Install signal handlers */
+        sigaction( SIGINT , & nrAction, NULL );
+        sigaction( SIGTERM, & nrAction, NULL );
+
+        /* Ignore broken connections */
+        signal( SIGPIPE, SIG_IGN );
+
+        /* Compose workers signal mask - signals have to interrupt the event loop */
+        sigemptyset( & nrBlock ); sigaddset( & nrBlock, SIGINT ); sigaddset( & nrBlock, SIGTERM );
+
+        /* Block signals for workers */
+        pthread_sigmask( SIG_BLOCK, & nrBlock, & nrMask );
+
+        /* Allocate workers */
+        if ( ( nrWorker = ( pthread_t * ) malloc( sizeof( pthread_t ) * nrServe->svWorker ) ) != NULL ) {
+
+            /* Start workers */
+            while ( ( nrActive < nrServe->svWorker ) && ( pthread_create( nrWorker + nrActive, NULL, & nr_serve_worker, nrServe ) == 0 ) ) nrActive ++;
+
+        }
+
+        /* Restore event loop signal mask */
+        pthread_sigmask( SIG_SETMASK, & nrMask, NULL );
+
+        /* Verify workers */
+        if ( nrActive == 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : Unable to start render workers\n" );
+
+            /* Raise termination flag */
+            nr_serve_stop = 1;
+
+        }
+
+        /* Event loop */
+        while ( nr_serve_stop == 0 ) {
+
+            /* Wait for events */
+            if ( ( nrCount = epoll_wait( nrServe->svPoll, nrEvents, NR_EVENTS, -1 ) ) < 0 ) continue;
+
+            /* Process events */
+            for ( nrParse = 0; nrParse < nrCount; nrParse ++ ) {
+
+                /* Retrieve event connection */
+                nrConnect = ( nr_Connect * ) nrEvents[nrParse].data.ptr;
+
+                /* Switch on event source */
+                if ( nrConnect == NULL ) {
+
+                    /* Accept connections */
+                    nr_serve_accept( nrServe );
+
+                } else
+                if ( nrEvents[nrParse].data.ptr == & nrServe->svEvent ) {
+
+                    /* Process completed jobs */
+                    nr_serve_complete( nrServe );
+
+                } else
+                if ( nrConnect->cnSocket < 0 ) {
+
+                    /* Connection closed earlier in the batch */
+                    continue;
+
+                } else
+                if ( nrEvents[nrParse].events & ( EPOLLERR | EPOLLHUP ) ) {
+
+                    /* Close connection */
+                    nr_serve_close( nrServe, nrConnect );
+
+                } else
+                if ( nrConnect->cnState == NR_READ ) {
+
+                    /* Read connection - also detects peer closure */
+                    nr_serve_read( nrServe, nrConnect );
+
+                } else
+                if ( ( nrConnect->cnState == NR_WRITE ) && ( nrEvents[nrParse].events & EPOLLOUT ) ) {
+
+                    /* Write connection */
+                    nr_serve_write( nrServe, nrConnect );
+
+                } else
+                if ( nrEvents[nrParse].events & EPOLLRDHUP ) {
+
+                    /* Close connection */
+                    nr_serve_close( nrServe, nrConnect );
+
+                }
+
+            }
+
+            /* Release connections closed in the batch */
+            nr_serve_reap( nrServe );
+
+        }
+
+        /* Raise workers termination flag */
+        pthread_mutex_lock( & nrServe->svLock ); nrServe->svStop = 1; pthread_cond_broadcast( & nrServe->svWake ); pthread_mutex_unlock( & nrServe->svLock );
+
+        /* Wait workers termination */
+        for ( nrParse = 0; nrParse < nrActive; nrParse ++ ) pthread_join( nrWorker[nrParse], NULL );
+
+        /* Release workers */
+        free( nrWorker );
+
+        /* Release closed connections */
+        nr_serve_reap( nrServe );
+
+        /* Release connections */
+        while ( ( nrConnect = nrServe->svConnect ) != NULL ) {
+
+            /* Unlink connection */
+            nrServe->svConnect = nrConnect->cnNext;
+
+            /* Close connection socket */
+            if ( nrConnect->cnSocket >= 0 ) close( nrConnect->cnSocket );
+
+            /* Release connection response */
+            if ( nrConnect->cnResponse != NULL ) nr_serve_unref( nrConnect->cnResponse );
+
+            /* Release connection */
+            free( nrConnect );
+
+        }
+
+        /* Release jobs - queued, processed and completed jobs are all in flight */
+        while ( ( nrJob = nrServe->svFlight ) != NULL ) {
+
+            /* Unlink job */
+            nrServe->svFlight = nrJob->jbFlight;
+
+            /* Release job response */
+            if ( nrJob->jbResponse != NULL ) nr_serve_unref( nrJob->jbResponse );
+
+            /* Release job */
+            free( nrJob->jbKey ); free( nrJob );
+
+        }
+
+        /* Release cached responses */
+        while ( nrServe->svHead != NULL ) {
+
+            /* Unlink response */
+            nrServe->svHead = ( nrServe->svTail = nrServe->svHead )->rsNext;
+
+            /* Release response */
+            nr_serve_unref( nrServe->svTail );
+
+        }
+
+        /* Release decoded panoramas */
+        for ( nrParse = 0; nrParse < NR_PANO_SLOT; nrParse ++ ) {
+
+            /* Release panorama */
+            if ( nrServe->svPano[nrParse].pnImage != NULL ) lc_imrelease( & nrServe->svPano[nrParse].pnImage );
+
+        }
+
+        /* Release synchronization */
+        pthread_mutex_destroy( & nrServe->svLock     );
+        pthread_mutex_destroy( & nrServe->svPanoLock );
+        pthread_cond_destroy ( & nrServe->svWake     );
+        pthread_cond_destroy ( & nrServe->svPanoWake );
+
+        /* Close descriptors */
+        close( nrServe->svListen ); close( nrServe->svPoll ); close( nrServe->svEvent );
+
+        /* Return to system */
+        return( nrActive == 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Event loop - connection acceptance
+ */
+
+    void nr_serve_accept( nr_Serve * const nrServe ) {
+
+        /* Socket descriptor variables */
+        int nrSocket = -1;
+
+        /* Connection variables */
+        nr_Connect * nrConnect = NULL;
+
+        /* Event variables */
+        struct epoll_event nrEvent;
+
+        /* Accept pending connections */
+        while ( ( nrSocket = accept( nrServe->svListen, NULL, NULL ) ) >= 0 ) {
+
+            /* Allocate connection */
+            if ( ( nrConnect = ( nr_Connect * ) malloc( sizeof( nr_Connect ) ) ) == NULL ) {
+
+                /* Drop connection */
+                close( nrSocket ); continue;
+
+            }
+
+            /* Assign connection state */
+            nrConnect->cnSocket   = nrSocket;
+            nrConnect->cnState    = NR_READ;
+            nrConnect->cnKeep     = LC_FALSE;
+            nrConnect->cnSize     = 0;
+            nrConnect->cnResponse = NULL;
+            nrConnect->cnOffset   = 0;
+            nrConnect->cnWait     = NULL;
+            nrConnect->cnPrev     = NULL;
+
+            /* Link connection */
+            if ( ( nrConnect->cnNext = nrServe->svConnect ) != NULL ) nrServe->svConnect->cnPrev = nrConnect;
+
+            /* Link connection */
+            nrServe->svConnect = nrConnect;
+
+            /* Set connection non-blocking */
+            fcntl( nrSocket, F_SETFL, fcntl( nrSocket, F_GETFL, 0 ) | O_NONBLOCK );
+
+            /* Compose connection event */
+            nrEvent.events = EPOLLIN | EPOLLRDHUP; nrEvent.data.ptr = nrConnect;
+
+            /* Register connection */
+            if ( epoll_ctl( nrServe->svPoll, EPOLL_CTL_ADD, nrSocket, & nrEvent ) < 0 ) nr_serve_close( nrServe, nrConnect );
+
+        }
+
+    }
+
+/*
+    Source - Event loop - connection reading
+ */
+
+    void nr_serve_read( nr_Serve * const nrServe, nr_Connect * const nrConnect ) {
+
+        /* Reading variables */
+        ssize_t nrRead = 0;
+
+        /* Read available bytes - one byte kept for termination */
+        while ( nrConnect->cnSize < NR_REQ_SIZE - 1 ) {
+
+            /* Read connection */
+            if ( ( nrRead = read( nrConnect->cnSocket, nrConnect->cnBuffer + nrConnect->cnSize, NR_REQ_SIZE - 1 - nrConnect->cnSize ) ) > 0 ) {
+
+                /* Update buffer size */
+                nrConnect->cnSize += nrRead;
+
+            } else
+            if ( ( nrRead < 0 ) && ( errno == EINTR ) ) {
+
+                /* Retry reading */
+                continue;
+
+            } else
+            if ( ( nrRead < 0 ) && ( ( errno == EAGAIN ) || ( errno == EWOULDBLOCK ) ) ) {
+
+                /* Wait for more bytes */
+                break;
+
+            } else {
+
+                /* Close connection */
+                nr_serve_close( nrServe, nrConnect ); return;
+
+            }
+
+        }
+
+        /* Process buffered request */
+        nr_serve_request( nrServe, nrConnect );
+
+    }
+
+/*
+    Source - Event loop - request processing
+ */
+
+    void nr_serve_request( nr_Serve * const nrServe, nr_Connect * const nrConnect ) {
+
+        /* Request decomposition variables */
+        char * nrEnd    = NULL;
+        char * nrTarget = NULL;
+        char * nrProto  = NULL;
+        char * nrLine   = NULL;
+
+        /* Request size variables */
+        size_t nrSize = 0;
+
+        /* Status variables */
+        int nrStatus = 0;
+
+        /* Job variables */
+        nr_Job * nrJob = NULL;
+
+        /* Response variables */
+        nr_Response * nrResponse = NULL;
+
+        /* Terminate buffer */
+        nrConnect->cnBuffer[nrConnect->cnSize] = '\0';
+
+        /* Search request end */
+        if ( ( nrEnd = strstr( nrConnect->cnBuffer, "\r\n\r\n" ) ) == NULL ) {
+
+            /* Check buffer overflow */
+            if ( nrConnect->cnSize == NR_REQ_SIZE - 1 ) {
+
+                /* Send error and close after */
+                nrConnect->cnKeep = LC_FALSE; nrConnect->cnSize = 0; nr_serve_send( nrServe, nrConnect, nrResponse = nr_serve_error( 400 ) );
+
+                /* Release response */
+                if ( nrResponse != NULL ) nr_serve_unref( nrResponse );
+
+            }
+
+            /* Wait for more bytes */
+            return;
+
+        }
+
+        /* Compute request size */
+        nrSize = nrEnd - nrConnect->cnBuffer + 4;
+
+        /* Terminate request */
+        nrEnd[2] = '\0';
+
+        /* Decompose request line */
+        if ( ( nrTarget = strchr( nrConnect->cnBuffer, ' ' ) ) != NULL ) {
+
+            /* Terminate method */
+            * ( nrTarget ++ ) = '\0';
+
+            /* Search protocol */
+            if ( ( nrProto = strchr( nrTarget, ' ' ) ) != NULL ) * ( nrProto ++ ) = '\0';
+
+        }
+
+        /* Search request line end */
+        if ( ( nrLine = strstr( nrProto == NULL ? nrConnect->cnBuffer : nrProto, "\r\n" ) ) != NULL ) * ( nrLine ++ ) = '\0';
+
+        /* Assign protocol default keep-alive */
+        nrConnect->cnKeep = ( nrProto != NULL ) && ( strcmp( nrProto, "HTTP/1.1" ) == 0 ) ? LC_TRUE : LC_FALSE;
+
+        /* Search connection header */
+        while ( ( nrLine != NULL ) && ( * ( ++ nrLine ) != '\0' ) ) {
+
+            /* Detect connection header */
+            if ( strncasecmp( nrLine, "Connection:", 11 ) == 0 ) {
+
+                /* Skip header name and spaces */
+                for ( nrLine += 11; * nrLine == ' '; nrLine ++ );
+
+                /* Update keep-alive */
+                if ( strncasecmp( nrLine, "close"     , 5  ) == 0 ) nrConnect->cnKeep = LC_FALSE;
+                if ( strncasecmp( nrLine, "keep-alive", 10 ) == 0 ) nrConnect->cnKeep = LC_TRUE;
+
+            }
+
+            /* Search next header */
+            if ( ( nrLine = strstr( nrLine, "\r\n" ) ) != NULL ) nrLine ++;
+
+        }
+
+        /* Allocate job */
+        if ( ( nrJob = ( nr_Job * ) malloc( sizeof( nr_Job ) ) ) == NULL ) {
+
+            /* Assign status */
+            nrStatus = 500;
+
+        } else
+        if ( ( nrProto == NULL ) || ( strcmp( nrConnect->cnBuffer, "GET" ) != 0 ) ) {
+
+            /* Assign status */
+            nrStatus = ( nrProto == NULL ) ? 400 : 405;
+
+        } else {
+
+            /* Route request */
+            nrStatus = nr_serve_route( nrServe, nrTarget, nrJob );
+
+        }
+
+        /* Discard request bytes */
+        memmove( nrConnect->cnBuffer, nrConnect->cnBuffer + nrSize, nrConnect->cnSize -= nrSize );
+
+        /* Check routing status */
+        if ( nrStatus != 200 ) {
+
+            /* Release job */
+            free( nrJob );
+
+            /* Send error */
+            nr_serve_send( nrServe, nrConnect, nrResponse = nr_serve_error( nrStatus ) );
+
+            /* Release response */
+            if ( nrResponse != NULL ) nr_serve_unref( nrResponse );
+
+        } else
+        if ( ( nrResponse = nr_serve_cache_find( nrServe, nrJob->jbKey ) ) != NULL ) {
+
+            /* Release job */
+            free( nrJob->jbKey ); free( nrJob );
+
+            /* Send cached response */
+            nr_serve_send( nrServe, nrConnect, nrResponse );
+
+        } else {
+
+            /* Search identical job in flight */
+            for ( nrJob->jbFlight = nrServe->svFlight; nrJob->jbFlight != NULL; nrJob->jbFlight = nrJob->jbFlight->jbFlight ) {
+
+                /* Compare request keys */
+                if ( ( nrJob->jbFlight->jbHash == nrJob->jbHash ) && ( strcmp( nrJob->jbFlight->jbKey, nrJob->jbKey ) == 0 ) ) break;
+
+            }
+
+            /* Update connection state */
+            nrConnect->cnState = NR_WAIT;
+
+            /* Watch connection closure only while waiting */
+            nr_serve_watch( nrServe, nrConnect, EPOLLRDHUP );
+
+            /* Check job in flight */
+            if ( nrJob->jbFlight != NULL ) {
+
+                /* Wait for job in flight */
+                nrConnect->cnWait = nrJob->jbFlight->jbWait; nrJob->jbFlight->jbWait = nrConnect;
+
+                /* Release job */
+                free( nrJob->jbKey ); free( nrJob );
+
+            } else {
+
+                /* Assign job waiting connection */
+                nrJob->jbWait = nrConnect; nrConnect->cnWait = NULL;
+
+                /* Initialize job */
+                nrJob->jbResponse = NULL; nrJob->jbNext = NULL;
+
+                /* Insert job in flight */
+                nrJob->jbFlight = nrServe->svFlight; nrServe->svFlight = nrJob;
+
+                /* Queue job */
+                pthread_mutex_lock( & nrServe->svLock );
+
+                /* Append job to worker queue */
+                if ( nrServe->svLast == NULL ) nrServe->svQueue = nrJob; else nrServe->svLast->jbNext = nrJob;
+
+                /* Update queue tail */
+                nrServe->svLast = nrJob;
+
+                /* Wake a worker */
+                pthread_cond_signal( & nrServe->svWake );
+
+                /* Release queue */
+                pthread_mutex_unlock( & nrServe->svLock );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Event loop - request routing
+ */
+
+    int nr_serve_route( nr_Serve * const nrServe, char * const nrTarget, nr_Job * const nrJob ) {
+
+        /* Request decomposition variables */
+        char * nrQuery = NULL;
+        char * nrName  = NULL;
+        char * nrFace  = NULL;
+        char * nrLevel = NULL;
+        char * nrFile  = NULL;
+
+        /* Decoding variables */
+        char * nrRead  = nrTarget;
+        char * nrWrite = nrTarget;
+        char   nrHex[3] = { 0 };
+
+        /* View parameters variables */
+        double nrAzim   = 0.0;
+        double nrElev   = 0.0;
+        double nrRoll   = 0.0;
+        double nrApper  = NR_DFT_APPER;
+        double nrWidth  = NR_DFT_WIDTH;
+        double nrHeight = NR_DFT_HEIGHT;
+
+        /* Tile extension variables */
+        char nrExt[4] = { 0 };
+
+        /* Key buffer variables */
+        char nrKey[NR_REQ_PATH + 256];
+
+        /* Separate query string */
+        if ( ( nrQuery = strchr( nrTarget, '?' ) ) != NULL ) * ( nrQuery ++ ) = '\0';
+
+        /* Decode target path */
+        while ( * nrRead != '\0' ) {
+
+            /* Detect percent-encoded character */
+            if ( ( nrRead[0] == '%' ) && isxdigit( nrRead[1] ) && isxdigit( nrRead[2] ) ) {
+
+                /* Decode character */
+                nrHex[0] = nrRead[1]; nrHex[1] = nrRead[2]; * ( nrWrite ++ ) = strtol( nrHex, NULL, 16 ); nrRead += 3;
+
+            /* Copy character */
+            } else { * ( nrWrite ++ ) = * ( nrRead ++ ); }
+
+        } * nrWrite = '\0';
+
+        /* Switch on request type */
+        if ( strncmp( nrTarget, "/view/", 6 ) == 0 ) {
+
+            /* Assign panorama name */
+            nrName = nrTarget + 6;
+
+            /* Search view parameters - malformed or non-finite values refused */
+            if ( nr_serve_parameter( nrQuery, "azimuth"  , & nrAzim   ) == LC_FALSE ) return( 400 );
+            if ( nr_serve_parameter( nrQuery, "elevation", & nrElev   ) == LC_FALSE ) return( 400 );
+            if ( nr_serve_parameter( nrQuery, "roll"     , & nrRoll   ) == LC_FALSE ) return( 400 );
+            if ( nr_serve_parameter( nrQuery, "aperture" , & nrApper  ) == LC_FALSE ) return( 400 );
+            if ( nr_serve_parameter( nrQuery, "width"    , & nrWidth  ) == LC_FALSE ) return( 400 );
+            if ( nr_serve_parameter( nrQuery, "height"   , & nrHeight ) == LC_FALSE ) return( 400 );
+
+            /* Verify view parameters */
+            if ( ( nrWidth < 1 ) || ( nrWidth > NR_REQ_VIEW ) || ( nrHeight < 1 ) || ( nrHeight > NR_REQ_VIEW ) ) return( 400 );
+
+            /* Verify view size integrality */
+            if ( ( nrWidth != floor( nrWidth ) ) || ( nrHeight != floor( nrHeight ) ) ) return( 400 );
+
+            /* Verify view aperture */
+            if ( ( nrApper <= 0.0 ) || ( nrApper >= 180.0 ) ) return( 400 );
+
+            /* Assign view job */
+            nrJob->jbType   = NR_VIEW;
+            nrJob->jbFormat = ".jpg";
+            nrJob->jbAzim   = nrAzim  * ( LG_PI / 180.0 );
+            nrJob->jbElev   = nrElev  * ( LG_PI / 180.0 );
+            nrJob->jbRoll   = nrRoll  * ( LG_PI / 180.0 );
+            nrJob->jbApper  = nrApper * ( LG_PI / 180.0 );
+            nrJob->jbWidth  = ( int ) nrWidth;
+            nrJob->jbHeight = ( int ) nrHeight;
+
+            /* Compose canonical key */
+            snprintf( nrKey, sizeof( nrKey ), "view:%s:%.6f:%.6f:%.6f:%.6f:%d:%d", nrName, nrAzim, nrElev, nrRoll, nrApper, nrJob->jbWidth, nrJob->jbHeight );
+
+        } else
+        if ( strncmp( nrTarget, "/tile/", 6 ) == 0 ) {
+
+            /* Assign panorama name */
+            nrName = nrTarget + 6;
+
+            /* Decompose tile path from its end */
+            if ( ( nrFile  = strrchr( nrName, '/' ) ) == NULL ) return( 404 ); else * ( nrFile  ++ ) = '\0';
+            if ( ( nrFace  = strrchr( nrName, '/' ) ) == NULL ) return( 404 ); else * ( nrFace  ++ ) = '\0';
+            if ( ( nrLevel = strrchr( nrName, '/' ) ) == NULL ) return( 404 ); else * ( nrLevel ++ ) = '\0';
+
+            /* Decompose tile file name */
+            if ( sscanf( nrFile, "%d_%d.%3s", & nrJob->jbRow, & nrJob->jbCol, nrExt ) != 3 ) return( 404 );
+
+            /* Decompose tile level */
+            if ( sscanf( nrLevel, "%d", & nrJob->jbLevel ) != 1 ) return( 404 );
+
+            /* Verify tile face */
+            if ( ( strlen( nrFace ) != 1 ) || ( strchr( LN_FACES_TAGS, nrFace[0] ) == NULL ) ) return( 404 );
+
+            /* Verify tile level and position */
+            if ( ( nrJob->jbLevel < 0 ) || ( nrJob->jbLevel > NR_REQ_LEVEL ) ) return( 404 );
+
+            /* Verify tile position */
+            if ( ( nrJob->jbRow < 0 ) || ( nrJob->jbRow >= ( 1 << nrJob->jbLevel ) ) || ( nrJob->jbCol < 0 ) || ( nrJob->jbCol >= ( 1 << nrJob->jbLevel ) ) ) return( 404 );
+
+            /* Select tile format */
+            if ( strcmp( nrExt, "jpg" ) == 0 ) nrJob->jbFormat = ".jpg"; else
+            if ( strcmp( nrExt, "png" ) == 0 ) nrJob->jbFormat = ".png"; else return( 404 );
+
+            /* Assign tile job */
+            nrJob->jbType = NR_TILE;
+            nrJob->jbFace = strchr( LN_FACES_TAGS, nrFace[0] ) - LN_FACES_TAGS;
+
+            /* Compose canonical key */
+            snprintf( nrKey, sizeof( nrKey ), "tile:%s:%d:%c:%d:%d:%s", nrName, nrJob->jbLevel, nrFace[0], nrJob->jbRow, nrJob->jbCol, nrExt );
+
+        /* Unknown request */
+        } else { return( 404 ); }
+
+        /* Verify panorama name - restricted to root directory */
+        if ( ( nrName[0] == '\0' ) || ( nrName[0] == '/' ) || ( strstr( nrName, ".." ) != NULL ) ) return( 404 );
+
+        /* Compose panorama path */
+        if ( snprintf( nrJob->jbPath, NR_REQ_PATH, "%s/%s", nrServe->svRoot, nrName ) >= NR_REQ_PATH ) return( 404 );
+
+        /* Assign job key */
+        if ( ( nrJob->jbKey = strdup( nrKey ) ) == NULL ) return( 500 );
+
+        /* Compute key hash */
+        nrJob->jbHash = nr_serve_hash( nrJob->jbKey );
+
+        /* Return status */
+        return( 200 );
+
+    }
+
+/*
+    Source - Event loop - response sending
+ */
+
+    void nr_serve_send( nr_Serve * const nrServe, nr_Connect * const nrConnect, nr_Response * const nrResponse ) {
+
+        /* Check response */
+        if ( nrResponse == NULL ) {
+
+            /* Close connection */
+            nrConnect->cnState = NR_READ; nr_serve_close( nrServe, nrConnect ); return;
+
+        }
+
+        /* Attach response */
+        ( nrConnect->cnResponse = nrResponse )->rsCount ++;
+
+        /* Reset response offset */
+        nrConnect->cnOffset = 0;
+
+        /* Update connection state */
+        nrConnect->cnState = NR_WRITE;
+
+        /* Write response */
+        nr_serve_write( nrServe, nrConnect );
+
+    }
+
+/*
+    Source - Event loop - connection writing
+ */
+
+    void nr_serve_write( nr_Serve * const nrServe, nr_Connect * const nrConnect ) {
+
+        /* Writing variables */
+        ssize_t nrWrite = 0;
+
+        /* Write pending bytes */
+        while ( nrConnect->cnOffset < nrConnect->cnResponse->rsSize ) {
+
+            /* Write connection */
+            if ( ( nrWrite = send( nrConnect->cnSocket, nrConnect->cnResponse->rsData + nrConnect->cnOffset, nrConnect->cnResponse->rsSize - nrConnect->cnOffset, MSG_NOSIGNAL ) ) > 0 ) {
+
+                /* Update offset */
+                nrConnect->cnOffset += nrWrite;
+
+            } else
+            if ( ( nrWrite < 0 ) && ( errno == EINTR ) ) {
+
+                /* Retry writing */
+                continue;
+
+            } else
+            if ( ( nrWrite < 0 ) && ( ( errno == EAGAIN ) || ( errno == EWOULDBLOCK ) ) ) {
+
+                /* Wait for socket availability */
+                nr_serve_watch( nrServe, nrConnect, EPOLLOUT | EPOLLRDHUP ); return;
+
+            } else {
+
+                /* Close connection */
+                nr_serve_close( nrServe, nrConnect ); return;
+
+            }
+
+        }
+
+        /* Release response */
+        nr_serve_unref( nrConnect->cnResponse ); nrConnect->cnResponse = NULL;
+
+        /* Check keep-alive */
+        if ( nrConnect->cnKeep == LC_TRUE ) {
+
+            /* Update connection state */
+            nrConnect->cnState = NR_READ;
+
+            /* Watch connection requests */
+            nr_serve_watch( nrServe, nrConnect, EPOLLIN | EPOLLRDHUP );
+
+            /* Process already buffered request */
+            if ( nrConnect->cnSize > 0 ) nr_serve_request( nrServe, nrConnect );
+
+        } else {
+
+            /* Close connection */
+            nr_serve_close( nrServe, nrConnect );
+
+        }
+
+    }
+
+/*
+    Source - Event loop - connection events
+ */
+
+    void nr_serve_watch( nr_Serve * const nrServe, nr_Connect * const nrConnect, uint32_t const nrEvents ) {
+
+        /* Event variables */
+        struct epoll_event nrEvent;
+
+        /* Compose connection event */
+        nrEvent.events = nrEvents; nrEvent.data.ptr = nrConnect;
+
+        /* Update connection event */
+        epoll_ctl( nrServe->svPoll, EPOLL_CTL_MOD, nrConnect->cnSocket, & nrEvent );
+
+    }
+
+/*
+    Source - Event loop - connection closure
+ */
+
+    void nr_serve_close( nr_Serve * const nrServe, nr_Connect * const nrConnect ) {
+
+        /* Check opened socket */
+        if ( nrConnect->cnSocket >= 0 ) {
+
+            /* Remove socket from event loop */
+            epoll_ctl( nrServe->svPoll, EPOLL_CTL_DEL, nrConnect->cnSocket, NULL );
+
+            /* Close socket */
+            close( nrConnect->cnSocket );
+
+        }
+
+        /* Invalidate socket */
+        nrConnect->cnSocket = -1;
+
+        /* Keep waiting connection until job completion */
+        if ( nrConnect->cnState == NR_WAIT ) return;
+
+        /* Release response */
+        if ( nrConnect->cnResponse != NULL ) nr_serve_unref( nrConnect->cnResponse );
+
+        /* Invalidate response */
+        nrConnect->cnResponse = NULL;
+
+        /* Unlink connection */
+        if ( nrConnect->cnPrev != NULL ) nrConnect->cnPrev->cnNext = nrConnect->cnNext; else nrServe->svConnect = nrConnect->cnNext;
+
+        /* Unlink connection */
+        if ( nrConnect->cnNext != NULL ) nrConnect->cnNext->cnPrev = nrConnect->cnPrev;
+
+        /* Move connection in closed list - released after the batch */
+        nrConnect->cnPrev = NULL; nrConnect->cnNext = nrServe->svZombie; nrServe->svZombie = nrConnect;
+
+    }
+
+    void nr_serve_reap( nr_Serve * const nrServe ) {
+
+        /* Connection variables */
+        nr_Connect * nrConnect = NULL;
+
+        /* Release closed connections */
+        while ( ( nrConnect = nrServe->svZombie ) != NULL ) {
+
+            /* Unlink connection */
+            nrServe->svZombie = nrConnect->cnNext;
+
+            /* Release connection */
+            free( nrConnect );
+
+        }
+
+    }
+
+/*
+    Source - Event loop - jobs completion
+ */
+
+    void nr_serve_complete( nr_Serve * const nrServe ) {
+
+        /* Notification variables */
+        uint64_t nrNotify = 0;
+
+        /* Jobs variables */
+        nr_Job  * nrJob  = NULL;
+        nr_Job  * nrNext = NULL;
+        nr_Job ** nrLink = NULL;
+
+        /* Connection variables */
+        nr_Connect * nrConnect = NULL;
+
+        /* Reset notification */
+        if ( read( nrServe->svEvent, & nrNotify, sizeof( nrNotify ) ) < 0 ) nrNotify = 0;
+
+        /* Retrieve completed jobs */
+        pthread_mutex_lock( & nrServe->svLock ); nrJob = nrServe->svDone; nrServe->svDone = NULL; pthread_mutex_unlock( & nrServe->svLock );
+
+        /* Process completed jobs */
+        for ( ; nrJob != NULL; nrJob = nrNext ) {
+
+            /* Retrieve next job */
+            nrNext = nrJob->jbNext;
+
+            /* Search job in flight */
+            for ( nrLink = & nrServe->svFlight; ( * nrLink != NULL ) && ( * nrLink != nrJob ); nrLink = & ( * nrLink )->jbFlight );
+
+            /* Remove job from flight */
+            if ( * nrLink != NULL ) * nrLink = nrJob->jbFlight;
+
+            /* Store response in cache */
+            if ( ( nrJob->jbResponse != NULL ) && ( nrJob->jbResponse->rsKey != NULL ) ) nr_serve_cache_store( nrServe, nrJob->jbResponse );
+
+            /* Process waiting connections */
+            while ( ( nrConnect = nrJob->jbWait ) != NULL ) {
+
+                /* Unlink waiting connection */
+                nrJob->jbWait = nrConnect->cnWait; nrConnect->cnWait = NULL;
+
+                /* Update connection state */
+                nrConnect->cnState = NR_READ;
+
+                /* Check connection closure */
+                if ( nrConnect->cnSocket < 0 ) {
+
+                    /* Release connection */
+                    nr_serve_close( nrServe, nrConnect );
+
+                } else {
+
+                    /* Send response */
+                    nr_serve_send( nrServe, nrConnect, nrJob->jbResponse );
+
+                }
+
+            }
+
+            /* Release job response */
+            if ( nrJob->jbResponse != NULL ) nr_serve_unref( nrJob->jbResponse );
+
+            /* Release job */
+            free( nrJob->jbKey ); free( nrJob );
+
+        }
+
+    }
+
+/*
+    Source - Render worker
+ */
+
+    void * nr_serve_worker( void * nrData ) {
+
+        /* Server state variables */
+        nr_Serve * nrServe = ( nr_Serve * ) nrData;
+
+        /* Job variables */
+        nr_Job * nrJob = NULL;
+
+        /* Notification variables */
+        uint64_t nrNotify = 1;
+
+        /* Worker loop */
+        for ( ; ; ) {
+
+            /* Wait for job */
+            pthread_mutex_lock( & nrServe->svLock );
+
+            /* Wait for job or termination */
+            while ( ( nrServe->svQueue == NULL ) && ( nrServe->svStop == 0 ) ) pthread_cond_wait( & nrServe->svWake, & nrServe->svLock );
+
+            /* Check termination */
+            if ( nrServe->svStop != 0 ) {
+
+                /* Terminate worker */
+                pthread_mutex_unlock( & nrServe->svLock ); break;
+
+            }
+
+            /* Pop queued job */
+            if ( ( nrServe->svQueue = ( nrJob = nrServe->svQueue )->jbNext ) == NULL ) nrServe->svLast = NULL;
+
+            /* Release queue */
+            pthread_mutex_unlock( & nrServe->svLock );
+
+            /* Render job */
+            nrJob->jbResponse = nr_serve_render( nrServe, nrJob );
+
+            /* Push completed job */
+            pthread_mutex_lock( & nrServe->svLock ); nrJob->jbNext = nrServe->svDone; nrServe->svDone = nrJob; pthread_mutex_unlock( & nrServe->svLock );
+
+            /* Notify event loop */
+            if ( write( nrServe->svEvent, & nrNotify, sizeof( nrNotify ) ) < 0 ) fprintf( LC_ERR, "Error : Unable to notify job completion\n" );
+
+        }
+
+        /* Return to thread */
+        return( NULL );
+
+    }
+
+/*
+    Source - Render worker - job rendering
+ */
+
+    nr_Response * nr_serve_render( nr_Serve * const nrServe, nr_Job * const nrJob ) {
+
+        /* Projection parameters variables */
+        ln_Gnomonic_t nrGnomonic = { LN_COMPLETE, 0.0, 0.0, 0, 0, 0, 0, nrJob->jbAzim, 0.0, nrJob->jbElev, nrJob->jbRoll, nrJob->jbApper, 0.0, 0.0 };
+
+        /* Encoding parameters variables */
+        int nrParam[3] = { CV_IMWRITE_JPEG_QUALITY, nrServe->svQuality, 0 };
+
+        /* Status variables */
+        int nrStatus = LN_SUCCESS;
+
+        /* Panorama variables */
+        nr_Panorama * nrPanorama = NULL;
+
+        /* Image variables */
+        IplImage * nrImage = NULL;
+
+        /* Packed rendering buffer variables */
+        inter_C8_t * nrPacked = NULL;
+
+        /* Row size variables */
+        size_t nrSpan = 0;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Encoding variables */
+        CvMat * nrEncode = NULL;
+
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+        ln_Image_t nroDesc;
+
+        /* Response variables */
+        nr_Response * nrResponse = NULL;
+
+        /* Load panorama */
+        if ( ( nrPanorama = nr_serve_pano_load( nrServe, nrJob->jbPath ) ) == NULL ) return( nr_serve_error( 404 ) );
+
+        /* Create rendered image */
+        if ( nrJob->jbType == NR_VIEW ) {
+
+            /* Create view image */
+            nrImage = cvCreateImage( cvSize( nrJob->jbWidth, nrJob->jbHeight ), IPL_DEPTH_8U, nrPanorama->pnImage->nChannels );
+
+        } else {
+
+            /* Create tile image */
+            nrImage = cvCreateImage( cvSize( nrServe->svTile, nrServe->svTile ), IPL_DEPTH_8U, nrPanorama->pnImage->nChannels );
+
+        }
+
+        /* Verify image creation */
+        if ( nrImage == NULL ) {
+
+            /* Release panorama */
+            nr_serve_pano_release( nrServe, nrPanorama ); return( nr_serve_error( 500 ) );
+
+        }
+
+        /* Compute packed row size */
+        nrSpan = ( size_t ) nrImage->width * nrImage->nChannels;
+
+        /* Check image rows padding - descriptors expect packed rows */
+        if ( ( size_t ) nrImage->widthStep != nrSpan ) {
+
+            /* Allocate packed rendering buffer */
+            if ( ( nrPacked = ( inter_C8_t * ) malloc( nrSpan * nrImage->height ) ) == NULL ) {
+
+                /* Release image memory */
+                lc_imrelease( & nrImage );
+
+                /* Release panorama */
+                nr_serve_pano_release( nrServe, nrPanorama ); return( nr_serve_error( 500 ) );
+
+            }
+
+        }
+
+        /* Compose image descriptors */
+        nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nrPanorama->pnImage->imageData, nrPanorama->pnImage->width, nrPanorama->pnImage->height, nrPanorama->pnImage->nChannels };
+        nroDesc = ( ln_Image_t ) { nrPacked != NULL ? nrPacked : ( inter_C8_t * ) nrImage->imageData, nrImage->width, nrImage->height, nrImage->nChannels };
+
+        /* Render job */
+        if ( nrJob->jbType == NR_VIEW ) {
+
+            /* Compute rectilinear view */
+            nrStatus = ln_direct( & nriDesc, & nroDesc, & nrGnomonic, nrServe->svMethod, nrServe->svThread );
+
+        } else {
+
+            /* Compute cube face tile */
+            nrStatus = ln_cube_tile( & nriDesc, & nroDesc, nrJob->jbFace, nrServe->svTile << nrJob->jbLevel, nrJob->jbCol * nrServe->svTile, nrJob->jbRow * nrServe->svTile, nrServe->svMethod, nrServe->svThread );
+
+        }
+
+        /* Release panorama */
+        nr_serve_pano_release( nrServe, nrPanorama );
+
+        /* Check packed rendering buffer */
+        if ( nrPacked != NULL ) {
+
+            /* Copy rendered rows into padded image rows */
+            for ( nrParse = 0; nrParse < nrImage->height; nrParse ++ ) memcpy( nrImage->imageData + ( size_t ) nrParse * nrImage->widthStep, nrPacked + nrSpan * nrParse, nrSpan );
+
+            /* Release packed rendering buffer */
+            free( nrPacked );
+
+        }
+
+        /* Encode rendered image */
+        if ( nrStatus == LN_SUCCESS ) {
+
+            /* Encode image */
+            if ( ( nrEncode = cvEncodeImage( nrJob->jbFormat, nrImage, strcmp( nrJob->jbFormat, ".jpg" ) == 0 ? nrParam : NULL ) ) != NULL ) {
+
+                /* Compose response */
+                nrResponse = nr_serve_response( 200, strcmp( nrJob->jbFormat, ".jpg" ) == 0 ? "image/jpeg" : "image/png", nrEncode->data.ptr, ( size_t ) nrEncode->rows * nrEncode->cols );
+
+                /* Release encoded image */
+                cvReleaseMat( & nrEncode );
+
+            }
+
+        }
+
+        /* Release rendered image */
+        lc_imrelease( & nrImage );
+
+        /* Check response */
+        if ( nrResponse == NULL ) return( nr_serve_error( 500 ) );
+
+        /* Assign response key - cacheable response */
+        if ( ( nrResponse->rsKey = strdup( nrJob->jbKey ) ) != NULL ) nrResponse->rsHash = nrJob->jbHash;
+
+        /* Return response */
+        return( nrResponse );
+
+    }
+
+/*
+    Source - Response creation
+ */
+
+    nr_Response * nr_serve_response( int const nrStatus, char const * const nrType, void const * const nrContent, size_t const nrSize ) {
+
+        /* Header variables */
+        char nrHeader[512];
+        int  nrLength = 0;
+
+        /* Response variables */
+        nr_Response * nrResponse = NULL;
+
+        /* Compose response header */
+        nrLength = snprintf( nrHeader, sizeof( nrHeader ), 
+
+            "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nCache-Control: %s\r\n\r\n", 
+            nrStatus, 
+            nr_serve_reason( nrStatus ), 
+            nrType, 
+            nrSize, 
+            nrStatus == 200 ? "public, max-age=86400" : "no-store"
+
+        );
+
+        /* Allocate response */
+        if ( ( nrResponse = ( nr_Response * ) malloc( sizeof( nr_Response ) ) ) == NULL ) return( NULL );
+
+        /* Allocate response bytes */
+        if ( ( nrResponse->rsData = ( char * ) malloc( nrLength + nrSize ) ) == NULL ) {
+
+            /* Release response */
+            free( nrResponse ); return( NULL );
+
+        }
+
+        /* Compose response bytes */
+        memcpy( nrResponse->rsData, nrHeader, nrLength ); memcpy( nrResponse->rsData + nrLength, nrContent, nrSize );
+
+        /* Assign response */
+        nrResponse->rsKey   = NULL;
+        nrResponse->rsHash  = 0;
+        nrResponse->rsSize  = nrLength + nrSize;
+        nrResponse->rsCount = 1;
+        nrResponse->rsPrev  = NULL;
+        nrResponse->rsNext  = NULL;
+
+        /* Return response */
+        return( nrResponse );
+
+    }
+
+/*
+    Source - Response - reason phrase
+ */
+
+    char const * nr_serve_reason( int const nrStatus ) {
+
+        /* Switch on status code */
+        switch ( nrStatus ) {
+
+            case ( 200 ) : return( "OK"                    );
+            case ( 400 ) : return( "Bad Request"           );
+            case ( 404 ) : return( "Not Found"             );
+            case ( 405 ) : return( "Method Not Allowed"    );
+            case ( 500 ) : return( "Internal Server Error" );
+
+        }
+
+        /* Unknown status code */
+        return( "Unknown" );
+
+    }
+
+/*
+    Source - Response - error
+ */
+
+    nr_Response * nr_serve_error( int const nrStatus ) {
+
+        /* Content variables */
+        char nrContent[64];
+
+        /* Compose error content */
+        snprintf( nrContent, sizeof( nrContent ), "%d %s\n", nrStatus, nr_serve_reason( nrStatus ) );
+
+        /* Return response */
+        return( nr_serve_response( nrStatus, "text/plain", nrContent, strlen( nrContent ) ) );
+
+    }
+
+/*
+    Source - Response - reference release
+ */
+
+    void nr_serve_unref( nr_Response * const nrResponse ) {
+
+        /* Release reference */
+        if ( ( -- nrResponse->rsCount ) > 0 ) return;
+
+        /* Release response */
+        free( nrResponse->rsKey ); free( nrResponse->rsData ); free( nrResponse );
+
+    }
+
+/*
+    Source - Cache - response search
+ */
+
+    nr_Response * nr_serve_cache_find( nr_Serve * const nrServe, char const * const nrKey ) {
+
+        /* Key hash variables */
+        uint64_t nrHash = nr_serve_hash( nrKey );
+
+        /* Response variables */
+        nr_Response * nrResponse = nrServe->svHead;
+
+        /* Search response */
+        while ( ( nrResponse != NULL ) && ( ( nrResponse->rsHash != nrHash ) || ( strcmp( nrResponse->rsKey, nrKey ) != 0 ) ) ) nrResponse = nrResponse->rsNext;
+
+        /* Check response and position */
+        if ( ( nrResponse == NULL ) || ( nrResponse == nrServe->svHead ) ) return( nrResponse );
+
+        /* Unlink response */
+        nrResponse->rsPrev->rsNext = nrResponse->rsNext;
+
+        /* Unlink response */
+        if ( nrResponse->rsNext != NULL ) nrResponse->rsNext->rsPrev = nrResponse->rsPrev; else nrServe->svTail = nrResponse->rsPrev;
+
+        /* Insert response as most recently used */
+        nrResponse->rsPrev = NULL; nrResponse->rsNext = nrServe->svHead; nrServe->svHead->rsPrev = nrResponse; nrServe->svHead = nrResponse;
+
+        /* Return response */
+        return( nrResponse );
+
+    }
+
+/*
+    Source - Cache - response insertion
+ */
+
+    void nr_serve_cache_store( nr_Serve * const nrServe, nr_Response * const nrResponse ) {
+
+        /* Eviction variables */
+        nr_Response * nrEvict = NULL;
+
+        /* Check response size */
+        if ( nrResponse->rsSize > nrServe->svBudget ) return;
+
+        /* Take response reference */
+        nrResponse->rsCount ++;
+
+        /* Insert response as most recently used */
+        if ( ( nrResponse->rsNext = nrServe->svHead ) != NULL ) nrServe->svHead->rsPrev = nrResponse; else nrServe->svTail = nrResponse;
+
+        /* Insert response as most recently used */
+        nrResponse->rsPrev = NULL; nrServe->svHead = nrResponse;
+
+        /* Update cache usage */
+        nrServe->svUsage += nrResponse->rsSize;
+
+        /* Evict least recently used responses */
+        while ( nrServe->svUsage > nrServe->svBudget ) {
+
+            /* Unlink least recently used response */
+            if ( ( nrServe->svTail = ( nrEvict = nrServe->svTail )->rsPrev ) != NULL ) nrServe->svTail->rsNext = NULL; else nrServe->svHead = NULL;
+
+            /* Update cache usage */
+            nrServe->svUsage -= nrEvict->rsSize;
+
+            /* Release cache reference */
+            nr_serve_unref( nrEvict );
+
+        }
+
+    }
+
+/*
+    Source - Panoramas - loading
+ */
+
+    nr_Panorama * nr_serve_pano_load( nr_Serve * const nrServe, char const * const nrPath ) {
+
+        /* File status variables */
+        struct stat nrStat;
+
+        /* Slot variables */
+        nr_Panorama * nrSlot = NULL;
+        nr_Panorama * nrEvict = NULL;
+
+        /* Image variables */
+        IplImage * nrImage = NULL;
+
+        /* Memory usage variables */
+        size_t nrUsage = 0;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Retrieve file status */
+        if ( ( stat( nrPath, & nrStat ) != 0 ) || ( S_ISREG( nrStat.st_mode ) == 0 ) ) return( NULL );
+
+        /* Lock panoramas */
+        pthread_mutex_lock( & nrServe->svPanoLock );
+
+        /* Search panorama slot */
+        for ( nrParse = 0; nrParse < NR_PANO_SLOT; nrParse ++ ) {
+
+            /* Assign slot */
+            nrSlot = nrServe->svPano + nrParse;
+
+            /* Compare file identity */
+            if ( ( nrSlot->pnTime != nrStat.st_mtim.tv_sec ) || ( nrSlot->pnNano != nrStat.st_mtim.tv_nsec ) || ( nrSlot->pnSize != nrStat.st_size ) ) continue;
+
+            /* Compare file path */
+            if ( strcmp( nrSlot->pnPath, nrPath ) != 0 ) continue;
+
+            /* Check decoding in progress */
+            if ( nrSlot->pnImage == NULL ) {
+
+                /* Wait for decoding end and search again */
+                pthread_cond_wait( & nrServe->svPanoWake, & nrServe->svPanoLock ); nrParse = -1; continue;
+
+            }
+
+            /* Use panorama slot */
+            nrSlot->pnCount ++; nrSlot->pnUsed = ++ nrServe->svPanoTick;
+
+            /* Unlock panoramas */
+            pthread_mutex_unlock( & nrServe->svPanoLock );
+
+            /* Return panorama slot */
+            return( nrSlot );
+
+        }
+
+        /* Search free or least recently used unused slot */
+        for ( nrSlot = NULL, nrParse = 0; nrParse < NR_PANO_SLOT; nrParse ++ ) {
+
+            /* Check free slot */
+            if ( nrServe->svPano[nrParse].pnPath[0] == '\0' ) { nrSlot = nrServe->svPano + nrParse; break; }
+
+            /* Check unused slot */
+            if ( ( nrServe->svPano[nrParse].pnCount == 0 ) && ( ( nrSlot == NULL ) || ( nrServe->svPano[nrParse].pnUsed < nrSlot->pnUsed ) ) ) nrSlot = nrServe->svPano + nrParse;
+
+        }
+
+        /* Check slot availability */
+        if ( nrSlot == NULL ) {
+
+            /* Unlock panoramas */
+            pthread_mutex_unlock( & nrServe->svPanoLock ); return( NULL );
+
+        }
+
+        /* Release evicted panorama */
+        if ( nrSlot->pnImage != NULL ) lc_imrelease( & nrSlot->pnImage );
+
+        /* Reserve slot for decoding */
+        strcpy( nrSlot->pnPath, nrPath );
+
+        /* Reserve slot for decoding */
+        nrSlot->pnTime  = nrStat.st_mtim.tv_sec;
+        nrSlot->pnNano  = nrStat.st_mtim.tv_nsec;
+        nrSlot->pnSize  = nrStat.st_size;
+        nrSlot->pnCount = 1;
+        nrSlot->pnUsed  = ++ nrServe->svPanoTick;
+
+        /* Unlock panoramas */
+        pthread_mutex_unlock( & nrServe->svPanoLock );
+
+        /* Decode panorama - outside of lock */
+        nrImage = lc_imread( nrPath, CV_LOAD_IMAGE_COLOR );
+
+        /* Lock panoramas */
+        pthread_mutex_lock( & nrServe->svPanoLock );
+
+        /* Check decoding */
+        if ( nrImage == NULL ) {
+
+            /* Free slot */
+            nrSlot->pnPath[0] = '\0'; nrSlot->pnCount = 0; nrSlot = NULL;
+
+        } else {
+
+            /* Assign decoded panorama */
+            nrSlot->pnImage = nrImage;
+
+            /* Evict least recently used panoramas */
+            do {
+
+                /* Reset memory usage */
+                nrUsage = 0; nrEvict = NULL;
+
+                /* Compute memory usage and eviction candidate */
+                for ( nrParse = 0; nrParse < NR_PANO_SLOT; nrParse ++ ) {
+
+                    /* Check decoded panorama */
+                    if ( nrServe->svPano[nrParse].pnImage == NULL ) continue;
+
+                    /* Update memory usage */
+                    nrUsage += nrServe->svPano[nrParse].pnImage->imageSize;
+
+                    /* Check eviction candidate */
+                    if ( ( nrServe->svPano[nrParse].pnCount == 0 ) && ( ( nrEvict == NULL ) || ( nrServe->svPano[nrParse].pnUsed < nrEvict->pnUsed ) ) ) nrEvict = nrServe->svPano + nrParse;
+
+                }
+
+                /* Evict panorama */
+                if ( ( nrUsage > nrServe->svPanoBudget ) && ( nrEvict != NULL ) ) {
+
+                    /* Release panorama and free slot */
+                    lc_imrelease( & nrEvict->pnImage ); nrEvict->pnPath[0] = '\0';
+
+                }
+
+            } while ( ( nrUsage > nrServe->svPanoBudget ) && ( nrEvict != NULL ) );
+
+        }
+
+        /* Wake workers waiting for decoding */
+        pthread_cond_broadcast( & nrServe->svPanoWake );
+
+        /* Unlock panoramas */
+        pthread_mutex_unlock( & nrServe->svPanoLock );
+
+        /* Return panorama slot */
+        return( nrSlot );
+
+    }
+
+/*
+    Source - Panoramas - release
+ */
+
+    void nr_serve_pano_release( nr_Serve * const nrServe, nr_Panorama * const nrPanorama ) {
+
+        /* Release panorama slot */
+        pthread_mutex_lock( & nrServe->svPanoLock ); nrPanorama->pnCount --; pthread_mutex_unlock( & nrServe->svPanoLock );
+
+    }
+
+/*
+    Source - Request key hash
+ */
+
+    uint64_t nr_serve_hash( char const * nrKey ) {
+
+        /* Hash variables - FNV-1a */
+        uint64_t nrHash = 14695981039346656037ULL;
+
+        /* Hash key characters */
+        while ( * nrKey != '\0' ) nrHash = ( nrHash ^ ( unsigned char ) * ( nrKey ++ ) ) * 1099511628211ULL;
+
+        /* Return hash */
+        return( nrHash );
+
+    }
+
+/*
+    Source - Request parameter
+ */
+
+    int nr_serve_parameter( char const * const nrQuery, char const * const nrName, double * const nrValue ) {
+
+        /* Parameter name length variables */
+        size_t nrLength = strlen( nrName );
+
+        /* Parsing variables */
+        char const * nrParse = nrQuery;
+
+        /* Conversion end variables */
+        char * nrEnd = NULL;
+
+        /* Search parameter */
+        while ( ( nrParse != NULL ) && ( * nrParse != '\0' ) ) {
+
+            /* Compare parameter name */
+            if ( ( strncmp( nrParse, nrName, nrLength ) == 0 ) && ( nrParse[nrLength] == '=' ) ) {
+
+                /* Convert parameter value */
+                * nrValue = strtod( nrParse + nrLength + 1, & nrEnd );
+
+                /* Verify value consumption and finiteness */
+                return( ( nrEnd != nrParse + nrLength + 1 ) && ( ( * nrEnd == '\0' ) || ( * nrEnd == '&' ) ) && isfinite( * nrValue ) ? LC_TRUE : LC_FALSE );
+
+            }
+
+            /* Search next parameter */
+            if ( ( nrParse = strchr( nrParse, '&' ) ) != NULL ) nrParse ++;
+
+        }
+
+        /* Parameter not found - value unchanged */
+        return( LC_TRUE );
+
+    }
+
@@ -0,0 +1,797 @@
+/*
+ * norama suite - Panorama tools suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama-serve.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Software main header
+     */
+
+    /*! \mainpage norama-serve
+     *
+     *  \section norama-suite
+     *  \section _ Panorama tools suite
+     *
+     *  This software suite offers tools for numerical panoramas manipulation.
+     *  Mostly designed for equirectangular mappings, its role is to provide an 
+     *  interface to libgnomonic and its algorithms. It then offers an interface
+     *  to projection and transformation features implemented in the gnomonic 
+     *  library. The norama-suite is also interfaced with libcsps in order to 
+     *  take advantage of camera motion tracking to operate and align panoramas
+     *  on earth. It also comes with a panorama viewer to complete the suite. 
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/norama-suite/wiki
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __NR_SERVE__
+    # define __NR_SERVE__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <math.h>
+    # include <string.h>
+    # include <strings.h>
+    # include <errno.h>
+    # include <fcntl.h>
+    # include <signal.h>
+    # include <unistd.h>
+    # include <pthread.h>
+    # include <stdint.h>
+    # include <ctype.h>
+    # include <sys/stat.h>
+    # include <sys/types.h>
+    # include <sys/socket.h>
+    # include <sys/epoll.h>
+    # include <sys/eventfd.h>
+    # include <netinet/in.h>
+    # include <arpa/inet.h>
+    # include <opencv/cv.h>
+    # include <opencv/highgui.h>
+    # include <gnomonic-all.h>
+    # include <common-all.h>
+    # include <norama-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Standard help */
+    # define NR_HELP "Usage summary :\n\n"                                   \
+    "\tnorama-serve [Arguments] [Parameters] ...\n\n"                        \
+    "Short arguments and parameters summary :\n\n"                           \
+    "\t-r\tPanoramas root directory\n"                                       \
+    "\t-p\tHTTP port, bound on localhost\n"                                  \
+    "\t-w\tNumber of render workers\n"                                       \
+    "\t-t\tNumber of threads used by each render\n"                          \
+    "\t-m\tDecoded panoramas memory size, in megabytes\n"                    \
+    "\t-c\tEncoded responses cache size, in megabytes\n"                     \
+    "\t-z\tPyramid tiles size, in pixels\n"                                  \
+    "\t-q\tJPEG encoding quality\n"                                          \
+    "\t-n\tInterpolation method\n\n"                                         \
+    "Requests summary :\n\n"                                                 \
+    "\t/view/[panorama]?azimuth=&elevation=&roll=&aperture=&width=&height=\n" \
+    "\t/tile/[panorama]/[level]/[face]/[row]_[column].[jpg|png]\n\n"         \
+    "norama-serve - norama-suite\n"                                          \
+    "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
+
+    /* Define default values */
+    # define NR_DFT_PORT    8080
+    # define NR_DFT_WORKER  4
+    # define NR_DFT_THREAD  1
+    # define NR_DFT_MEMORY  4096
+    # define NR_DFT_CACHE   256
+    # define NR_DFT_TILE    512
+    # define NR_DFT_QUALITY 85
+
+    /* Define default view */
+    # define NR_DFT_APPER   90.0
+    # define NR_DFT_WIDTH   1024
+    # define NR_DFT_HEIGHT  768
+
+    /* Define request constraints */
+    # define NR_REQ_SIZE    8192
+    # define NR_REQ_PATH    4096
+    # define NR_REQ_VIEW    8192
+    # define NR_REQ_LEVEL   16
+
+    /* Define event loop constraints */
+    # define NR_EVENTS      256
+    # define NR_BACKLOG     512
+
+    /* Define panorama cache constraints */
+    # define NR_PANO_SLOT   32
+
+    /* Define request types */
+    # define NR_VIEW        0
+    # define NR_TILE        1
+
+    /* Define connection states */
+    # define NR_READ        0
+    # define NR_WAIT        1
+    # define NR_WRITE       2
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct nr_Response_struct
+     *  \brief Encoded response
+     *
+     *  This structure holds a complete HTTP response, status line and headers
+     *  included, ready to be written on connections. Responses are shared by
+     *  the cache and the connections writing them through a reference counter
+     *  only manipulated by the event loop.
+     *
+     *  \var nr_Response_struct::rsKey
+     *  Canonical request key, NULL for uncached responses
+     *  \var nr_Response_struct::rsHash
+     *  Canonical request key hash
+     *  \var nr_Response_struct::rsData
+     *  Response bytes
+     *  \var nr_Response_struct::rsSize
+     *  Response size, in bytes
+     *  \var nr_Response_struct::rsCount
+     *  Reference counter
+     *  \var nr_Response_struct::rsPrev
+     *  Previous response in cache order, more recently used
+     *  \var nr_Response_struct::rsNext
+     *  Next response in cache order, less recently used
+     */
+
+    typedef struct nr_Response_struct {
+
+        char   * rsKey;
+        uint64_t rsHash;
+        char   * rsData;
+        size_t   rsSize;
+        int      rsCount;
+
+        struct nr_Response_struct * rsPrev;
+        struct nr_Response_struct * rsNext;
+
+    } nr_Response;
+
+    /*! \struct nr_Connect_struct
+     *  \brief Client connection
+     *
+     *  This structure holds the state of a client connection handled by the
+     *  event loop. A connection reads a request, waits for its response if it
+     *  has to be rendered, and writes it before reading the next request when
+     *  the connection is kept alive.
+     *
+     *  \var nr_Connect_struct::cnSocket
+     *  Connection socket descriptor, negative once closed
+     *  \var nr_Connect_struct::cnState
+     *  Connection state
+     *  \var nr_Connect_struct::cnKeep
+     *  Keep-alive flag of the current request
+     *  \var nr_Connect_struct::cnBuffer
+     *  Request bytes buffer
+     *  \var nr_Connect_struct::cnSize
+     *  Request bytes count
+     *  \var nr_Connect_struct::cnResponse
+     *  Response being written
+     *  \var nr_Connect_struct::cnOffset
+     *  Response bytes already written
+     *  \var nr_Connect_struct::cnWait
+     *  Next connection waiting for the same render job
+     *  \var nr_Connect_struct::cnPrev
+     *  Previous connection in server connections list
+     *  \var nr_Connect_struct::cnNext
+     *  Next connection in server connections list
+     */
+
+    typedef struct nr_Connect_struct {
+
+        int           cnSocket;
+        int           cnState;
+        int           cnKeep;
+        char          cnBuffer[NR_REQ_SIZE];
+        size_t        cnSize;
+        nr_Response * cnResponse;
+        size_t        cnOffset;
+
+        struct nr_Connect_struct * cnWait;
+        struct nr_Connect_struct * cnPrev;
+        struct nr_Connect_struct * cnNext;
+
+    } nr_Connect;
+
+    /*! \struct nr_Job_struct
+     *  \brief Render job
+     *
+     *  This structure describes a view or tile render. Jobs are identified by
+     *  their canonical key so that identical requests arriving while a job is
+     *  in flight wait on the same job instead of rendering it again.
+     *
+     *  \var nr_Job_struct::jbKey
+     *  Canonical request key
+     *  \var nr_Job_struct::jbHash
+     *  Canonical request key hash
+     *  \var nr_Job_struct::jbType
+     *  Request type, view or tile
+     *  \var nr_Job_struct::jbPath
+     *  Panorama file path
+     *  \var nr_Job_struct::jbFormat
+     *  Encoding extension, ".jpg" or ".png"
+     *  \var nr_Job_struct::jbAzim
+     *  View azimuth angle, in radians
+     *  \var nr_Job_struct::jbElev
+     *  View elevation angle, in radians
+     *  \var nr_Job_struct::jbRoll
+     *  View roll angle, in radians
+     *  \var nr_Job_struct::jbApper
+     *  View aperture angle, in radians
+     *  \var nr_Job_struct::jbWidth
+     *  View width, in pixels
+     *  \var nr_Job_struct::jbHeight
+     *  View height, in pixels
+     *  \var nr_Job_struct::jbFace
+     *  Tile cube face
+     *  \var nr_Job_struct::jbLevel
+     *  Tile pyramid level
+     *  \var nr_Job_struct::jbRow
+     *  Tile row in face
+     *  \var nr_Job_struct::jbCol
+     *  Tile column in face
+     *  \var nr_Job_struct::jbResponse
+     *  Rendered response
+     *  \var nr_Job_struct::jbWait
+     *  Connections waiting for the job
+     *  \var nr_Job_struct::jbNext
+     *  Next job in worker queue or completion list
+     *  \var nr_Job_struct::jbFlight
+     *  Next job in flight
+     */
+
+    typedef struct nr_Job_struct {
+
+        char        * jbKey;
+        uint64_t      jbHash;
+        int           jbType;
+        char          jbPath[NR_REQ_PATH];
+        char const  * jbFormat;
+        double        jbAzim;
+        double        jbElev;
+        double        jbRoll;
+        double        jbApper;
+        int           jbWidth;
+        int           jbHeight;
+        int           jbFace;
+        int           jbLevel;
+        int           jbRow;
+        int           jbCol;
+        nr_Response * jbResponse;
+        nr_Connect  * jbWait;
+
+        struct nr_Job_struct * jbNext;
+        struct nr_Job_struct * jbFlight;
+
+    } nr_Job;
+
+    /*! \struct nr_Panorama_struct
+     *  \brief Decoded panorama slot
+     *
+     *  This structure holds a decoded panorama shared by the render workers.
+     *  The slot is identified by path and file modification time. A slot in
+     *  use by at least one worker is never evicted.
+     *
+     *  \var nr_Panorama_struct::pnPath
+     *  Panorama file path, empty for free slot
+     *  \var nr_Panorama_struct::pnTime
+     *  Modification time of the panorama file, in seconds
+     *  \var nr_Panorama_struct::pnNano
+     *  Modification time of the panorama file, nano-seconds part
+     *  \var nr_Panorama_struct::pnSize
+     *  Size of the panorama file, in bytes
+     *  \var nr_Panorama_struct::pnUsed
+     *  Last usage tick, used for least recently used eviction
+     *  \var nr_Panorama_struct::pnCount
+     *  Number of workers using the slot
+     *  \var nr_Panorama_struct::pnImage
+     *  Decoded panorama, NULL while being decoded
+     */
+
+    typedef struct nr_Panorama_struct {
+
+        char       pnPath[NR_REQ_PATH];
+        time_t     pnTime;
+        long       pnNano;
+        off_t      pnSize;
+        long       pnUsed;
+        int        pnCount;
+        IplImage * pnImage;
+
+    } nr_Panorama;
+
+    /*! \struct nr_Serve_struct
+     *  \brief Server state
+     *
+     *  This structure gathers the server configuration, the event loop state
+     *  owned by the main thread, and the state shared with the render workers
+     *  protected by its two mutexes.
+     *
+     *  \var nr_Serve_struct::svRoot
+     *  Panoramas root directory
+     *  \var nr_Serve_struct::svTile
+     *  Pyramid tiles size, in pixels
+     *  \var nr_Serve_struct::svQuality
+     *  JPEG encoding quality
+     *  \var nr_Serve_struct::svThread
+     *  Number of threads used by each render
+     *  \var nr_Serve_struct::svWorker
+     *  Number of render workers
+     *  \var nr_Serve_struct::svMethod
+     *  Interpolation method
+     *  \var nr_Serve_struct::svPoll
+     *  Event loop descriptor
+     *  \var nr_Serve_struct::svListen
+     *  Listening socket descriptor
+     *  \var nr_Serve_struct::svEvent
+     *  Completion notification descriptor
+     *  \var nr_Serve_struct::svBudget
+     *  Encoded responses cache size, in bytes
+     *  \var nr_Serve_struct::svUsage
+     *  Encoded responses cache usage, in bytes
+     *  \var nr_Serve_struct::svHead
+     *  Most recently used cached response
+     *  \var nr_Serve_struct::svTail
+     *  Least recently used cached response
+     *  \var nr_Serve_struct::svFlight
+     *  Jobs in flight
+     *  \var nr_Serve_struct::svConnect
+     *  Opened connections
+     *  \var nr_Serve_struct::svZombie
+     *  Closed connections, released after the events batch
+     *  \var nr_Serve_struct::svLock
+     *  Worker queue and completion list mutex
+     *  \var nr_Serve_struct::svWake
+     *  Worker queue condition
+     *  \var nr_Serve_struct::svQueue
+     *  Worker queue head
+     *  \var nr_Serve_struct::svLast
+     *  Worker queue tail
+     *  \var nr_Serve_struct::svDone
+     *  Completed jobs list
+     *  \var nr_Serve_struct::svStop
+     *  Workers termination flag
+     *  \var nr_Serve_struct::svPanoLock
+     *  Decoded panoramas mutex
+     *  \var nr_Serve_struct::svPanoWake
+     *  Decoded panoramas condition, signaled when a decoding ends
+     *  \var nr_Serve_struct::svPanoBudget
+     *  Decoded panoramas memory size, in bytes
+     *  \var nr_Serve_struct::svPanoTick
+     *  Decoded panoramas usage counter
+     *  \var nr_Serve_struct::svPano
+     *  Decoded panoramas slots
+     */
+
+    typedef struct nr_Serve_struct {
+
+        char const    * svRoot;
+        int             svTile;
+        int             svQuality;
+        int             svThread;
+        int             svWorker;
+        li_Method_t     svMethod;
+
+        int             svPoll;
+        int             svListen;
+        int             svEvent;
+        size_t          svBudget;
+        size_t          svUsage;
+        nr_Response   * svHead;
+        nr_Response   * svTail;
+        nr_Job        * svFlight;
+        nr_Connect    * svConnect;
+        nr_Connect    * svZombie;
+
+        pthread_mutex_t svLock;
+        pthread_cond_t  svWake;
+        nr_Job        * svQueue;
+        nr_Job        * svLast;
+        nr_Job        * svDone;
+        int             svStop;
+
+        pthread_mutex_t svPanoLock;
+        pthread_cond_t  svPanoWake;
+        size_t          svPanoBudget;
+        long            svPanoTick;
+        nr_Panorama     svPano[NR_PANO_SLOT];
+
+    } nr_Serve;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Software main function
+     *  
+     *  The main function reads the server parameters and starts the server on
+     *  the specified port of the loopback interface.
+     *  
+     *  \param argc Standard main parameter
+     *  \param argv Standard main parameter
+     */
+
+    int main ( int argc, char ** argv );
+
+    /*! \brief Server
+     *
+     *  This function creates the listening socket, the event loop and the
+     *  render workers and runs the event loop until interruption or
+     *  termination signal. The event loop is the only one handling sockets,
+     *  the responses cache and the jobs in flight; the workers only render
+     *  and encode jobs and notify their completion through an event
+     *  descriptor.
+     *
+     *  \param nrServe Server state structure
+     *  \param nrPort  HTTP port
+     *
+     *  \return Returns EXIT_SUCCESS or EXIT_FAILURE
+     */
+
+    int nr_serve_server ( nr_Serve * const nrServe, int const nrPort );
+
+    /*! \brief Event loop - connection acceptance
+     *
+     *  This function accepts all pending connections on the listening socket
+     *  and registers them in the event loop.
+     *
+     *  \param nrServe Server state structure
+     */
+
+    void nr_serve_accept ( nr_Serve * const nrServe );
+
+    /*! \brief Event loop - connection reading
+     *
+     *  This function reads the available bytes of a connection and processes
+     *  the complete requests they contain.
+     *
+     *  \param nrServe   Server state structure
+     *  \param nrConnect Connection structure
+     */
+
+    void nr_serve_read ( nr_Serve * const nrServe, nr_Connect * const nrConnect );
+
+    /*! \brief Event loop - request processing
+     *
+     *  This function processes the first complete request found in the
+     *  connection buffer. The response is taken from the cache when possible;
+     *  otherwise the connection waits for the job in flight with the same key
+     *  or for a new job queued to the workers.
+     *
+     *  \param nrServe   Server state structure
+     *  \param nrConnect Connection structure
+     */
+
+    void nr_serve_request ( nr_Serve * const nrServe, nr_Connect * const nrConnect );
+
+    /*! \brief Event loop - request routing
+     *
+     *  This function decodes the request target into a render job and
+     *  composes its canonical key. Equivalent requests, differing only by
+     *  parameters order or formatting, share the same key.
+     *
+     *  \param nrServe  Server state structure
+     *  \param nrTarget Request target
+     *  \param nrJob    Render job to fill
+     *
+     *  \return Returns the HTTP status code, 200 if the job is valid
+     */
+
+    int nr_serve_route ( nr_Serve * const nrServe, char * const nrTarget, nr_Job * const nrJob );
+
+    /*! \brief Event loop - response sending
+     *
+     *  This function attaches a response to a connection and starts writing
+     *  it. The connection takes a reference on the response.
+     *
+     *  \param nrServe    Server state structure
+     *  \param nrConnect  Connection structure
+     *  \param nrResponse Response to send
+     */
+
+    void nr_serve_send ( nr_Serve * const nrServe, nr_Connect * const nrConnect, nr_Response * const nrResponse );
+
+    /*! \brief Event loop - connection writing
+     *
+     *  This function writes the pending response bytes of a connection. When
+     *  the response is completely written, the connection is closed or reset
+     *  for the next request, depending on keep-alive.
+     *
+     *  \param nrServe   Server state structure
+     *  \param nrConnect Connection structure
+     */
+
+    void nr_serve_write ( nr_Serve * const nrServe, nr_Connect * const nrConnect );
+
+    /*! \brief Event loop - connection events
+     *
+     *  This function updates the events watched by the event loop on a
+     *  connection socket.
+     *
+     *  \param nrServe   Server state structure
+     *  \param nrConnect Connection structure
+     *  \param nrEvents  Watched events
+     */
+
+    void nr_serve_watch ( nr_Serve * const nrServe, nr_Connect * const nrConnect, uint32_t const nrEvents );
+
+    /*! \brief Event loop - connection closure
+     *
+     *  This function removes the socket of a connection from the event loop
+     *  and closes it. The structure of a connection waiting for a job is kept
+     *  until the job completes. The other connections are moved in the closed
+     *  connections list, as further events of the current batch can still
+     *  refer to them, and are released by nr_serve_reap.
+     *
+     *  \param nrServe   Server state structure
+     *  \param nrConnect Connection structure
+     */
+
+    void nr_serve_close ( nr_Serve * const nrServe, nr_Connect * const nrConnect );
+
+    /*! \brief Event loop - closed connections release
+     *
+     *  This function releases the connections closed during the last events
+     *  batch.
+     *
+     *  \param nrServe Server state structure
+     */
+
+    void nr_serve_reap ( nr_Serve * const nrServe );
+
+    /*! \brief Event loop - jobs completion
+     *
+     *  This function collects the jobs completed by the workers, stores their
+     *  responses in the cache and sends them to the waiting connections.
+     *
+     *  \param nrServe Server state structure
+     */
+
+    void nr_serve_complete ( nr_Serve * const nrServe );
+
+    /*! \brief Render worker
+     *
+     *  This function is the render worker thread main function. It renders
+     *  and encodes the queued jobs until the termination flag is raised.
+     *
+     *  \param nrServe Server state structure
+     *
+     *  \return Returns NULL
+     */
+
+    void * nr_serve_worker ( void * nrServe );
+
+    /*! \brief Render worker - job rendering
+     *
+     *  This function renders and encodes the view or tile described by the
+     *  job using the decoded panorama.
+     *
+     *  \param nrServe Server state structure
+     *  \param nrJob   Render job
+     *
+     *  \return Returns the response, NULL on allocation failure
+     */
+
+    nr_Response * nr_serve_render ( nr_Serve * const nrServe, nr_Job * const nrJob );
+
+    /*! \brief Response creation
+     *
+     *  This function composes a response from a status code, a content type
+     *  and a content. The returned response holds a single reference.
+     *
+     *  \param nrStatus  HTTP status code
+     *  \param nrType    Content type
+     *  \param nrContent Response content
+     *  \param nrSize    Response content size, in bytes
+     *
+     *  \return Returns the response, NULL on allocation failure
+     */
+
+    nr_Response * nr_serve_response ( int const nrStatus, char const * const nrType, void const * const nrContent, size_t const nrSize );
+
+    /*! \brief Response - reason phrase
+     *
+     *  This function returns the HTTP reason phrase of a status code.
+     *
+     *  \param nrStatus HTTP status code
+     *
+     *  \return Returns the reason phrase
+     */
+
+    char const * nr_serve_reason ( int const nrStatus );
+
+    /*! \brief Response - error
+     *
+     *  This function composes an error response with a plain text content.
+     *
+     *  \param nrStatus HTTP status code
+     *
+     *  \return Returns the response, NULL on allocation failure
+     */
+
+    nr_Response * nr_serve_error ( int const nrStatus );
+
+    /*! \brief Response - reference release
+     *
+     *  This function releases a reference on a response and deletes it when
+     *  the last reference is released.
+     *
+     *  \param nrResponse Response
+     */
+
+    void nr_serve_unref ( nr_Response * const nrResponse );
+
+    /*! \brief Cache - response search
+     *
+     *  This function searches the cache for the response corresponding to a
+     *  request key. A found response becomes the most recently used one.
+     *
+     *  \param nrServe Server state structure
+     *  \param nrKey   Canonical request key
+     *
+     *  \return Returns the cached response, NULL if not found
+     */
+
+    nr_Response * nr_serve_cache_find ( nr_Serve * const nrServe, char const * const nrKey );
+
+    /*! \brief Cache - response insertion
+     *
+     *  This function inserts a response as the most recently used one and
+     *  evicts the least recently used responses until the cache size is
+     *  respected. The cache takes a reference on the response.
+     *
+     *  \param nrServe    Server state structure
+     *  \param nrResponse Response to store
+     */
+
+    void nr_serve_cache_store ( nr_Serve * const nrServe, nr_Response * const nrResponse );
+
+    /*! \brief Panoramas - loading
+     *
+     *  This function returns the decoded panorama slot corresponding to the
+     *  provided path, decoding the panorama if necessary. Concurrent requests
+     *  on a panorama being decoded wait for the decoding to end instead of
+     *  decoding it again. The slot stays in use until released.
+     *
+     *  \param nrServe Server state structure
+     *  \param nrPath  Panorama file path
+     *
+     *  \return Returns the panorama slot, NULL on failure
+     */
+
+    nr_Panorama * nr_serve_pano_load ( nr_Serve * const nrServe, char const * const nrPath );
+
+    /*! \brief Panoramas - release
+     *
+     *  This function releases a panorama slot obtained by loading.
+     *
+     *  \param nrServe    Server state structure
+     *  \param nrPanorama Panorama slot
+     */
+
+    void nr_serve_pano_release ( nr_Serve * const nrServe, nr_Panorama * const nrPanorama );
+
+    /*! \brief Request key hash
+     *
+     *  This function computes the hash of a canonical request key, used to
+     *  speed up cache and in flight jobs searches.
+     *
+     *  \param nrKey Canonical request key
+     *
+     *  \return Returns the key hash
+     */
+
+    uint64_t nr_serve_hash ( char const * nrKey );
+
+    /*! \brief Request parameter
+     *
+     *  This function searches a numerical parameter in a request query string
+     *  and converts it. The whole value has to be a finite number, so that a
+     *  malformed, infinite or not-a-number value can be refused by the caller.
+     *
+     *  \param nrQuery Request query string, may be NULL
+     *  \param nrName  Parameter name
+     *  \param nrValue Returned parameter value, unchanged if not found
+     *
+     *  \return Returns LC_FALSE if the value is invalid, LC_TRUE otherwise
+     */
+
+    int nr_serve_parameter ( char const * const nrQuery, char const * const nrName, double * const nrValue );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,543 @@
+/*
+ * norama suite - Panorama tools suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "norama-tile.h"
+
+/*
+    Source - Software main function
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Tiles parameters variables */
+        int nrTile = NR_DFT_TILE;
+        int nrMode = NR_CUBE;
+
+        /* Pyramid levels variables */
+        nr_Level nrLevel[NR_MAX_LEVEL + 1];
+        int      nrCount = 1;
+
+        /* Exportation options variables */
+        int nrOption = -1;
+
+        /* Parallel processing variables */
+        int nrThread = 1;
+
+        /* Exportation failures variables */
+        long nrFail = 0;
+
+        /* Interpolation tag variables */
+        char * nrMethod = NULL;
+
+        /* Tiles rewriting variables */
+        int nrForce = LC_FALSE;
+
+        /* Manifest variables */
+        char nrManifest[PATH_MAX];
+
+        /* Path variables */
+        char * nriPath = NULL;
+        char * nroPath = NULL;
+        char * nrExt   = NULL;
+
+        /* Input file status variables */
+        struct stat nrStat;
+
+        /* Image allocation variables */
+        IplImage * nrImage = NULL;
+
+        /* Search in parameters */
+        lc_stdp( lc_stda( argc, argv, "--input"        , "-i" ), argv, & nriPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"       , "-o" ), argv, & nroPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--tile"         , "-z" ), argv, & nrTile  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--extension"    , "-x" ), argv, & nrExt   , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--threads"      , "-t" ), argv, & nrThread, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--export"       , "-q" ), argv, & nrOption, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--interpolation", "-n" ), argv, & nrMethod, LC_STRING );
+
+        /* Select tiles mode */
+        if ( lc_stda( argc, argv, "--equirectangular", "-E" ) ) nrMode = NR_EQUI;
+
+        /* Select tiles rewriting */
+        if ( lc_stda( argc, argv, "--force", "-f" ) ) nrForce = LC_TRUE;
+
+        /* Assign default parameters */
+        if ( nrExt    == NULL ) nrExt    = NR_DFT_EXT;
+        if ( nrMethod == NULL ) nrMethod = "bicubicf";
+
+        /* Software swicth */
+        if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
+
+            /* Display usage */
+            fprintf( stdout, NR_HELP );
+
+        } else {
+
+            /* Verify path strings and tiles size */
+            if ( ( nriPath != NULL ) && ( nroPath != NULL ) && ( nrTile > 0 ) ) {
+
+                /* Import input image - decoded once for all levels */
+                if ( ( stat( nriPath, & nrStat ) == 0 ) && ( ( nrImage = lc_imread( nriPath, lc_stda( argc, argv, "--force-rgb", "-F" ) ? CV_LOAD_IMAGE_COLOR : CV_LOAD_IMAGE_UNCHANGED ) ) != NULL ) ) {
+
+                    /* Compute number of levels - top level reaches input resolution */
+                    while ( ( nrCount <= NR_MAX_LEVEL ) && ( ( nrMode == NR_CUBE ? 4 : 2 ) * ( nrTile << ( nrCount - 1 ) ) < nrImage->width ) ) nrCount ++;
+
+                    /* Initialize pyramid levels */
+                    memset( nrLevel, 0, sizeof( nrLevel ) );
+
+                    /* Compose pyramid manifest - generation parameters and input identity */
+                    snprintf( nrManifest, PATH_MAX, "tile %d\nmode %c\nextension %s\nexport %d\ninterpolation %s\nrgb %d\ninput %lu %lu %lld\n", 
+
+                        nrTile, nrMode == NR_CUBE ? 'c' : NR_EQUI_TAG, nrExt, nrOption, nrMethod, lc_stda( argc, argv, "--force-rgb", "-F" ) ? 1 : 0, 
+                        ( unsigned long ) nrStat.st_dev, ( unsigned long ) nrStat.st_ino, ( long long ) nrStat.st_size
+
+                    );
+
+                    /* Rewrite all tiles on generation parameters change */
+                    if ( nr_tile_mcompare( nroPath, nrManifest ) == LC_FALSE ) nrForce = LC_TRUE;
+
+                    /* Create pyramid directories */
+                    if ( nr_tile_directory( nroPath, nrCount, nrMode ) == LC_FALSE ) {
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : Unable to create pyramid directories\n" );
+
+                    } else
+                    if ( ( nrForce == LC_TRUE ) && ( nr_tile_minvalid( nroPath ) == LC_FALSE ) ) {
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : Unable to invalidate pyramid manifest\n" );
+
+                    } else
+                    if ( nr_tile_pyramid( nrImage, nrLevel, nrCount, nrMode, nrTile ) == LC_FALSE ) {
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : Unable to create pyramid levels sources\n" );
+
+                    } else
+                    if ( ( nrFail = nr_tile_render( nrLevel, nrCount, nrMode, nrTile, nroPath, nrExt, nrOption, & nrStat, nrForce, lc_method( nrMethod ), nrThread ) ) > 0 ) {
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : Unable to write %li tiles\n", nrFail );
+
+                    } else
+                    if ( nr_tile_mwrite( nroPath, nrManifest ) == LC_FALSE ) {
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : Unable to write pyramid manifest\n" );
+
+                    }
+
+                    /* Release pyramid levels sources */
+                    while ( ( -- nrCount ) >= 0 ) if ( ( nrLevel[nrCount].lvSource != NULL ) && ( nrLevel[nrCount].lvSource != nrImage ) ) lc_imrelease( & nrLevel[nrCount].lvSource );
+
+                    /* Release image memory */
+                    lc_imrelease( & nrImage );
+
+                /* Display message */
+                } else { fprintf( LC_ERR, "Error : Unable to read input image\n" ); }
+
+            /* Display message */
+            } else { fprintf( LC_ERR, "Error : Invalid path or tiles size specification\n" ); }
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Pyramid sources
+ */
+
+    int nr_tile_pyramid( IplImage * const nrImage, nr_Level * const nrLevel, int const nrCount, int const nrMode, int const nrTile ) {
+
+        /* Source width variables */
+        int nrWidth = 0;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Enumerate levels tiles */
+        for ( nrParse = 0; nrParse < nrCount; nrParse ++ ) {
+
+            /* Compute level geometry */
+            nrLevel[nrParse].lvSize  = nrTile << nrParse;
+            nrLevel[nrParse].lvSide  = 1 << nrParse;
+            nrLevel[nrParse].lvCount = ( long ) ( nrMode == NR_CUBE ? LN_FACES : 2 ) * nrLevel[nrParse].lvSide * nrLevel[nrParse].lvSide;
+
+            /* Compute level first tile index */
+            nrLevel[nrParse].lvFirst = ( nrParse == 0 ) ? 0 : nrLevel[nrParse - 1].lvFirst + nrLevel[nrParse - 1].lvCount;
+
+        }
+
+        /* Compute levels sources from top level */
+        for ( nrParse = nrCount - 1; nrParse >= 0; nrParse -- ) {
+
+            /* Compute level source width */
+            nrWidth = ( nrMode == NR_CUBE ? 4 : 2 ) * nrLevel[nrParse].lvSize;
+
+            /* Check top level of cube faces tiles */
+            if ( ( nrParse == nrCount - 1 ) && ( nrMode == NR_CUBE ) ) {
+
+                /* Assign input mapping - resampled by tiles rendering */
+                nrLevel[nrParse].lvSource = nrImage;
+
+            } else {
+
+                /* Create level source */
+                if ( ( nrLevel[nrParse].lvSource = cvCreateImage( cvSize( nrWidth, nrWidth / 2 ), IPL_DEPTH_8U, nrImage->nChannels ) ) == NULL ) return( LC_FALSE );
+
+                /* Downsample level source from upper level */
+                if ( nrParse == nrCount - 1 ) {
+
+                    /* Resample input mapping */
+                    cvResize( nrImage, nrLevel[nrParse].lvSource, nrWidth < nrImage->width ? CV_INTER_AREA : CV_INTER_CUBIC );
+
+                } else {
+
+                    /* Downsample upper level source */
+                    cvResize( nrLevel[nrParse + 1].lvSource, nrLevel[nrParse].lvSource, CV_INTER_AREA );
+
+                }
+
+            }
+
+        }
+
+        /* Return status */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Pyramid tiles
+ */
+
+    long nr_tile_render( 
+
+        nr_Level    const * const nrLevel, 
+        int                 const nrCount, 
+        int                 const nrMode, 
+        int                 const nrTile, 
+        char        const * const nrPath, 
+        char        const * const nrExt, 
+        int                 const nrOption, 
+        struct stat const * const nrStat, 
+        int                 const nrForce, 
+        li_Method_t         const nrMethod, 
+        int                 const nrThread 
+
+    ) {
+
+        /* Tiles count variables */
+        long nrTotal = nrLevel[nrCount - 1].lvFirst + nrLevel[nrCount - 1].lvCount;
+
+        /* Exportation failures variables */
+        long nrFail = 0;
+
+        /* Render and export tiles */
+        # pragma omp parallel num_threads( nrThread ) reduction( + : nrFail )
+        {
+
+            /* Tile path variables */
+            char nrFile[PATH_MAX];
+
+            /* Tile position variables */
+            int nrDepth = 0;
+            int nrFace  = 0;
+            int nrRow   = 0;
+            int nrCol   = 0;
+
+            /* Tile index variables */
+            long nrLocal = 0;
+
+            /* Source variables */
+            IplImage * nrSource = NULL;
+
+            /* Tile image variables - rendered cube tile or view on source */
+            IplImage * nrImage = NULL;
+
+            /* Image descriptor variables */
+            ln_Image_t nriDesc;
+            ln_Image_t nroDesc;
+
+            /* Create thread tile image */
+            if ( nrMode == NR_CUBE ) {
+
+                /* Create tile image */
+                nrImage = cvCreateImage( cvSize( nrTile, nrTile ), IPL_DEPTH_8U, nrLevel[0].lvSource->nChannels );
+
+            } else {
+
+                /* Create tile image header */
+                nrImage = cvCreateImageHeader( cvSize( nrTile, nrTile ), IPL_DEPTH_8U, nrLevel[0].lvSource->nChannels );
+
+            }
+
+            /* Process pyramid tiles */
+            # pragma omp for schedule( dynamic )
+            for ( long nrIndex = 0; nrIndex < nrTotal; nrIndex ++ ) {
+
+                /* Search tile level */
+                for ( nrDepth = nrCount - 1; nrIndex < nrLevel[nrDepth].lvFirst; nrDepth -- );
+
+                /* Compute tile index in level */
+                nrLocal = nrIndex - nrLevel[nrDepth].lvFirst;
+
+                /* Compute tile position */
+                if ( nrMode == NR_CUBE ) {
+
+                    /* Compute tile face and position */
+                    nrFace = nrLocal / ( ( long ) nrLevel[nrDepth].lvSide * nrLevel[nrDepth].lvSide );
+                    nrRow  = ( nrLocal / nrLevel[nrDepth].lvSide ) % nrLevel[nrDepth].lvSide;
+                    nrCol  = nrLocal % nrLevel[nrDepth].lvSide;
+
+                } else {
+
+                    /* Compute tile position */
+                    nrRow = nrLocal / ( 2 * nrLevel[nrDepth].lvSide );
+                    nrCol = nrLocal % ( 2 * nrLevel[nrDepth].lvSide );
+
+                }
+
+                /* Compose tile path */
+                snprintf( nrFile, PATH_MAX, "%s/%d/%c/%d_%d.%s", nrPath, nrDepth, nrMode == NR_CUBE ? LN_FACES_TAGS[nrFace] : NR_EQUI_TAG, nrRow, nrCol, nrExt );
+
+                /* Skip up to date tile */
+                if ( ( nrForce == LC_FALSE ) && ( nr_tile_uptodate( nrFile, nrStat ) == LC_TRUE ) ) continue;
+
+                /* Check tile image */
+                if ( nrImage == NULL ) { nrFail ++; continue; }
+
+                /* Assign level source */
+                nrSource = nrLevel[nrDepth].lvSource;
+
+                /* Compose tile image */
+                if ( nrMode == NR_CUBE ) {
+
+                    /* Compose image descriptors */
+                    nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nrSource->imageData, nrSource->width, nrSource->height, nrSource->nChannels };
+                    nroDesc = ( ln_Image_t ) { ( inter_C8_t * ) nrImage->imageData, nrImage->width, nrImage->height, nrImage->nChannels };
+
+                    /* Render cube face tile - parallelism is carried by tiles */
+                    if ( ln_cube_tile( & nriDesc, & nroDesc, nrFace, nrLevel[nrDepth].lvSize, nrCol * nrTile, nrRow * nrTile, nrMethod, 1 ) != LN_SUCCESS ) { nrFail ++; continue; }
+
+                } else {
+
+                    /* Assign tile view on level source */
+                    cvSetData( nrImage, nrSource->imageData + ( size_t ) nrRow * nrTile * nrSource->widthStep + ( size_t ) nrCol * nrTile * nrSource->nChannels, nrSource->widthStep );
+
+                }
+
+                /* Export tile - other threads keep rendering */
+                if ( lc_imwrite( nrFile, nrImage, nrOption ) == 0 ) nrFail ++;
+
+            }
+
+            /* Release thread tile image */
+            if ( nrImage != NULL ) {
+
+                /* Release image or image header */
+                if ( nrMode == NR_CUBE ) lc_imrelease( & nrImage ); else cvReleaseImageHeader( & nrImage );
+
+            }
+
+        }
+
+        /* Return failures count */
+        return( nrFail );
+
+    }
+
+/*
+    Source - Pyramid directories
+ */
+
+    int nr_tile_directory( char const * const nrPath, int const nrCount, int const nrMode ) {
+
+        /* Directory path variables */
+        char nrDirectory[PATH_MAX];
+
+        /* Parsing variables */
+        int nrDepth = 0;
+        int nrFace  = 0;
+
+        /* Create pyramid directory */
+        if ( ( mkdir( nrPath, 0755 ) != 0 ) && ( errno != EEXIST ) ) return( LC_FALSE );
+
+        /* Create levels directories */
+        for ( nrDepth = 0; nrDepth < nrCount; nrDepth ++ ) {
+
+            /* Compose level directory */
+            snprintf( nrDirectory, PATH_MAX, "%s/%d", nrPath, nrDepth );
+
+            /* Create level directory */
+            if ( ( mkdir( nrDirectory, 0755 ) != 0 ) && ( errno != EEXIST ) ) return( LC_FALSE );
+
+            /* Create faces directories */
+            for ( nrFace = 0; nrFace < ( nrMode == NR_CUBE ? LN_FACES : 1 ); nrFace ++ ) {
+
+                /* Compose face directory */
+                snprintf( nrDirectory, PATH_MAX, "%s/%d/%c", nrPath, nrDepth, nrMode == NR_CUBE ? LN_FACES_TAGS[nrFace] : NR_EQUI_TAG );
+
+                /* Create face directory */
+                if ( ( mkdir( nrDirectory, 0755 ) != 0 ) && ( errno != EEXIST ) ) return( LC_FALSE );
+
+            }
+
+        }
+
+        /* Return status */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Tile up-to-date check
+ */
+
+    int nr_tile_uptodate( char const * const nrPath, struct stat const * const nrStat ) {
+
+        /* Tile file status variables */
+        struct stat nrTile;
+
+        /* Retrieve tile file status */
+        if ( stat( nrPath, & nrTile ) != 0 ) return( LC_FALSE );
+
+        /* Compare modification times */
+        if ( nrTile.st_mtim.tv_sec != nrStat->st_mtim.tv_sec ) return( nrTile.st_mtim.tv_sec > nrStat->st_mtim.tv_sec ? LC_TRUE : LC_FALSE );
+
+        /* Compare modification times */
+        return( nrTile.st_mtim.tv_nsec >= nrStat->st_mtim.tv_nsec ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Manifest comparison
+ */
+
+    int nr_tile_mcompare( char const * const nrPath, char const * const nrManifest ) {
+
+        /* Manifest path variables */
+        char nrFile[PATH_MAX];
+
+        /* Manifest content variables */
+        char nrRecord[PATH_MAX];
+
+        /* Content size variables */
+        size_t nrSize = 0;
+
+        /* Stream variables */
+        FILE * nrStream = NULL;
+
+        /* Compose manifest path */
+        snprintf( nrFile, PATH_MAX, "%s/%s", nrPath, NR_MANIFEST );
+
+        /* Open manifest - missing manifest differs */
+        if ( ( nrStream = fopen( nrFile, "rb" ) ) == NULL ) return( LC_FALSE );
+
+        /* Read manifest content */
+        nrSize = fread( nrRecord, 1, sizeof( nrRecord ) - 1, nrStream );
+
+        /* Close manifest */
+        fclose( nrStream );
+
+        /* Terminate manifest content */
+        nrRecord[nrSize] = '\0';
+
+        /* Compare manifests */
+        return( strcmp( nrRecord, nrManifest ) == 0 ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Manifest invalidation
+ */
+
+    int nr_tile_minvalid( char const * const nrPath ) {
+
+        /* Manifest path variables */
+        char nrFile[PATH_MAX];
+
+        /* Compose manifest path */
+        snprintf( nrFile, PATH_MAX, "%s/%s", nrPath, NR_MANIFEST );
+
+        /* Remove manifest - tiles regenerated until a complete run records it again */
+        return( ( unlink( nrFile ) == 0 ) || ( errno == ENOENT ) ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Manifest recording
+ */
+
+    int nr_tile_mwrite( char const * const nrPath, char const * const nrManifest ) {
+
+        /* Manifest path variables */
+        char nrFile[PATH_MAX];
+
+        /* Stream variables */
+        FILE * nrStream = NULL;
+
+        /* Writing status variables */
+        int nrStatus = LC_TRUE;
+
+        /* Compose manifest path */
+        snprintf( nrFile, PATH_MAX, "%s/%s", nrPath, NR_MANIFEST );
+
+        /* Create manifest */
+        if ( ( nrStream = fopen( nrFile, "wb" ) ) == NULL ) return( LC_FALSE );
+
+        /* Write manifest content */
+        if ( fputs( nrManifest, nrStream ) == EOF ) nrStatus = LC_FALSE;
+
+        /* Close manifest */
+        if ( fclose( nrStream ) != 0 ) nrStatus = LC_FALSE;
+
+        /* Return status */
+        return( nrStatus );
+
+    }
+
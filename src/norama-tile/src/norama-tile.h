@@ -0,0 +1,354 @@
+/*
+ * norama suite - Panorama tools suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   norama-tile.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Software main header
+     */
+
+    /*! \mainpage norama-tile
+     *
+     *  \section norama-suite
+     *  \section _ Panorama tools suite
+     *
+     *  This software suite offers tools for numerical panoramas manipulation.
+     *  Mostly designed for equirectangular mappings, its role is to provide an 
+     *  interface to libgnomonic and its algorithms. It then offers an interface
+     *  to projection and transformation features implemented in the gnomonic 
+     *  library. The norama-suite is also interfaced with libcsps in order to 
+     *  take advantage of camera motion tracking to operate and align panoramas
+     *  on earth. It also comes with a panorama viewer to complete the suite. 
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/norama-suite/wiki
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __NR_TILE__
+    # define __NR_TILE__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <errno.h>
+    # include <limits.h>
+    # include <unistd.h>
+    # include <sys/stat.h>
+    # include <sys/types.h>
+    # include <opencv/cv.h>
+    # include <opencv/highgui.h>
+    # include <gnomonic-all.h>
+    # include <common-all.h>
+    # include <norama-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Standard help */
+    # define NR_HELP "Usage summary :\n\n"                     \
+    "\tnorama-tile [Arguments] [Parameters] ...\n\n"           \
+    "Short arguments and parameters summary :\n\n"             \
+    "\t-F\tForce input image in RGB format\n"                  \
+    "\t-E\tEquirectangular tiles instead of cube faces tiles\n" \
+    "\t-f\tRewrite tiles already up to date\n"                 \
+    "\t-i\tInput equirectangular image\n"                      \
+    "\t-o\tOutput pyramid directory\n"                         \
+    "\t-z\tTiles size, in pixels\n"                            \
+    "\t-x\tTiles file extension\n"                             \
+    "\t-t\tNumber of threads\n"                                \
+    "\t-n\tInterpolation method\n"                             \
+    "\t-q\tOutput image exportation options\n\n"               \
+    "Pyramid layout :\n\n"                                     \
+    "\t[directory]/[level]/[face]/[row]_[column].[extension]\n" \
+    "\t[directory]/[level]/e/[row]_[column].[extension]\n"     \
+    "\t[directory]/manifest\n\n"                               \
+    "norama-tile - norama-suite\n"                             \
+    "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
+
+    /* Define default values */
+    # define NR_DFT_TILE    512
+    # define NR_DFT_EXT     "jpg"
+
+    /* Define pyramid constraints */
+    # define NR_MAX_LEVEL   16
+
+    /* Define tiles modes */
+    # define NR_CUBE        0
+    # define NR_EQUI        1
+
+    /* Define equirectangular tiles tag */
+    # define NR_EQUI_TAG    'e'
+
+    /* Define pyramid manifest file */
+    # define NR_MANIFEST    "manifest"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct nr_Level_struct
+     *  \brief Pyramid level
+     *
+     *  This structure describes a pyramid level. Each level is rendered from
+     *  its own equirectangular source, downsampled from the source of the
+     *  level above, so that the sampling density of the source matches the
+     *  resolution of the level tiles.
+     *
+     *  \var nr_Level_struct::lvSource
+     *  Level equirectangular source
+     *  \var nr_Level_struct::lvSize
+     *  Cube face edge size or equirectangular height, in pixels
+     *  \var nr_Level_struct::lvSide
+     *  Number of tiles along a face edge or the equirectangular height
+     *  \var nr_Level_struct::lvCount
+     *  Number of tiles of the level
+     *  \var nr_Level_struct::lvFirst
+     *  Index of the first tile of the level in the pyramid enumeration
+     */
+
+    typedef struct nr_Level_struct {
+
+        IplImage * lvSource;
+        int        lvSize;
+        int        lvSide;
+        long       lvCount;
+        long       lvFirst;
+
+    } nr_Level;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Software main function
+     *  
+     *  The main function reads the input equirectangular mapping once and
+     *  builds the complete tiles pyramid in the output directory. The number
+     *  of levels is deduced from the input resolution : the top level is the
+     *  first one reaching it, each lower level halving the resolution.
+     *
+     *  The generation parameters and the input identity are recorded in a
+     *  manifest once the pyramid is complete. All the tiles are rewritten
+     *  when the manifest differs from the current parameters.
+     *  
+     *  \param argc Standard main parameter
+     *  \param argv Standard main parameter
+     */
+
+    int main ( int argc, char ** argv );
+
+    /*! \brief Pyramid sources
+     *
+     *  This function computes the equirectangular source of each pyramid
+     *  level. The top level source is the input mapping, resized to the exact
+     *  level resolution for equirectangular tiles. Each lower level source is
+     *  downsampled from the source of the level above, never from the input.
+     *
+     *  \param nrImage Input equirectangular mapping
+     *  \param nrLevel Pyramid levels array
+     *  \param nrCount Number of pyramid levels
+     *  \param nrMode  Tiles mode
+     *  \param nrTile  Tiles size, in pixels
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_tile_pyramid ( IplImage * const nrImage, nr_Level * const nrLevel, int const nrCount, int const nrMode, int const nrTile );
+
+    /*! \brief Pyramid tiles
+     *
+     *  This function renders and exports the tiles of all the pyramid levels.
+     *  The tiles of all levels are enumerated in a single parallel loop, each
+     *  thread rendering a tile and exporting it while the other threads keep
+     *  rendering. Tiles files more recent than the input file are skipped,
+     *  unless forced.
+     *
+     *  \param nrLevel  Pyramid levels array
+     *  \param nrCount  Number of pyramid levels
+     *  \param nrMode   Tiles mode
+     *  \param nrTile   Tiles size, in pixels
+     *  \param nrPath   Output pyramid directory
+     *  \param nrExt    Tiles file extension
+     *  \param nrOption Tiles exportation option
+     *  \param nrStat   Input file status
+     *  \param nrForce  Tiles rewriting flag
+     *  \param nrMethod Interpolation method
+     *  \param nrThread Number of threads
+     *
+     *  \return Returns the number of tiles that failed to be exported
+     */
+
+    long nr_tile_render ( 
+
+        nr_Level    const * const nrLevel, 
+        int                 const nrCount, 
+        int                 const nrMode, 
+        int                 const nrTile, 
+        char        const * const nrPath, 
+        char        const * const nrExt, 
+        int                 const nrOption, 
+        struct stat const * const nrStat, 
+        int                 const nrForce, 
+        li_Method_t         const nrMethod, 
+        int                 const nrThread 
+
+    );
+
+    /*! \brief Pyramid directories
+     *
+     *  This function creates the directories of the pyramid levels and faces
+     *  in the output directory.
+     *
+     *  \param nrPath  Output pyramid directory
+     *  \param nrCount Number of pyramid levels
+     *  \param nrMode  Tiles mode
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_tile_directory ( char const * const nrPath, int const nrCount, int const nrMode );
+
+    /*! \brief Tile up-to-date check
+     *
+     *  This function checks if a tile file exists and is more recent than the
+     *  input file.
+     *
+     *  \param nrPath Tile file path
+     *  \param nrStat Input file status
+     *
+     *  \return Returns LC_TRUE if the tile is up to date, LC_FALSE otherwise
+     */
+
+    int nr_tile_uptodate ( char const * const nrPath, struct stat const * const nrStat );
+
+    /*! \brief Manifest comparison
+     *
+     *  This function compares the manifest of the pyramid directory with the
+     *  provided one. A missing manifest is considered as different.
+     *
+     *  \param nrPath     Output pyramid directory
+     *  \param nrManifest Manifest of the current generation parameters
+     *
+     *  \return Returns LC_TRUE if the manifests are identical, LC_FALSE otherwise
+     */
+
+    int nr_tile_mcompare ( char const * const nrPath, char const * const nrManifest );
+
+    /*! \brief Manifest invalidation
+     *
+     *  This function removes the manifest of the pyramid directory before its
+     *  tiles are rewritten, so that an interrupted generation is restarted by
+     *  the next one.
+     *
+     *  \param nrPath Output pyramid directory
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_tile_minvalid ( char const * const nrPath );
+
+    /*! \brief Manifest recording
+     *
+     *  This function writes the provided manifest in the pyramid directory.
+     *
+     *  \param nrPath     Output pyramid directory
+     *  \param nrManifest Manifest of the current generation parameters
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_tile_mwrite ( char const * const nrPath, char const * const nrManifest );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -43,6 +43,12 @@
 
     # include "norama-view.h"
 
+/*
+    Source - X11 error state
+ */
+
+    static int nr_view_xfail = LC_FALSE;
+
 /*
     Source - Software main function
  */
@@ -52,6 +58,9 @@
         /* Keyevent variables */
         unsigned char nrEvent = 0;
 
+        /* Event waiting variables */
+        int nrWait = NR_WAIT_BUSY;
+
         /* Display variables */
         int nrWidth  = 0;
         int nrHeight = 0;
@@ -59,28 +68,68 @@
         /* Display scale variables */
         float nrScale = NR_DFT_SCALE;
 
-        /* Parallel processing variables */
-        int nrThread = NR_DFT_THREAD;
-
         /* Window name variables */
         char nrName[256] = "norama-view";
 
         /* Image path variables */
         char * nriPath = NULL;
 
-        /* Image allocation variables */
-        IplImage * nriImage = NULL;
-        IplImage * nrdImage = NULL;
+        /* Image size variables */
+        CvSize nriSize;
+
+        /* Tiles pyramid variables */
+        char * nrtPath   = NULL;
+        char * nrtExt    = NR_DFT_EXT;
+        long   nrBudget  = NR_DFT_BUDGET;
+        int    nrLoaders = NR_DFT_LOADER;
+
+        /* Tiles cache variables */
+        nr_Tiles nrTiles;
+
+        /* Benchmark path variables */
+        char * nrbPath = NULL;
+
+        /* Tour path variables */
+        char * nruPath = NULL;
+
+        /* Tour variables */
+        nr_Tour nrTour;
+
+        /* Sequence variables */
+        char * nrqPath  = NULL;
+        double nrRate   = 0.0;
+        int    nrAhead  = NR_DFT_AHEAD;
+
+        /* Sequence playback variables */
+        nr_Sequence nrSequence;
+
+        /* Image descriptor variables */
+        ln_Image_t nriDesc;
+
+        /* Render thread variables */
+        pthread_t nrWorker;
+
+        /* X11 presentation variables */
+        nr_Present nrPresent = { NULL, 0, NULL, NULL, { 0, 0, NULL, False }, LC_FALSE };
 
-        /* Mouse control variables */
-        nr_Mouse nrMouse = { 0.0, 0.0, NR_DFT_APPER, 0.0 };
+        /* Viewer state variables */
+        nr_View nrView = { { 0.0, 0.0, NR_DFT_APPER, 0.0, 1, 0 }, NULL, { NULL, 0, 0, 0 }, NULL, NULL, 0, NULL, { NULL, NULL }, NULL, 0, 0, 0, 0, -1, NR_DFT_THREAD, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, { -1, -1 } };
 
         /* Search in parameters */
-        lc_stdp( lc_stda( argc, argv, "--input"  , "-i" ), argv, & nriPath , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--threads", "-t" ), argv, & nrThread, LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--width"  , "-x" ), argv, & nrWidth , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--height" , "-y" ), argv, & nrHeight, LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--scale"  , "-s" ), argv, & nrScale , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--input"  , "-i" ), argv, & nriPath          , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--threads", "-t" ), argv, & nrView.vwThread  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--width"  , "-x" ), argv, & nrWidth          , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--height" , "-y" ), argv, & nrHeight         , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--scale"  , "-s" ), argv, & nrScale          , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--tiles"  , "-d" ), argv, & nrtPath          , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--extension","-e"), argv, & nrtExt           , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--budget" , "-b" ), argv, & nrBudget         , LC_LONG   );
+        lc_stdp( lc_stda( argc, argv, "--loaders", "-l" ), argv, & nrLoaders        , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--bench"  , "-p" ), argv, & nrbPath          , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--tour"   , "-u" ), argv, & nruPath          , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--sequence","-q" ), argv, & nrqPath          , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--rate"   , "-r" ), argv, & nrRate           , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--ahead"  , "-a" ), argv, & nrAhead          , LC_INT    );
 
         /* Software swicth */
         if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
@@ -91,106 +140,332 @@
         } else {
 
             /* Verify path strings */
-            if ( nriPath != NULL ) {
+            if ( ( nriPath != NULL ) || ( nrtPath != NULL ) || ( nruPath != NULL ) || ( nrqPath != NULL ) ) {
+
+                /* Check tiled mode */
+                if ( nrtPath != NULL ) {
+
+                    /* Open tiles pyramid - low resolution level used as input */
+                    if ( nr_view_topen( & nrTiles, nrtPath, nrtExt, nrBudget, nrLoaders, nrView.vwThread, & nrView ) == LC_TRUE ) {
+
+                        /* Assign tiles cache */
+                        nrView.vwTiles = & nrTiles;
+
+                        /* Assign low resolution level */
+                        nrView.vwInput = nrTiles.tsImage;
+
+                    /* Display message */
+                    } else { fprintf( LC_ERR, "Error : Unable to open tiles pyramid\n" ); }
+
+                } else
+                if ( nruPath != NULL ) {
+
+                    /* Open tour - first panorama decoded */
+                    if ( nr_view_touropen( & nrTour, nruPath, nrBudget ) == LC_TRUE ) {
+
+                        /* Assign tour */
+                        nrView.vwTour = & nrTour;
+
+                        /* Assign first panorama */
+                        nrView.vwInput = nrTour.trImage[0];
+
+                    } else {
+
+                        /* Release tour */
+                        nr_view_tourclose( & nrTour );
+
+                    }
+
+                } else
+                if ( nrqPath != NULL ) {
+
+                    /* Open sequence - first frame decoded */
+                    if ( nr_view_sopen( & nrSequence, nrqPath, nrRate, nrAhead, nrLoaders, & nrView ) == LC_TRUE ) {
+
+                        /* Assign sequence */
+                        nrView.vwSequence = & nrSequence;
 
-                /* Import input image */
-                nriImage = cvLoadImage( nriPath, CV_LOAD_IMAGE_UNCHANGED );
+                        /* Assign first frame */
+                        nrView.vwInput = nrSequence.sqSlot[0];
+
+                    } else {
+
+                        /* Release sequence */
+                        nr_view_sclose( & nrSequence );
+
+                    }
+
+                } else {
+
+                    /* Obtain screen resolution - required sampling density */
+                    if ( ( nrWidth == 0 ) || ( nrHeight == 0 ) ) nr_view_display( & nrWidth, & nrHeight, nrScale );
+
+                    /* Import input image - reduced to the density required by the narrowest aperture */
+                    nrView.vwInput = lc_imread_partial( nriPath, CV_LOAD_IMAGE_UNCHANGED, NULL, lc_imsize( nriPath, & nriSize ) == LC_TRUE ? ( 2.0 * LG_PI * nrWidth ) / ( nriSize.width * NR_MIN_APPER ) : 1.0 );
+
+                }
 
                 /*  Verify input image reading */
-                if ( nriImage != NULL ) {
+                if ( nrView.vwInput != NULL ) {
 
                     /* Obtain screen resolution */
                     if ( ( nrWidth == 0 ) || ( nrHeight == 0 ) ) nr_view_display( & nrWidth, & nrHeight, nrScale );
 
                     /* Store display dimenstion */
-                    nrMouse.msWidth = nrWidth;
+                    nrView.vwMouse.msWidth = nrWidth;
 
-                    /* Create image allocation */
-                    nrdImage = cvCreateImage( cvSize( nrWidth, nrHeight ), IPL_DEPTH_8U , nriImage->nChannels );
+                    /* Create image allocations - front and back buffers */
+                    nrView.vwBuffer[0] = cvCreateImage( cvSize( nrWidth, nrHeight ), IPL_DEPTH_8U , nrView.vwInput->nChannels );
+                    nrView.vwBuffer[1] = cvCreateImage( cvSize( nrWidth, nrHeight ), IPL_DEPTH_8U , nrView.vwInput->nChannels );
+
+                    /* Create reduced buffer allocation */
+                    nrView.vwReduced = ( inter_C8_t * ) malloc( ( size_t ) nrWidth * nrHeight * nrView.vwInput->nChannels );
 
                     /* Verify allocation creation */
-                    if ( nrdImage != NULL ) {
+                    if ( ( nrView.vwBuffer[0] != NULL ) && ( nrView.vwBuffer[1] != NULL ) && ( nrView.vwReduced != NULL ) ) {
+
+                        /* Check cube map mode - tiles, tours and sequences are rendered directly */
+                        if ( lc_stda( argc, argv, "--cube", "-c" ) && ( nrView.vwTiles == NULL ) && ( nrView.vwTour == NULL ) && ( nrView.vwSequence == NULL ) ) {
+
+                            /* Create image descriptor */
+                            nriDesc = ( ln_Image_t ) { ( inter_C8_t * ) nrView.vwInput->imageData, nrView.vwInput->width, nrView.vwInput->height, nrView.vwInput->nChannels };
+
+                            /* Create cube map - faces matching mapping resolution */
+                            if ( ( nrView.vwInput->widthStep != nrView.vwInput->width * nrView.vwInput->nChannels ) || ( nrView.vwBuffer[0]->widthStep != nrWidth * nrView.vwInput->nChannels ) || ( ln_cube_create( & nrView.vwCube, & nriDesc, nrView.vwInput->width / 4, li_bicubicf, nrView.vwThread ) != LN_SUCCESS ) ) {
 
-                        /* Create display window */
-                        cvNamedWindow( nrName, CV_WINDOW_NORMAL );
+                                /* Display message */
+                                fprintf( LC_ERR, "Error : Unable to create cube map - using mapping\n" );
 
-                        /* Setting window on full screen */
-                        cvSetWindowProperty( nrName, CV_WND_PROP_FULLSCREEN, CV_WINDOW_FULLSCREEN );
+                            }
+
+                        }
 
-                        /* Define window mouse event callback function */
-                        cvSetMouseCallback( nrName, & ( nr_view_mouse ), & ( nrMouse ) );
+                        /* Create events wake pipe - non-blocking ends */
+                        if ( pipe( nrView.vwWake ) == 0 ) {
 
-                        /* Display pseudo-infinite loop */
-                        while ( ( nrEvent = ( unsigned char ) cvWaitKey( 1 ) ) != NR_KEY_ESCAPE ) {
+                            /* Configure pipe ends */
+                            fcntl( nrView.vwWake[0], F_SETFL, O_NONBLOCK );
+                            fcntl( nrView.vwWake[1], F_SETFL, O_NONBLOCK );
 
-                            /* Boundaries management */
-                            if ( nrMouse.msAppe > NR_MAX_APPER ) {
+                        }
 
-                                /* Re-range field-of-view */
-                                nrMouse.msAppe = NR_MAX_APPER;
+                        /* Check benchmark mode */
+                        if ( nrbPath != NULL ) {
 
-                            } else
-                            if ( nrMouse.msAppe < NR_MIN_APPER ) {
+                            /* Replay benchmark path */
+                            if ( nr_view_bench( & nrView, nrbPath ) == LC_FALSE ) {
 
-                                /* Re-range field-of-view */
-                                nrMouse.msAppe = NR_MIN_APPER;
+                                /* Display message */
+                                fprintf( LC_ERR, "Error : Unable to replay benchmark path\n" );
 
                             }
 
-                            /* Keyevent management */
-                            if ( nrEvent == NR_KEY_F ) {
+                        } else
+                        if ( pthread_create( & nrWorker, NULL, & nr_view_worker, & nrView ) == 0 ) {
 
-                                /* Reset field-of-view */
-                                nrMouse.msAppe = NR_DFT_APPER;
+                            /* Check X11 presentation mode */
+                            if ( lc_stda( argc, argv, "--xshm", "-m" ) ) {
 
-                            } else
-                            if ( nrEvent == NR_KEY_R ) {
+                                /* Create X11 presentation - events thread woken through pipe */
+                                if ( ( nrView.vwWake[0] < 0 ) || ( nr_view_xcreate( & nrPresent, nrWidth, nrHeight ) == LC_FALSE ) ) {
 
-                                /* Reset angular position */
-                                nrMouse.msAzim = 0.0;
-                                nrMouse.msElev = 0.0;
+                                    /* Display message */
+                                    fprintf( LC_ERR, "Error : Unable to create X11 presentation - using highgui\n" );
 
-                                /* Reset field-of-view */
-                                nrMouse.msAppe = NR_DFT_APPER;
+                                }
 
                             }
 
-                            /* Compute gnomonic projection */
-                            lg_etg_apperturep(
-
-                                ( inter_C8_t * ) nriImage->imageData,
-                                nriImage->width,
-                                nriImage->height,
-                                nriImage->nChannels,
-                                ( inter_C8_t * ) nrdImage->imageData,
-                                nrdImage->width,
-                                nrdImage->height,
-                                nrdImage->nChannels,
-                                nrMouse.msAzim,
-                                nrMouse.msElev,
-                                0.0,
-                                nrMouse.msAppe,
-                                li_bilinearf,
-                                nrThread
-
-                            );
-
-                            /* Display image on screen */
-                            cvShowImage( nrName, nrdImage );
+                            /* Check X11 presentation */
+                            if ( nrPresent.psDisplay == NULL ) {
 
-                        }
+                                /* Create display window */
+                                cvNamedWindow( nrName, CV_WINDOW_NORMAL );
+
+                                /* Setting window on full screen */
+                                cvSetWindowProperty( nrName, CV_WND_PROP_FULLSCREEN, CV_WINDOW_FULLSCREEN );
+
+                                /* Define window mouse event callback function */
+                                cvSetMouseCallback( nrName, & ( nr_view_mouse ), & ( nrView ) );
+
+                            }
+
+                            /* Display pseudo-infinite loop - X11 events blocked on while idle, highgui events polled */
+                            while ( ( nrEvent = ( unsigned char ) ( nrPresent.psDisplay != NULL ? nr_view_xwait( & nrPresent, & nrView ) : cvWaitKey( nrWait ) ) ) != NR_KEY_ESCAPE ) {
+
+                                /* Lock viewer state */
+                                pthread_mutex_lock( & nrView.vwMutex );
+
+                                /* Keyevent management */
+                                if ( nrEvent == NR_KEY_F ) {
+
+                                    /* Reset field-of-view */
+                                    nrView.vwMouse.msAppe = NR_DFT_APPER;
+
+                                    /* Update view state */
+                                    nrView.vwMouse.msDirty = 1;
+
+                                } else
+                                if ( nrEvent == NR_KEY_R ) {
+
+                                    /* Reset angular position */
+                                    nrView.vwMouse.msAzim = 0.0;
+                                    nrView.vwMouse.msElev = 0.0;
+
+                                    /* Reset field-of-view */
+                                    nrView.vwMouse.msAppe = NR_DFT_APPER;
+
+                                    /* Update view state */
+                                    nrView.vwMouse.msDirty = 1;
+
+                                } else
+                                if ( nrEvent == NR_KEY_N ) {
+
+                                    /* Request next tour panorama */
+                                    nrView.vwSwitch ++;
 
-                        /* Destroy display window */
-                        cvDestroyWindow( nrName );
+                                } else
+                                if ( nrEvent == NR_KEY_P ) {
 
-                        /* Release image memory */
-                        cvReleaseImage( & nrdImage );
+                                    /* Request previous tour panorama */
+                                    nrView.vwSwitch --;
+
+                                } else
+                                if ( ( nrEvent == NR_KEY_SPACE ) && ( nrView.vwSequence != NULL ) ) {
+
+                                    /* Toggle sequence playback */
+                                    nr_view_spause( nrView.vwSequence );
+
+                                }
+
+                                /* Wake render thread */
+                                pthread_cond_signal( & nrView.vwCond );
+
+                                /* Check swapped frame */
+                                if ( nrView.vwReady != 0 ) {
+
+                                    /* Mark front buffer as presented */
+                                    nrView.vwShow  = nrView.vwFront;
+                                    nrView.vwReady = 0;
+
+                                    /* Unlock viewer state */
+                                    pthread_mutex_unlock( & nrView.vwMutex );
+
+                                    /* Display image on screen */
+                                    if ( nrPresent.psDisplay != NULL ) {
+
+                                        /* Present through X11 */
+                                        nr_view_xshow( & nrPresent, nrView.vwBuffer[nrView.vwShow] );
+
+                                    } else {
+
+                                        /* Present through highgui */
+                                        cvShowImage( nrName, nrView.vwBuffer[nrView.vwShow] );
+
+                                    }
+
+                                    /* Lock viewer state */
+                                    pthread_mutex_lock( & nrView.vwMutex );
+
+                                    /* Release presented buffer */
+                                    nrView.vwShow = -1;
+
+                                    /* Wake render thread */
+                                    pthread_cond_signal( & nrView.vwCond );
+
+                                }
+
+                                /* Update highgui event waiting delay */
+                                nrWait = ( nrView.vwBusy || nrView.vwReady || nrView.vwMouse.msDirty || nrView.vwMouse.msMotion || ( nrView.vwSequence != NULL ) ) ? NR_WAIT_BUSY : NR_WAIT_IDLE;
+
+                                /* Unlock viewer state */
+                                pthread_mutex_unlock( & nrView.vwMutex );
+
+                            }
+
+                            /* Request render thread termination */
+                            pthread_mutex_lock( & nrView.vwMutex );
+                            nrView.vwQuit = 1;
+                            pthread_cond_signal( & nrView.vwCond );
+                            pthread_mutex_unlock( & nrView.vwMutex );
+
+                            /* Wait render thread */
+                            pthread_join( nrWorker, NULL );
+
+                            /* Check X11 presentation */
+                            if ( nrPresent.psDisplay != NULL ) {
+
+                                /* Release X11 presentation */
+                                nr_view_xdelete( & nrPresent );
+
+                            } else {
+
+                                /* Destroy display window */
+                                cvDestroyWindow( nrName );
+
+                            }
+
+                        /* Display message */
+                        } else { fprintf( LC_ERR, "Error : Unable to create render thread\n" ); }
+
+                        /* Release events wake pipe */
+                        if ( nrView.vwWake[0] >= 0 ) { close( nrView.vwWake[0] ); close( nrView.vwWake[1] ); }
+
+                        /* Release cube map */
+                        ln_cube_delete( & nrView.vwCube );
 
                     /* Display message */
                     } else { fprintf( LC_ERR, "Error : Unable to create display buffer\n" ); }
 
+                    /* Check tiles cache */
+                    if ( nrView.vwTiles != NULL ) {
+
+                        /* Unlink low resolution level - owned by tiles cache */
+                        nrView.vwInput = NULL;
+
+                        /* Release tiles cache */
+                        nr_view_tclose( nrView.vwTiles );
+
+                    }
+
+                    /* Check tour */
+                    if ( nrView.vwTour != NULL ) {
+
+                        /* Unlink current panorama - owned by tour */
+                        nrView.vwInput = NULL;
+
+                        /* Release tour */
+                        nr_view_tourclose( nrView.vwTour );
+
+                    }
+
+                    /* Check sequence */
+                    if ( nrView.vwSequence != NULL ) {
+
+                        /* Unlink displayed frame - owned by sequence */
+                        nrView.vwInput = NULL;
+
+                        /* Display dropped frames */
+                        fprintf( LC_OUT, "Sequence : %li frame(s) dropped\n", nrView.vwSequence->sqDrop );
+
+                        /* Release sequence - loading threads notify the viewer */
+                        nr_view_sclose( nrView.vwSequence );
+
+                    }
+
+                    /* Release viewer state synchronization */
+                    pthread_cond_destroy ( & nrView.vwCond  );
+                    pthread_mutex_destroy( & nrView.vwMutex );
+
+                    /* Release reduced buffer memory */
+                    free( nrView.vwReduced );
+
+                    /* Release image memory */
+                    lc_imrelease( & nrView.vwBuffer[0] );
+                    lc_imrelease( & nrView.vwBuffer[1] );
+
                     /* Release image memory */
-                    cvReleaseImage( & nriImage );
+                    lc_imrelease( & nrView.vwInput );
 
                 /* Display message */
                 } else { fprintf( LC_ERR, "Error : Unable to read input image\n" ); }
@@ -205,6 +480,200 @@
 
     }
 
+/*
+    Source - Render thread
+ */
+
+    void * nr_view_worker( void * nrData ) {
+
+        /* Viewer state variables */
+        nr_View * nrView = ( nr_View * ) nrData;
+
+        /* View snapshot variables */
+        nr_Mouse nrMouse;
+
+        /* Back buffer variables */
+        IplImage * nrBack = NULL;
+
+        /* Reduced buffer header variables */
+        IplImage * nrlImage = NULL;
+
+        /* Rendering state variables */
+        int nrRefine = 0;
+
+        /* Tour switch variables */
+        long nrSwitch = 0;
+
+        /* Tour panorama variables */
+        IplImage * nrImage = NULL;
+
+        /* Sequence frame due variables */
+        double nrDue = HUGE_VAL;
+
+        /* Waiting deadline variables */
+        struct timespec nrUntil;
+
+        /* Adaptive resolution variables */
+        double nrFactor = 1.0;
+        double nrTime   = 0.0;
+        int    nrlWidth  = 0;
+        int    nrlHeight = 0;
+
+        /* Display variables */
+        int nrWidth  = nrView->vwBuffer[0]->width;
+        int nrHeight = nrView->vwBuffer[0]->height;
+        int nrLayers = nrView->vwBuffer[0]->nChannels;
+
+        /* Lock viewer state */
+        pthread_mutex_lock( & nrView->vwMutex );
+
+        /* Rendering loop */
+        while ( nrView->vwQuit == 0 ) {
+
+            /* Retrieve next sequence frame display time */
+            nrDue = ( nrView->vwSequence != NULL ) ? nr_view_sdue( nrView->vwSequence ) : HUGE_VAL;
+
+            /* Wait for a view change, a pending refinement or a sequence frame, with a back buffer not being presented */
+            if ( ( ( nrView->vwMouse.msDirty == 0 ) && ( nrView->vwSwitch == 0 ) && ( ( nrRefine == 0 ) || ( nrView->vwMouse.msMotion != 0 ) ) && ( nrDue > nr_view_time() ) ) || ( nrView->vwShow == 1 - nrView->vwFront ) ) {
+
+                /* Update rendering state */
+                nrView->vwBusy = 0;
+
+                /* Check sequence frame pending */
+                if ( isfinite( nrDue ) && ( nrView->vwShow != 1 - nrView->vwFront ) ) {
+
+                    /* Compute waiting deadline */
+                    clock_gettime( CLOCK_REALTIME, & nrUntil );
+
+                    /* Add remaining delay */
+                    nrDue = nrUntil.tv_sec + nrUntil.tv_nsec * 1e-9 + fmax( 0.0, nrDue - nr_view_time() );
+
+                    /* Assign waiting deadline */
+                    nrUntil.tv_sec  = ( time_t ) nrDue;
+                    nrUntil.tv_nsec = ( long ) ( ( nrDue - nrUntil.tv_sec ) * 1e9 );
+
+                    /* Wait for viewer state change or frame display time */
+                    pthread_cond_timedwait( & nrView->vwCond, & nrView->vwMutex, & nrUntil );
+
+                } else {
+
+                    /* Wait for viewer state change */
+                    pthread_cond_wait( & nrView->vwCond, & nrView->vwMutex );
+
+                }
+
+                /* Check conditions again */
+                continue;
+
+            }
+
+            /* Take latest view - intermediate states are dropped */
+            nrMouse = nrView->vwMouse;
+
+            /* Clear view state */
+            nrView->vwMouse.msDirty = 0;
+
+            /* Take pending tour switch */
+            nrSwitch = nrView->vwSwitch;
+
+            /* Clear pending tour switch */
+            nrView->vwSwitch = 0;
+
+            /* Update rendering state */
+            nrView->vwBusy = 1;
+
+            /* Retrieve back buffer */
+            nrBack = nrView->vwBuffer[1 - nrView->vwFront];
+
+            /* Unlock viewer state */
+            pthread_mutex_unlock( & nrView->vwMutex );
+
+            /* Check tour switch */
+            if ( ( nrSwitch != 0 ) && ( nrView->vwTour != NULL ) ) {
+
+                /* Switch tour panorama - view orientation kept */
+                if ( ( nrImage = nr_view_tourswitch( nrView->vwTour, nrSwitch ) ) != NULL ) nrView->vwInput = nrImage;
+
+            }
+
+            /* Check sequence */
+            if ( nrView->vwSequence != NULL ) {
+
+                /* Advance sequence frame - view orientation kept */
+                if ( ( nrImage = nr_view_sframe( nrView->vwSequence ) ) != NULL ) nrView->vwInput = nrImage;
+
+            }
+
+            /* Check view motion */
+            if ( ( nrMouse.msDirty != 0 ) && ( nrMouse.msMotion != 0 ) ) {
+
+                /* Compute reduced buffer size */
+                nrlWidth  = ( int ) ( nrWidth  * nrFactor ) + 1;
+                nrlHeight = ( int ) ( nrHeight * nrFactor ) + 1;
+
+                /* Clamp reduced buffer size */
+                if ( nrlWidth  > nrWidth  ) nrlWidth  = nrWidth;
+                if ( nrlHeight > nrHeight ) nrlHeight = nrHeight;
+
+                /* Memorize rendering start */
+                nrTime = nr_view_time();
+
+                /* Compute reduced view */
+                nr_view_render( nrView, nrView->vwReduced, nrlWidth, nrlHeight, nrLayers, & nrMouse, li_bilinearf );
+
+                /* Create reduced buffer header */
+                nrlImage = cvCreateImageHeader( cvSize( nrlWidth, nrlHeight ), IPL_DEPTH_8U, nrLayers );
+
+                /* Assign reduced buffer */
+                cvSetData( nrlImage, nrView->vwReduced, nrlWidth * nrLayers );
+
+                /* Upscale reduced view on back buffer */
+                cvResize( nrlImage, nrBack, CV_INTER_LINEAR );
+
+                /* Release reduced buffer header */
+                cvReleaseImageHeader( & nrlImage );
+
+                /* Compute rendering duration */
+                nrTime = nr_view_time() - nrTime;
+
+                /* Update resolution factor toward target frame time */
+                nrFactor = fmin( 1.0, fmax( NR_MIN_FACTOR, nrFactor * sqrt( NR_FRAME_TIME / fmax( nrTime, 1e-4 ) ) ) );
+
+                /* Request full resolution refinement */
+                nrRefine = 1;
+
+            } else {
+
+                /* Compute full resolution view */
+                nr_view_render( nrView, ( inter_C8_t * ) nrBack->imageData, nrWidth, nrHeight, nrLayers, & nrMouse, li_bicubicf );
+
+                /* Clear refinement request */
+                nrRefine = 0;
+
+            }
+
+            /* Lock viewer state */
+            pthread_mutex_lock( & nrView->vwMutex );
+
+            /* Swap buffers */
+            nrView->vwFront = 1 - nrView->vwFront;
+
+            /* Update presentation state */
+            nrView->vwReady = 1;
+
+            /* Wake events thread - interrupted write retried, full pipe (EAGAIN) already waking it */
+            while ( ( nrView->vwWake[1] >= 0 ) && ( write( nrView->vwWake[1], "", 1 ) < 0 ) && ( errno == EINTR ) );
+
+        }
+
+        /* Unlock viewer state */
+        pthread_mutex_unlock( & nrView->vwMutex );
+
+        /* Return thread result */
+        return( NULL );
+
+    }
+
 /*
     Source - Mouse callback
  */
@@ -223,8 +692,14 @@
         static double nrElev = 0.0;
         static double nrAppe = 0.0;
 
+        /* Viewer state variables */
+        nr_View * nrView = ( nr_View * ) userdata;
+
         /* Mouse handle structure variables */
-        nr_Mouse * nrMouse = ( nr_Mouse * ) userdata;
+        nr_Mouse * nrMouse = & ( nrView->vwMouse );
+
+        /* Lock viewer state */
+        pthread_mutex_lock( & nrView->vwMutex );
 
         /* Check current mode */
         if ( nrMode == NR_MS_NONE ) {
@@ -276,14 +751,2271 @@
             nrMouse->msAzim = nrAzim - ( ( ( x - nrMouseX ) / nrMouse->msWidth ) * nrMouse->msAppe );
             nrMouse->msElev = nrElev + ( ( ( y - nrMouseY ) / nrMouse->msWidth ) * nrMouse->msAppe );
 
+            /* Update view state */
+            nrMouse->msDirty = 1;
+
         } else
         if ( nrMode == NR_MS_ZOOM ) {
 
             /* Update FOV value */
             nrMouse->msAppe = nrAppe - ( ( y - nrMouseY )  * ( LG_PI / 180.0 ) * 0.20 );
 
+            /* Boundaries management */
+            if ( nrMouse->msAppe > NR_MAX_APPER ) {
+
+                /* Re-range field-of-view */
+                nrMouse->msAppe = NR_MAX_APPER;
+
+            } else
+            if ( nrMouse->msAppe < NR_MIN_APPER ) {
+
+                /* Re-range field-of-view */
+                nrMouse->msAppe = NR_MIN_APPER;
+
+            }
+
+            /* Update view state */
+            nrMouse->msDirty = 1;
+
+        }
+
+        /* Update view motion state */
+        nrMouse->msMotion = ( nrMode != NR_MS_NONE );
+
+        /* Wake render thread */
+        pthread_cond_signal( & nrView->vwCond );
+
+        /* Unlock viewer state */
+        pthread_mutex_unlock( & nrView->vwMutex );
+
+    }
+
+/*
+    Source - X11 presentation creation
+ */
+
+    int nr_view_xcreate( nr_Present * const nrPresent, int const nrWidth, int const nrHeight ) {
+
+        /* Screen variables */
+        int nrScreen = 0;
+
+        /* Visual variables */
+        Visual * nrVisual = NULL;
+
+        /* Depth variables */
+        int nrDepth = 0;
+
+        /* Window state atoms variables */
+        Atom nrState = None;
+        Atom nrFull  = None;
+
+        /* Shared segment variables */
+        int nrSegment = -1;
+
+        /* Error handler variables */
+        int ( * nrHandler ) ( Display *, XErrorEvent * ) = NULL;
+
+        /* Open display connection */
+        if ( ( nrPresent->psDisplay = XOpenDisplay( NULL ) ) == NULL ) return( LC_FALSE );
+
+        /* Retrieve default screen parameters */
+        nrScreen = DefaultScreen( nrPresent->psDisplay );
+        nrVisual = DefaultVisual( nrPresent->psDisplay, nrScreen );
+        nrDepth  = DefaultDepth ( nrPresent->psDisplay, nrScreen );
+
+        /* Verify visual pixel format - 32 bits BGRX pixels */
+        if ( ( ( nrDepth != 24 ) && ( nrDepth != 32 ) ) || ( nrVisual->red_mask != 0xff0000 ) || ( nrVisual->green_mask != 0x00ff00 ) || ( nrVisual->blue_mask != 0x0000ff ) ) {
+
+            /* Close display connection */
+            XCloseDisplay( nrPresent->psDisplay );
+
+            /* Reset display connection */
+            nrPresent->psDisplay = NULL;
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Create presentation window */
+        nrPresent->psWindow = XCreateSimpleWindow( nrPresent->psDisplay, RootWindow( nrPresent->psDisplay, nrScreen ), 0, 0, nrWidth, nrHeight, 0, BlackPixel( nrPresent->psDisplay, nrScreen ), BlackPixel( nrPresent->psDisplay, nrScreen ) );
+
+        /* Select window events */
+        XSelectInput( nrPresent->psDisplay, nrPresent->psWindow, ExposureMask | KeyPressMask | ButtonPressMask | ButtonReleaseMask | PointerMotionMask );
+
+        /* Assign window name */
+        XStoreName( nrPresent->psDisplay, nrPresent->psWindow, "norama-view" );
+
+        /* Request full screen window */
+        nrState = XInternAtom( nrPresent->psDisplay, "_NET_WM_STATE", False );
+        nrFull  = XInternAtom( nrPresent->psDisplay, "_NET_WM_STATE_FULLSCREEN", False );
+
+        /* Assign window state */
+        XChangeProperty( nrPresent->psDisplay, nrPresent->psWindow, nrState, XA_ATOM, 32, PropModeReplace, ( unsigned char * ) & nrFull, 1 );
+
+        /* Retrieve graphic context */
+        nrPresent->psGC = DefaultGC( nrPresent->psDisplay, nrScreen );
+
+        /* Reset shared memory state */
+        nrPresent->psShared = LC_FALSE;
+
+        /* Check shared memory extension */
+        if ( XShmQueryExtension( nrPresent->psDisplay ) == True ) {
+
+            /* Create shared memory image */
+            if ( ( nrPresent->psImage = XShmCreateImage( nrPresent->psDisplay, nrVisual, nrDepth, ZPixmap, NULL, & nrPresent->psShm, nrWidth, nrHeight ) ) != NULL ) {
+
+                /* Create shared memory segment */
+                if ( ( nrSegment = shmget( IPC_PRIVATE, nrPresent->psImage->bytes_per_line * nrPresent->psImage->height, IPC_CREAT | 0600 ) ) >= 0 ) {
+
+                    /* Attach shared memory segment */
+                    if ( ( nrPresent->psShm.shmaddr = shmat( nrSegment, NULL, 0 ) ) != ( char * ) -1 ) {
+
+                        /* Assign segment to image */
+                        nrPresent->psShm.shmid    = nrSegment;
+                        nrPresent->psShm.readOnly = False;
+                        nrPresent->psImage->data  = nrPresent->psShm.shmaddr;
+
+                        /* Install error handler - remote servers refuse the attachment */
+                        nr_view_xfail = LC_FALSE;
+                        nrHandler = XSetErrorHandler( & nr_view_xerror );
+
+                        /* Attach segment to server */
+                        XShmAttach( nrPresent->psDisplay, & nrPresent->psShm );
+
+                        /* Wait server attachment */
+                        XSync( nrPresent->psDisplay, False );
+
+                        /* Restore error handler */
+                        XSetErrorHandler( nrHandler );
+
+                        /* Check server attachment */
+                        if ( nr_view_xfail == LC_FALSE ) {
+
+                            /* Update shared memory state */
+                            nrPresent->psShared = LC_TRUE;
+
+                        } else {
+
+                            /* Detach shared memory segment */
+                            shmdt( nrPresent->psShm.shmaddr );
+
+                        }
+
+                    }
+
+                    /* Mark segment for removal - kept until detached */
+                    shmctl( nrSegment, IPC_RMID, NULL );
+
+                }
+
+                /* Check shared memory state */
+                if ( nrPresent->psShared == LC_FALSE ) {
+
+                    /* Release shared memory image */
+                    nrPresent->psImage->data = NULL;
+
+                    /* Release shared memory image */
+                    XDestroyImage( nrPresent->psImage );
+
+                }
+
+            }
+
         }
 
+        /* Check shared memory state */
+        if ( nrPresent->psShared == LC_FALSE ) {
+
+            /* Create client image - 32 bits pixels */
+            if ( ( nrPresent->psImage = XCreateImage( nrPresent->psDisplay, nrVisual, nrDepth, ZPixmap, 0, NULL, nrWidth, nrHeight, 32, 0 ) ) != NULL ) {
+
+                /* Allocate client image memory */
+                if ( ( nrPresent->psImage->data = ( char * ) malloc( nrPresent->psImage->bytes_per_line * nrHeight ) ) == NULL ) {
+
+                    /* Release client image */
+                    XDestroyImage( nrPresent->psImage );
+
+                    /* Reset client image */
+                    nrPresent->psImage = NULL;
+
+                }
+
+            }
+
+            /* Check client image */
+            if ( nrPresent->psImage == NULL ) {
+
+                /* Release window */
+                XDestroyWindow( nrPresent->psDisplay, nrPresent->psWindow );
+
+                /* Close display connection */
+                XCloseDisplay( nrPresent->psDisplay );
+
+                /* Reset display connection */
+                nrPresent->psDisplay = NULL;
+
+                /* Send message */
+                return( LC_FALSE );
+
+            }
+
+        }
+
+        /* Map presentation window */
+        XMapWindow( nrPresent->psDisplay, nrPresent->psWindow );
+
+        /* Flush requests */
+        XFlush( nrPresent->psDisplay );
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - X11 presentation events
+ */
+
+    int nr_view_xwait( nr_Present * const nrPresent, nr_View * const nrView ) {
+
+        /* Event variables */
+        XEvent nrEvent;
+
+        /* Key variables */
+        int  nrKey  = -1;
+        char nrChar = 0;
+
+        /* Wake pipe drain variables */
+        char nrDrain[64];
+
+        /* Connection descriptor variables */
+        int nrConnect = ConnectionNumber( nrPresent->psDisplay );
+
+        /* Descriptor set variables */
+        fd_set nrSet;
+
+        /* Check pending events */
+        if ( XPending( nrPresent->psDisplay ) == 0 ) {
+
+            /* Build descriptor set - connection and wake pipe */
+            FD_ZERO( & nrSet );
+            FD_SET( nrConnect, & nrSet );
+            FD_SET( nrView->vwWake[0], & nrSet );
+
+            /* Wait connection activity or render thread wake - no timeout */
+            select( ( nrConnect > nrView->vwWake[0] ? nrConnect : nrView->vwWake[0] ) + 1, & nrSet, NULL, NULL, NULL );
+
+        }
+
+        /* Drain wake pipe - presentation state checked by caller */
+        while ( read( nrView->vwWake[0], nrDrain, sizeof( nrDrain ) ) > 0 );
+
+        /* Dispatch pending events */
+        while ( XPending( nrPresent->psDisplay ) > 0 ) {
+
+            /* Read event */
+            XNextEvent( nrPresent->psDisplay, & nrEvent );
+
+            /* Check event type */
+            if ( nrEvent.type == ButtonPress ) {
+
+                /* Forward button press */
+                if ( nrEvent.xbutton.button == Button1 ) nr_view_mouse( CV_EVENT_LBUTTONDOWN, nrEvent.xbutton.x, nrEvent.xbutton.y, 0, nrView );
+                if ( nrEvent.xbutton.button == Button3 ) nr_view_mouse( CV_EVENT_RBUTTONDOWN, nrEvent.xbutton.x, nrEvent.xbutton.y, 0, nrView );
+
+            } else
+            if ( nrEvent.type == ButtonRelease ) {
+
+                /* Forward button release */
+                if ( nrEvent.xbutton.button == Button1 ) nr_view_mouse( CV_EVENT_LBUTTONUP, nrEvent.xbutton.x, nrEvent.xbutton.y, 0, nrView );
+                if ( nrEvent.xbutton.button == Button3 ) nr_view_mouse( CV_EVENT_RBUTTONUP, nrEvent.xbutton.x, nrEvent.xbutton.y, 0, nrView );
+
+            } else
+            if ( nrEvent.type == MotionNotify ) {
+
+                /* Forward mouse motion */
+                nr_view_mouse( CV_EVENT_MOUSEMOVE, nrEvent.xmotion.x, nrEvent.xmotion.y, 0, nrView );
+
+            } else
+            if ( nrEvent.type == KeyPress ) {
+
+                /* Translate key - first key kept */
+                if ( ( XLookupString( & nrEvent.xkey, & nrChar, 1, NULL, NULL ) == 1 ) && ( nrKey < 0 ) ) nrKey = ( unsigned char ) nrChar;
+
+            } else
+            if ( ( nrEvent.type == Expose ) && ( nrEvent.xexpose.count == 0 ) ) {
+
+                /* Request front buffer presentation */
+                pthread_mutex_lock( & nrView->vwMutex );
+                nrView->vwReady = 1;
+                pthread_mutex_unlock( & nrView->vwMutex );
+
+            }
+
+        }
+
+        /* Return key code */
+        return( nrKey );
+
+    }
+
+/*
+    Source - X11 presentation display
+ */
+
+    void nr_view_xshow( nr_Present * const nrPresent, IplImage const * const nrImage ) {
+
+        /* Presentation image header variables */
+        IplImage * nrHeader = cvCreateImageHeader( cvSize( nrPresent->psImage->width, nrPresent->psImage->height ), IPL_DEPTH_8U, 4 );
+
+        /* Assign presentation image memory */
+        cvSetData( nrHeader, nrPresent->psImage->data, nrPresent->psImage->bytes_per_line );
+
+        /* Convert display buffer to presentation format */
+        if ( nrImage->nChannels == 1 ) {
+
+            /* Convert grayscale buffer */
+            cvCvtColor( nrImage, nrHeader, CV_GRAY2BGRA );
+
+        } else
+        if ( nrImage->nChannels == 3 ) {
+
+            /* Convert color buffer */
+            cvCvtColor( nrImage, nrHeader, CV_BGR2BGRA );
+
+        } else {
+
+            /* Copy buffer */
+            cvCopy( nrImage, nrHeader, NULL );
+
+        }
+
+        /* Release presentation image header */
+        cvReleaseImageHeader( & nrHeader );
+
+        /* Check shared memory state */
+        if ( nrPresent->psShared == LC_TRUE ) {
+
+            /* Put shared image on window */
+            XShmPutImage( nrPresent->psDisplay, nrPresent->psWindow, nrPresent->psGC, nrPresent->psImage, 0, 0, 0, 0, nrPresent->psImage->width, nrPresent->psImage->height, False );
+
+        } else {
+
+            /* Put client image on window */
+            XPutImage( nrPresent->psDisplay, nrPresent->psWindow, nrPresent->psGC, nrPresent->psImage, 0, 0, 0, 0, nrPresent->psImage->width, nrPresent->psImage->height );
+
+        }
+
+        /* Wait server completion */
+        XSync( nrPresent->psDisplay, False );
+
+    }
+
+/*
+    Source - X11 presentation deletion
+ */
+
+    void nr_view_xdelete( nr_Present * const nrPresent ) {
+
+        /* Check display connection */
+        if ( nrPresent->psDisplay == NULL ) return;
+
+        /* Check shared memory state */
+        if ( nrPresent->psShared == LC_TRUE ) {
+
+            /* Detach segment from server */
+            XShmDetach( nrPresent->psDisplay, & nrPresent->psShm );
+
+            /* Wait server detachment */
+            XSync( nrPresent->psDisplay, False );
+
+            /* Detach shared memory segment */
+            shmdt( nrPresent->psShm.shmaddr );
+
+            /* Unlink image memory */
+            nrPresent->psImage->data = NULL;
+
+        }
+
+        /* Release presentation image */
+        XDestroyImage( nrPresent->psImage );
+
+        /* Release window */
+        XDestroyWindow( nrPresent->psDisplay, nrPresent->psWindow );
+
+        /* Close display connection */
+        XCloseDisplay( nrPresent->psDisplay );
+
+        /* Reset display connection */
+        nrPresent->psDisplay = NULL;
+
+    }
+
+/*
+    Source - X11 error handler
+ */
+
+    int nr_view_xerror( Display * nrDisplay, XErrorEvent * nrError ) {
+
+        /* Record error occurrence */
+        nr_view_xfail = LC_TRUE;
+
+        /* Return to Xlib */
+        return( 0 );
+
+    }
+
+/*
+    Source - View rendering
+ */
+
+    void nr_view_render( 
+
+        nr_View        const * const nrView, 
+        inter_C8_t           * const nrBytes, 
+        int                    const nrWidth, 
+        int                    const nrHeight, 
+        int                    const nrLayers, 
+        nr_Mouse       const * const nrMouse, 
+        li_Method_t            const nrMethod 
+
+    ) {
+
+        /* Output descriptor variables */
+        ln_Image_t nrOutput = { nrBytes, nrWidth, nrHeight, nrLayers };
+
+        /* Check tiled mode */
+        if ( nrView->vwTiles != NULL ) {
+
+            /* Compute rectilinear view from tiles */
+            nr_view_trender( nrView->vwTiles, nrBytes, nrWidth, nrHeight, nrLayers, nrMouse, nrView->vwThread );
+
+        } else
+        if ( nrView->vwCube.cbBytes != NULL ) {
+
+            /* Compute rectilinear view from cube map - view angles expressed in libnorama frame */
+            ln_cube_view( & nrView->vwCube, & nrOutput, nrMouse->msAzim - NR_FRAME_AZIM, nrMouse->msElev, 0.0, nrMouse->msAppe, nrMethod, nrView->vwThread );
+
+        } else {
+
+            /* Compute gnomonic projection */
+            lg_etg_apperturep(
+
+                ( inter_C8_t * ) nrView->vwInput->imageData,
+                nrView->vwInput->width,
+                nrView->vwInput->height,
+                nrView->vwInput->nChannels,
+                nrBytes,
+                nrWidth,
+                nrHeight,
+                nrLayers,
+                nrMouse->msAzim,
+                nrMouse->msElev,
+                0.0,
+                nrMouse->msAppe,
+                nrMethod,
+                nrView->vwThread
+
+            );
+
+        }
+
+    }
+
+/*
+    Source - Tiles pyramid opening
+ */
+
+    int nr_view_topen( 
+
+        nr_Tiles       * const nrTiles, 
+        char           * const nrPath, 
+        char           * const nrExt, 
+        long             const nrBudget, 
+        int              const nrLoaders, 
+        int              const nrThread, 
+        nr_View        * const nrView 
+
+    ) {
+
+        /* Path variables */
+        char nrFile[PATH_MAX];
+
+        /* Directory status variables */
+        struct stat nrStat;
+
+        /* Probe image variables */
+        IplImage * nrProbe = NULL;
+
+        /* Level size variables */
+        long nrSize = 0;
+
+        /* Base assembly failures variables */
+        long nrFail = 0;
+
+        /* Parsing variables */
+        int  nrLevel = 0;
+        long nrParse = 0;
+
+        /* Reset tiles cache */
+        memset( nrTiles, 0, sizeof( nr_Tiles ) );
+
+        /* Initialize tiles cache synchronization */
+        pthread_mutex_init( & nrTiles->tsMutex, NULL );
+        pthread_cond_init ( & nrTiles->tsCond , NULL );
+
+        /* Assign pyramid parameters */
+        nrTiles->tsPath   = nrPath;
+        nrTiles->tsExt    = nrExt;
+        nrTiles->tsBudget = ( size_t ) nrBudget << 20;
+        nrTiles->tsView   = nrView;
+
+        /* Detect pyramid levels */
+        for ( nrTiles->tsCount = 0; nrTiles->tsCount < NR_MAX_LEVEL; nrTiles->tsCount ++ ) {
+
+            /* Compose level directory */
+            snprintf( nrFile, PATH_MAX, "%s/%d/%c", nrPath, nrTiles->tsCount, NR_EQUI_TAG );
+
+            /* Check level directory */
+            if ( ( stat( nrFile, & nrStat ) != 0 ) || ( S_ISDIR( nrStat.st_mode ) == 0 ) ) break;
+
+        }
+
+        /* Check pyramid levels */
+        if ( nrTiles->tsCount == 0 ) { nr_view_tclose( nrTiles ); return( LC_FALSE ); }
+
+        /* Compose first tile path */
+        snprintf( nrFile, PATH_MAX, "%s/0/%c/0_0.%s", nrPath, NR_EQUI_TAG, nrExt );
+
+        /* Import first tile */
+        if ( ( nrProbe = lc_imread( nrFile, CV_LOAD_IMAGE_UNCHANGED ) ) == NULL ) { nr_view_tclose( nrTiles ); return( LC_FALSE ); }
+
+        /* Detect tiles size and layers */
+        nrTiles->tsTile   = nrProbe->width;
+        nrTiles->tsLayers = nrProbe->nChannels;
+
+        /* Release first tile */
+        lc_imrelease( & nrProbe );
+
+        /* Select low resolution level */
+        while ( ( nrTiles->tsBase + 1 < nrTiles->tsCount ) && ( ( 2L * nrTiles->tsTile ) << ( nrTiles->tsBase + 1 ) ) <= NR_TILE_BASE ) nrTiles->tsBase ++;
+
+        /* Create levels tiles arrays */
+        for ( nrLevel = 0; nrLevel < nrTiles->tsCount; nrLevel ++ ) {
+
+            /* Compute level tiles count */
+            nrSize = 2L << ( 2 * nrLevel );
+
+            /* Allocate level tiles */
+            if ( ( nrTiles->tsGrid[nrLevel] = ( nr_Tile * ) calloc( nrSize, sizeof( nr_Tile ) ) ) == NULL ) { nr_view_tclose( nrTiles ); return( LC_FALSE ); }
+
+            /* Assign tiles positions */
+            for ( nrParse = 0; nrParse < nrSize; nrParse ++ ) {
+
+                /* Assign tile position */
+                nrTiles->tsGrid[nrLevel][nrParse].tlLevel = nrLevel;
+                nrTiles->tsGrid[nrLevel][nrParse].tlRow   = nrParse / ( 2L << nrLevel );
+                nrTiles->tsGrid[nrLevel][nrParse].tlCol   = nrParse % ( 2L << nrLevel );
+
+            }
+
+        }
+
+        /* Allocate frame arrays - sized on top level */
+        nrTiles->tsFrame = ( IplImage     ** ) calloc( nrSize, sizeof( IplImage * ) );
+        nrTiles->tsUsage = ( unsigned char * ) calloc( nrSize, sizeof( unsigned char ) );
+        nrTiles->tsQueue = ( nr_Tile      ** ) calloc( nrSize, sizeof( nr_Tile * ) );
+
+        /* Verify allocations */
+        if ( ( nrTiles->tsFrame == NULL ) || ( nrTiles->tsUsage == NULL ) || ( nrTiles->tsQueue == NULL ) ) { nr_view_tclose( nrTiles ); return( LC_FALSE ); }
+
+        /* Create low resolution level image */
+        if ( ( nrTiles->tsImage = cvCreateImage( cvSize( ( 2 * nrTiles->tsTile ) << nrTiles->tsBase, nrTiles->tsTile << nrTiles->tsBase ), IPL_DEPTH_8U, nrTiles->tsLayers ) ) == NULL ) { nr_view_tclose( nrTiles ); return( LC_FALSE ); }
+
+        /* Verify packed rows - required by interpolation */
+        if ( nrTiles->tsImage->widthStep != nrTiles->tsImage->width * nrTiles->tsLayers ) { nr_view_tclose( nrTiles ); return( LC_FALSE ); }
+
+        /* Compute low resolution level tiles count */
+        nrSize = 2L << ( 2 * nrTiles->tsBase );
+
+        /* Assemble low resolution level */
+        # pragma omp parallel for num_threads( nrThread ) schedule( dynamic ) reduction( + : nrFail )
+        for ( long nrIndex = 0; nrIndex < nrSize; nrIndex ++ ) {
+
+            /* Tile variables */
+            nr_Tile * nrTile = nrTiles->tsGrid[nrTiles->tsBase] + nrIndex;
+
+            /* Path variables */
+            char nrTilePath[PATH_MAX];
+
+            /* Tile image variables */
+            IplImage * nrImage = NULL;
+
+            /* Compose tile path */
+            snprintf( nrTilePath, PATH_MAX, "%s/%d/%c/%d_%d.%s", nrPath, nrTile->tlLevel, NR_EQUI_TAG, nrTile->tlRow, nrTile->tlCol, nrExt );
+
+            /* Import tile and verify format */
+            if ( ( ( nrImage = lc_imread( nrTilePath, CV_LOAD_IMAGE_UNCHANGED ) ) == NULL ) || ( nrImage->width != nrTiles->tsTile ) || ( nrImage->height != nrTiles->tsTile ) || ( nrImage->nChannels != nrTiles->tsLayers ) ) {
+
+                /* Update failures */
+                nrFail ++;
+
+            } else {
+
+                /* Copy tile rows */
+                for ( int nrRow = 0; nrRow < nrTiles->tsTile; nrRow ++ ) {
+
+                    /* Copy tile row in level image */
+                    memcpy( 
+
+                        nrTiles->tsImage->imageData + ( ( size_t ) nrTile->tlRow * nrTiles->tsTile + nrRow ) * nrTiles->tsImage->widthStep + ( size_t ) nrTile->tlCol * nrTiles->tsTile * nrTiles->tsLayers, 
+                        nrImage->imageData + ( size_t ) nrRow * nrImage->widthStep, 
+                        ( size_t ) nrTiles->tsTile * nrTiles->tsLayers 
+
+                    );
+
+                }
+
+            }
+
+            /* Release tile image */
+            if ( nrImage != NULL ) lc_imrelease( & nrImage );
+
+        }
+
+        /* Check low resolution level assembly */
+        if ( nrFail > 0 ) {
+
+            /* Release tiles cache and low resolution level image */
+            nr_view_tclose( nrTiles );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Allocate loading threads handles */
+        if ( ( nrTiles->tsLoader = ( pthread_t * ) malloc( nrLoaders * sizeof( pthread_t ) ) ) == NULL ) { nr_view_tclose( nrTiles ); return( LC_FALSE ); }
+
+        /* Create loading threads */
+        while ( ( nrTiles->tsLoaders < nrLoaders ) && ( pthread_create( nrTiles->tsLoader + nrTiles->tsLoaders, NULL, & nr_view_tloader, nrTiles ) == 0 ) ) nrTiles->tsLoaders ++;
+
+        /* Check loading threads */
+        if ( nrTiles->tsLoaders == 0 ) { nr_view_tclose( nrTiles ); return( LC_FALSE ); }
+
+        /* Return status */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Tiles pyramid closing
+ */
+
+    void nr_view_tclose( nr_Tiles * const nrTiles ) {
+
+        /* Parsing variables */
+        int  nrLevel = 0;
+        long nrParse = 0;
+
+        /* Request loading threads termination */
+        pthread_mutex_lock( & nrTiles->tsMutex );
+        nrTiles->tsQuit = 1;
+        pthread_cond_broadcast( & nrTiles->tsCond );
+        pthread_mutex_unlock( & nrTiles->tsMutex );
+
+        /* Wait loading threads */
+        for ( nrParse = 0; nrParse < nrTiles->tsLoaders; nrParse ++ ) pthread_join( nrTiles->tsLoader[nrParse], NULL );
+
+        /* Release levels tiles */
+        for ( nrLevel = 0; nrLevel < nrTiles->tsCount; nrLevel ++ ) {
+
+            /* Check level tiles */
+            if ( nrTiles->tsGrid[nrLevel] == NULL ) continue;
+
+            /* Release loaded tiles images */
+            for ( nrParse = 0; nrParse < ( 2L << ( 2 * nrLevel ) ); nrParse ++ ) {
+
+                /* Release tile image */
+                if ( nrTiles->tsGrid[nrLevel][nrParse].tlImage != NULL ) lc_imrelease( & nrTiles->tsGrid[nrLevel][nrParse].tlImage );
+
+            }
+
+            /* Release level tiles */
+            free( nrTiles->tsGrid[nrLevel] );
+
+        }
+
+        /* Release low resolution level image */
+        lc_imrelease( & nrTiles->tsImage );
+
+        /* Release cache arrays */
+        free( nrTiles->tsLoader );
+        free( nrTiles->tsFrame  );
+        free( nrTiles->tsUsage  );
+        free( nrTiles->tsQueue  );
+
+        /* Release tiles cache synchronization */
+        pthread_cond_destroy ( & nrTiles->tsCond  );
+        pthread_mutex_destroy( & nrTiles->tsMutex );
+
+    }
+
+/*
+    Source - Tiles loading thread
+ */
+
+    void * nr_view_tloader( void * nrData ) {
+
+        /* Tiles cache variables */
+        nr_Tiles * nrTiles = ( nr_Tiles * ) nrData;
+
+        /* Tile variables */
+        nr_Tile * nrTile = NULL;
+
+        /* Tile image variables */
+        IplImage * nrImage = NULL;
+
+        /* Path variables */
+        char nrFile[PATH_MAX];
+
+        /* Lock tiles cache */
+        pthread_mutex_lock( & nrTiles->tsMutex );
+
+        /* Loading loop */
+        while ( nrTiles->tsQuit == 0 ) {
+
+            /* Wait for requests */
+            if ( nrTiles->tsPending == 0 ) {
+
+                /* Wait for requests */
+                pthread_cond_wait( & nrTiles->tsCond, & nrTiles->tsMutex );
+
+                /* Check conditions again */
+                continue;
+
+            }
+
+            /* Pop most urgent request */
+            nrTile = nrTiles->tsQueue[-- nrTiles->tsPending];
+
+            /* Update tile state */
+            nrTile->tlState = NR_TILE_LOADING;
+
+            /* Unlock tiles cache */
+            pthread_mutex_unlock( & nrTiles->tsMutex );
+
+            /* Compose tile path */
+            snprintf( nrFile, PATH_MAX, "%s/%d/%c/%d_%d.%s", nrTiles->tsPath, nrTile->tlLevel, NR_EQUI_TAG, nrTile->tlRow, nrTile->tlCol, nrTiles->tsExt );
+
+            /* Import tile and verify format */
+            if ( ( ( nrImage = lc_imread( nrFile, CV_LOAD_IMAGE_UNCHANGED ) ) != NULL ) && ( ( nrImage->width != nrTiles->tsTile ) || ( nrImage->height != nrTiles->tsTile ) || ( nrImage->nChannels != nrTiles->tsLayers ) ) ) {
+
+                /* Release mismatching tile */
+                lc_imrelease( & nrImage );
+
+            }
+
+            /* Lock tiles cache */
+            pthread_mutex_lock( & nrTiles->tsMutex );
+
+            /* Check tile image */
+            if ( nrImage != NULL ) {
+
+                /* Assign tile image */
+                nrTile->tlImage = nrImage;
+                nrTile->tlState = NR_TILE_READY;
+
+                /* Update cache memory */
+                nrTiles->tsMemory += nrImage->imageSize;
+
+                /* Insert tile on least recently used list head */
+                nrTile->tlPrev = NULL;
+                nrTile->tlNext = nrTiles->tsHead;
+
+                /* Update list links */
+                if ( nrTiles->tsHead != NULL ) nrTiles->tsHead->tlPrev = nrTile; else nrTiles->tsTail = nrTile;
+
+                /* Update list head */
+                nrTiles->tsHead = nrTile;
+
+            } else {
+
+                /* Update tile state */
+                nrTile->tlState = NR_TILE_FAILED;
+
+            }
+
+            /* Unlock tiles cache */
+            pthread_mutex_unlock( & nrTiles->tsMutex );
+
+            /* Request view refinement */
+            pthread_mutex_lock( & nrTiles->tsView->vwMutex );
+            nrTiles->tsView->vwMouse.msDirty = 1;
+            pthread_cond_signal( & nrTiles->tsView->vwCond );
+            pthread_mutex_unlock( & nrTiles->tsView->vwMutex );
+
+            /* Lock tiles cache */
+            pthread_mutex_lock( & nrTiles->tsMutex );
+
+        }
+
+        /* Unlock tiles cache */
+        pthread_mutex_unlock( & nrTiles->tsMutex );
+
+        /* Return thread result */
+        return( NULL );
+
+    }
+
+/*
+    Source - Tiles view rendering
+ */
+
+    void nr_view_trender( 
+
+        nr_Tiles             * const nrTiles, 
+        inter_C8_t           * const nrBytes, 
+        int                    const nrWidth, 
+        int                    const nrHeight, 
+        int                    const nrLayers, 
+        nr_Mouse       const * const nrMouse, 
+        int                    const nrThread 
+
+    ) {
+
+        /* View frame variables */
+        double nrView[3][3];
+
+        /* View focal length variables, in pixels */
+        double nrFocal = ( nrWidth / 2.0 ) / tan( nrMouse->msAppe / 2.0 );
+
+        /* Level variables */
+        int nrLevel = 0;
+
+        /* Level geometry variables */
+        long nrCols   = 0;
+        long nrSize   = 0;
+        int  nrlWidth  = 0;
+        int  nrlHeight = 0;
+
+        /* View center variables */
+        double nrU = 0.0;
+        double nrV = 0.0;
+
+        /* Tile distance variables */
+        long nrDX = 0;
+        long nrDY = 0;
+
+        /* Tile variables */
+        nr_Tile * nrTile = NULL;
+
+        /* Parsing variables */
+        long nrParse = 0;
+
+        /* Select level matching view resolution */
+        while ( ( nrLevel + 1 < nrTiles->tsCount ) && ( ( ( 2.0 * nrTiles->tsTile ) * ( 1L << nrLevel ) ) < ( 2.0 * LG_PI * nrWidth / nrMouse->msAppe ) ) ) nrLevel ++;
+
+        /* Use low resolution level below it */
+        if ( nrLevel < nrTiles->tsBase ) nrLevel = nrTiles->tsBase;
+
+        /* Compute level geometry */
+        nrCols    = 2L << nrLevel;
+        nrSize    = nrCols << nrLevel;
+        nrlWidth  = nrTiles->tsTile * nrCols;
+        nrlHeight = nrTiles->tsTile << nrLevel;
+
+        /* Lock tiles cache */
+        pthread_mutex_lock( & nrTiles->tsMutex );
+
+        /* Capture level tiles images */
+        for ( nrParse = 0; nrParse < nrSize; nrParse ++ ) {
+
+            /* Capture tile image - low resolution level always available */
+            nrTiles->tsFrame[nrParse] = ( nrLevel == nrTiles->tsBase ) ? NULL : nrTiles->tsGrid[nrLevel][nrParse].tlImage;
+
+        }
+
+        /* Unlock tiles cache */
+        pthread_mutex_unlock( & nrTiles->tsMutex );
+
+        /* Reset tiles usages */
+        memset( nrTiles->tsUsage, NR_USE_NONE, nrSize );
+
+        /* Compute view frame - view angles expressed in libnorama frame */
+        ln_cube_sight( nrMouse->msAzim - NR_FRAME_AZIM, nrMouse->msElev, 0.0, nrView );
+
+        /* Process view rows */
+        # pragma omp parallel for num_threads( nrThread ) schedule( dynamic )
+        for ( int nrRow = 0; nrRow < nrHeight; nrRow ++ ) {
+
+            /* View plane coordinates variables */
+            double nrH = 0.0;
+            double nrP = ( nrRow + 0.5 - nrHeight / 2.0 ) / nrFocal;
+
+            /* Level coordinates variables */
+            double nrX = 0.0;
+            double nrY = 0.0;
+
+            /* Interpolation variables */
+            long   nrPX[2];
+            long   nrPY[2];
+            double nrFX = 0.0;
+            double nrFY = 0.0;
+
+            /* Neighbour pixels variables */
+            unsigned char const * nrPixel[4];
+
+            /* Neighbour tile variables */
+            long nrIndex = 0;
+
+            /* Neighbour availability variables */
+            int nrMiss = 0;
+
+            /* Output pointer variables */
+            inter_C8_t * nrOutput = nrBytes + ( size_t ) nrRow * nrWidth * nrLayers;
+
+            /* Process view row */
+            for ( int nrCol = 0; nrCol < nrWidth; nrCol ++, nrOutput += nrLayers ) {
+
+                /* Compute view plane coordinate */
+                nrH = ( nrCol + 0.5 - nrWidth / 2.0 ) / nrFocal;
+
+                /* Compute level mapping coordinates */
+                ln_cube_mapping( 
+
+                    nrView[0][0] + nrH * nrView[1][0] - nrP * nrView[2][0], 
+                    nrView[0][1] + nrH * nrView[1][1] - nrP * nrView[2][1], 
+                    nrView[0][2] + nrH * nrView[1][2] - nrP * nrView[2][2], 
+                    nrlWidth, 
+                    nrlHeight, 
+                    & nrX, 
+                    & nrY 
+
+                );
+
+                /* Reset neighbour availability */
+                nrMiss = ( nrLevel == nrTiles->tsBase );
+
+                /* Check full resolution level */
+                if ( nrMiss == 0 ) {
+
+                    /* Compute neighbour pixels coordinates - wrapped and clamped */
+                    nrPX[0] = ( long ) floor( nrX );
+                    nrPY[0] = ( long ) floor( nrY );
+                    nrFX = nrX - nrPX[0];
+                    nrFY = nrY - nrPY[0];
+                    nrPX[1] = nrPX[0] + 1;
+                    nrPY[1] = nrPY[0] + 1;
+                    nrPX[0] = ( nrPX[0] + nrlWidth ) % nrlWidth;
+                    nrPX[1] = ( nrPX[1] + nrlWidth ) % nrlWidth;
+                    nrPY[0] = nrPY[0] < 0 ? 0 : ( nrPY[0] >= nrlHeight ? nrlHeight - 1 : nrPY[0] );
+                    nrPY[1] = nrPY[1] < 0 ? 0 : ( nrPY[1] >= nrlHeight ? nrlHeight - 1 : nrPY[1] );
+
+                    /* Retrieve neighbour pixels */
+                    for ( int nrNeighbour = 0; nrNeighbour < 4; nrNeighbour ++ ) {
+
+                        /* Compute neighbour tile index */
+                        nrIndex = ( nrPY[nrNeighbour >> 1] / nrTiles->tsTile ) * nrCols + nrPX[nrNeighbour & 1] / nrTiles->tsTile;
+
+                        /* Check neighbour tile */
+                        if ( nrTiles->tsFrame[nrIndex] != NULL ) {
+
+                            /* Retrieve neighbour pixel */
+                            nrPixel[nrNeighbour] = ( unsigned char * ) nrTiles->tsFrame[nrIndex]->imageData + ( nrPY[nrNeighbour >> 1] % nrTiles->tsTile ) * nrTiles->tsFrame[nrIndex]->widthStep + ( nrPX[nrNeighbour & 1] % nrTiles->tsTile ) * nrLayers;
+
+                            /* Update tile usage */
+                            nrTiles->tsUsage[nrIndex] = NR_USE_HIT;
+
+                        } else {
+
+                            /* Update tile usage */
+                            nrTiles->tsUsage[nrIndex] = NR_USE_MISS;
+
+                            /* Update neighbour availability */
+                            nrMiss = 1;
+
+                        }
+
+                    }
+
+                }
+
+                /* Check neighbour availability */
+                if ( nrMiss == 0 ) {
+
+                    /* Interpolate pixel layers */
+                    for ( int nrLayer = 0; nrLayer < nrLayers; nrLayer ++ ) {
+
+                        /* Assign interpolated component */
+                        nrOutput[nrLayer] = ( inter_C8_t ) ( 
+
+                            ( 1.0 - nrFY ) * ( ( 1.0 - nrFX ) * nrPixel[0][nrLayer] + nrFX * nrPixel[1][nrLayer] ) + 
+                            (       nrFY ) * ( ( 1.0 - nrFX ) * nrPixel[2][nrLayer] + nrFX * nrPixel[3][nrLayer] ) + 0.5 
+
+                        );
+
+                    }
+
+                } else {
+
+                    /* Compute low resolution level coordinates */
+                    nrX = ( nrX + 0.5 ) * nrTiles->tsImage->width  / nrlWidth  - 0.5;
+                    nrY = ( nrY + 0.5 ) * nrTiles->tsImage->height / nrlHeight - 0.5;
+
+                    /* Interpolate pixel layers on low resolution level */
+                    for ( int nrLayer = 0; nrLayer < nrLayers; nrLayer ++ ) {
+
+                        /* Assign interpolated component */
+                        nrOutput[nrLayer] = li_bilinearf( ( inter_C8_t * ) nrTiles->tsImage->imageData, nrTiles->tsImage->width, nrTiles->tsImage->height, nrLayers, nrLayer, nrX, nrY );
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        /* Check full resolution level */
+        if ( nrLevel == nrTiles->tsBase ) return;
+
+        /* Compute view center level coordinates */
+        ln_cube_mapping( nrView[0][0], nrView[0][1], nrView[0][2], nrlWidth, nrlHeight, & nrU, & nrV );
+
+        /* Lock tiles cache */
+        pthread_mutex_lock( & nrTiles->tsMutex );
+
+        /* Drop previous frame requests */
+        while ( nrTiles->tsPending > 0 ) nrTiles->tsQueue[-- nrTiles->tsPending]->tlState = NR_TILE_NONE;
+
+        /* Process level tiles usages */
+        for ( nrParse = 0; nrParse < nrSize; nrParse ++ ) {
+
+            /* Retrieve tile */
+            nrTile = nrTiles->tsGrid[nrLevel] + nrParse;
+
+            /* Check tile usage */
+            if ( ( nrTiles->tsUsage[nrParse] == NR_USE_MISS ) && ( nrTile->tlState == NR_TILE_NONE ) ) {
+
+                /* Compute tile distance to view center - wrapped columns */
+                nrDX = labs( nrTile->tlCol - ( long ) ( nrU / nrTiles->tsTile ) );
+                nrDY = labs( nrTile->tlRow - ( long ) ( nrV / nrTiles->tsTile ) );
+
+                /* Assign tile priority */
+                nrTile->tlOrder = ( nrDX < nrCols - nrDX ? nrDX : nrCols - nrDX ) + nrDY;
+
+                /* Update tile state */
+                nrTile->tlState = NR_TILE_QUEUED;
+
+                /* Push tile request */
+                nrTiles->tsQueue[nrTiles->tsPending ++] = nrTile;
+
+            } else
+            if ( ( nrTiles->tsUsage[nrParse] == NR_USE_HIT ) && ( nrTile->tlState == NR_TILE_READY ) && ( nrTile != nrTiles->tsHead ) ) {
+
+                /* Unlink tile from least recently used list */
+                nrTile->tlPrev->tlNext = nrTile->tlNext;
+
+                /* Update list links */
+                if ( nrTile->tlNext != NULL ) nrTile->tlNext->tlPrev = nrTile->tlPrev; else nrTiles->tsTail = nrTile->tlPrev;
+
+                /* Insert tile on list head */
+                nrTile->tlPrev = NULL;
+                nrTile->tlNext = nrTiles->tsHead;
+                nrTiles->tsHead->tlPrev = nrTile;
+                nrTiles->tsHead = nrTile;
+
+            }
+
+        }
+
+        /* Sort tiles requests - nearest on top */
+        qsort( nrTiles->tsQueue, nrTiles->tsPending, sizeof( nr_Tile * ), & nr_view_torder );
+
+        /* Release least recently used tiles exceeding budget */
+        while ( ( nrTiles->tsMemory > nrTiles->tsBudget ) && ( ( nrTile = nrTiles->tsTail ) != NULL ) ) {
+
+            /* Keep tiles used by current frame */
+            if ( ( nrTile->tlLevel == nrLevel ) && ( nrTiles->tsUsage[( long ) nrTile->tlRow * nrCols + nrTile->tlCol] == NR_USE_HIT ) ) break;
+
+            /* Unlink tile from least recently used list */
+            nrTiles->tsTail = nrTile->tlPrev;
+
+            /* Update list links */
+            if ( nrTiles->tsTail != NULL ) nrTiles->tsTail->tlNext = NULL; else nrTiles->tsHead = NULL;
+
+            /* Update cache memory */
+            nrTiles->tsMemory -= nrTile->tlImage->imageSize;
+
+            /* Release tile image */
+            lc_imrelease( & nrTile->tlImage );
+
+            /* Update tile state */
+            nrTile->tlState = NR_TILE_NONE;
+
+        }
+
+        /* Wake loading threads */
+        if ( nrTiles->tsPending > 0 ) pthread_cond_broadcast( & nrTiles->tsCond );
+
+        /* Unlock tiles cache */
+        pthread_mutex_unlock( & nrTiles->tsMutex );
+
+    }
+
+/*
+    Source - Tiles requests ordering
+ */
+
+    int nr_view_torder( void const * nrA, void const * nrB ) {
+
+        /* Tiles priorities variables */
+        long nrOrderA = ( * ( nr_Tile * const * ) nrA )->tlOrder;
+        long nrOrderB = ( * ( nr_Tile * const * ) nrB )->tlOrder;
+
+        /* Compare tiles priorities - decreasing distance */
+        return( nrOrderA > nrOrderB ? -1 : ( nrOrderA < nrOrderB ? 1 : 0 ) );
+
+    }
+
+/*
+    Source - Tour opening
+ */
+
+    int nr_view_touropen( nr_Tour * const nrTour, char const * const nrPath, long const nrBudget ) {
+
+        /* Reset tour */
+        memset( nrTour, 0, sizeof( nr_Tour ) );
+
+        /* Initialize tour synchronization */
+        pthread_mutex_init( & nrTour->trMutex, NULL );
+        pthread_cond_init ( & nrTour->trCond , NULL );
+
+        /* Assign memory budget */
+        nrTour->trBudget = ( size_t ) nrBudget << 20;
+
+        /* Read tour panoramas paths */
+        if ( nr_view_list( nrPath, & nrTour->trPath, & nrTour->trCount ) == LC_FALSE ) return( LC_FALSE );
+
+        /* Check tour entries */
+        if ( nrTour->trCount == 0 ) return( LC_FALSE );
+
+        /* Allocate panoramas images and states */
+        nrTour->trImage = ( IplImage ** ) calloc( nrTour->trCount, sizeof( IplImage * ) );
+        nrTour->trState = ( int       * ) calloc( nrTour->trCount, sizeof( int ) );
+
+        /* Verify allocations */
+        if ( ( nrTour->trImage == NULL ) || ( nrTour->trState == NULL ) ) return( LC_FALSE );
+
+        /* Import first panorama */
+        if ( ( nrTour->trImage[0] = lc_imread( nrTour->trPath[0], CV_LOAD_IMAGE_COLOR ) ) == NULL ) return( LC_FALSE );
+
+        /* Update first panorama state */
+        nrTour->trState[0] = NR_TOUR_READY;
+
+        /* Update tour memory */
+        nrTour->trMemory = nrTour->trImage[0]->imageSize;
+
+        /* Create preloading thread */
+        nrTour->trActive = ( pthread_create( & nrTour->trLoader, NULL, & nr_view_tourload, nrTour ) == 0 );
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Tour closing
+ */
+
+    void nr_view_tourclose( nr_Tour * const nrTour ) {
+
+        /* Parsing variables */
+        long nrParse = 0;
+
+        /* Request preloading thread termination */
+        pthread_mutex_lock( & nrTour->trMutex );
+        nrTour->trQuit = 1;
+        pthread_cond_broadcast( & nrTour->trCond );
+        pthread_mutex_unlock( & nrTour->trMutex );
+
+        /* Wait preloading thread */
+        if ( nrTour->trActive != 0 ) pthread_join( nrTour->trLoader, NULL );
+
+        /* Release panoramas */
+        for ( nrParse = 0; nrParse < nrTour->trCount; nrParse ++ ) {
+
+            /* Release panorama image */
+            if ( ( nrTour->trImage != NULL ) && ( nrTour->trImage[nrParse] != NULL ) ) lc_imrelease( & nrTour->trImage[nrParse] );
+
+            /* Release panorama path */
+            free( nrTour->trPath[nrParse] );
+
+        }
+
+        /* Release tour arrays */
+        free( nrTour->trImage );
+        free( nrTour->trState );
+        free( nrTour->trPath  );
+
+        /* Release tour synchronization */
+        pthread_cond_destroy ( & nrTour->trCond  );
+        pthread_mutex_destroy( & nrTour->trMutex );
+
+    }
+
+/*
+    Source - Tour preloading thread
+ */
+
+    void * nr_view_tourload( void * nrData ) {
+
+        /* Tour variables */
+        nr_Tour * nrTour = ( nr_Tour * ) nrData;
+
+        /* Neighbours variables */
+        long nrNext = 0;
+        long nrPrev = 0;
+
+        /* Preloading target variables */
+        long nrTarget = 0;
+
+        /* Size estimation variables */
+        size_t nrSize = 0;
+
+        /* Panorama image variables */
+        IplImage * nrImage = NULL;
+
+        /* Parsing variables */
+        long nrParse = 0;
+
+        /* Lock tour */
+        pthread_mutex_lock( & nrTour->trMutex );
+
+        /* Preloading loop */
+        while ( nrTour->trQuit == 0 ) {
+
+            /* Compute current neighbours */
+            nrNext = ( nrTour->trIndex + 1 ) % nrTour->trCount;
+            nrPrev = ( nrTour->trIndex + nrTour->trCount - 1 ) % nrTour->trCount;
+
+            /* Release panoramas away from current */
+            for ( nrParse = 0; nrParse < nrTour->trCount; nrParse ++ ) {
+
+                /* Check panorama position */
+                if ( ( nrParse == nrTour->trIndex ) || ( nrParse == nrNext ) || ( nrParse == nrPrev ) || ( nrTour->trState[nrParse] != NR_TOUR_READY ) ) continue;
+
+                /* Update tour memory */
+                nrTour->trMemory -= nrTour->trImage[nrParse]->imageSize;
+
+                /* Release panorama image */
+                lc_imrelease( & nrTour->trImage[nrParse] );
+
+                /* Update panorama state */
+                nrTour->trState[nrParse] = NR_TOUR_NONE;
+
+            }
+
+            /* Estimate neighbour size from current panorama */
+            nrSize = ( nrTour->trImage[nrTour->trIndex] != NULL ) ? nrTour->trImage[nrTour->trIndex]->imageSize : 0;
+
+            /* Select neighbour to preload - next first */
+            if ( ( nrTour->trState[nrNext] == NR_TOUR_NONE ) && ( nrTour->trMemory + nrSize <= nrTour->trBudget ) ) {
+
+                /* Assign preloading target */
+                nrTarget = nrNext;
+
+            } else
+            if ( ( nrTour->trState[nrPrev] == NR_TOUR_NONE ) && ( nrTour->trMemory + nrSize <= nrTour->trBudget ) ) {
+
+                /* Assign preloading target */
+                nrTarget = nrPrev;
+
+            } else {
+
+                /* Wait for tour change */
+                pthread_cond_wait( & nrTour->trCond, & nrTour->trMutex );
+
+                /* Check conditions again */
+                continue;
+
+            }
+
+            /* Update panorama state */
+            nrTour->trState[nrTarget] = NR_TOUR_LOADING;
+
+            /* Unlock tour */
+            pthread_mutex_unlock( & nrTour->trMutex );
+
+            /* Import panorama */
+            nrImage = lc_imread( nrTour->trPath[nrTarget], CV_LOAD_IMAGE_COLOR );
+
+            /* Lock tour */
+            pthread_mutex_lock( & nrTour->trMutex );
+
+            /* Check panorama image */
+            if ( ( nrTour->trImage[nrTarget] = nrImage ) != NULL ) {
+
+                /* Update panorama state */
+                nrTour->trState[nrTarget] = NR_TOUR_READY;
+
+                /* Update tour memory */
+                nrTour->trMemory += nrImage->imageSize;
+
+            } else {
+
+                /* Update panorama state */
+                nrTour->trState[nrTarget] = NR_TOUR_FAILED;
+
+            }
+
+            /* Wake switch waiting */
+            pthread_cond_broadcast( & nrTour->trCond );
+
+        }
+
+        /* Unlock tour */
+        pthread_mutex_unlock( & nrTour->trMutex );
+
+        /* Return thread result */
+        return( NULL );
+
+    }
+
+/*
+    Source - Tour switch
+ */
+
+    IplImage * nr_view_tourswitch( nr_Tour * const nrTour, long const nrOffset ) {
+
+        /* Panorama image variables */
+        IplImage * nrImage = NULL;
+        IplImage * nrLoad  = NULL;
+
+        /* Index variables */
+        long nrIndex = 0;
+        long nrStep  = nrOffset > 0 ? 1 : -1;
+
+        /* Parsing variables */
+        long nrParse = 0;
+
+        /* Lock tour */
+        pthread_mutex_lock( & nrTour->trMutex );
+
+        /* Compute target panorama index */
+        nrIndex = ( ( nrTour->trIndex + nrOffset ) % nrTour->trCount + nrTour->trCount ) % nrTour->trCount;
+
+        /* Search available panorama - undecodable ones skipped */
+        for ( nrParse = 0; ( nrParse < nrTour->trCount ) && ( nrImage == NULL ); nrParse ++ ) {
+
+            /* Wait panorama preloading */
+            while ( nrTour->trState[nrIndex] == NR_TOUR_LOADING ) pthread_cond_wait( & nrTour->trCond, & nrTour->trMutex );
+
+            /* Check panorama state */
+            if ( nrTour->trState[nrIndex] == NR_TOUR_NONE ) {
+
+                /* Update panorama state */
+                nrTour->trState[nrIndex] = NR_TOUR_LOADING;
+
+                /* Unlock tour */
+                pthread_mutex_unlock( & nrTour->trMutex );
+
+                /* Import panorama */
+                nrLoad = lc_imread( nrTour->trPath[nrIndex], CV_LOAD_IMAGE_COLOR );
+
+                /* Lock tour */
+                pthread_mutex_lock( & nrTour->trMutex );
+
+                /* Assign panorama image */
+                nrTour->trImage[nrIndex] = nrLoad;
+
+                /* Update panorama state */
+                nrTour->trState[nrIndex] = ( nrLoad != NULL ) ? NR_TOUR_READY : NR_TOUR_FAILED;
+
+                /* Update tour memory */
+                if ( nrLoad != NULL ) nrTour->trMemory += nrLoad->imageSize;
+
+            }
+
+            /* Check panorama availability */
+            if ( nrTour->trState[nrIndex] == NR_TOUR_READY ) {
+
+                /* Assign current panorama */
+                nrImage = nrTour->trImage[nrTour->trIndex = nrIndex];
+
+            } else {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : Unable to read panorama %s\n", nrTour->trPath[nrIndex] );
+
+                /* Move to following panorama */
+                nrIndex = ( nrIndex + nrStep + nrTour->trCount ) % nrTour->trCount;
+
+            }
+
+        }
+
+        /* Wake preloading thread */
+        pthread_cond_broadcast( & nrTour->trCond );
+
+        /* Unlock tour */
+        pthread_mutex_unlock( & nrTour->trMutex );
+
+        /* Return current panorama */
+        return( nrImage );
+
+    }
+
+/*
+    Source - Sequence opening
+ */
+
+    int nr_view_sopen( 
+
+        nr_Sequence       * const nrSequence, 
+        char        const * const nrPath, 
+        double              const nrRate, 
+        int                 const nrAhead, 
+        int                 const nrLoaders, 
+        nr_View           * const nrView 
+
+    ) {
+
+        /* Path status variables */
+        struct stat nrStat;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Reset sequence */
+        memset( nrSequence, 0, sizeof( nr_Sequence ) );
+
+        /* Initialize sequence synchronization */
+        pthread_mutex_init( & nrSequence->sqMutex, NULL );
+        pthread_cond_init ( & nrSequence->sqCond , NULL );
+
+        /* Assign viewer state */
+        nrSequence->sqView = nrView;
+
+        /* Read sequence path status */
+        if ( stat( nrPath, & nrStat ) != 0 ) return( LC_FALSE );
+
+        /* Check video - lists and directories are not decoded as videos */
+        if ( ( ! S_ISDIR( nrStat.st_mode ) ) && ( ( nrSequence->sqCapture = cvCaptureFromFile( nrPath ) ) != NULL ) ) {
+
+            /* Unknown frames count until video end */
+            nrSequence->sqCount = LONG_MAX;
+
+            /* Assign playback rate - video rate by default */
+            if ( ( nrSequence->sqRate = nrRate ) <= 0.0 ) nrSequence->sqRate = cvGetCaptureProperty( nrSequence->sqCapture, CV_CAP_PROP_FPS );
+
+            /* Video decoded sequentially */
+            nrSequence->sqLoaders = 1;
+
+        } else {
+
+            /* Read frames paths */
+            if ( nr_view_list( nrPath, & nrSequence->sqPath, & nrSequence->sqCount ) == LC_FALSE ) return( LC_FALSE );
+
+            /* Assign playback rate */
+            nrSequence->sqRate = nrRate;
+
+            /* Assign loading threads count */
+            nrSequence->sqLoaders = nrLoaders > 0 ? nrLoaders : 1;
+
+        }
+
+        /* Check playback rate */
+        if ( ( nrSequence->sqRate <= 0.0 ) || ( ! isfinite( nrSequence->sqRate ) ) ) nrSequence->sqRate = NR_DFT_RATE;
+
+        /* Assign read-ahead slots count - displayed frame included */
+        nrSequence->sqAhead = ( nrAhead > 0 ? nrAhead : 1 ) + 1;
+
+        /* Allocate read-ahead slots and loading threads handles */
+        nrSequence->sqSlot   = ( IplImage ** ) calloc( nrSequence->sqAhead, sizeof( IplImage * ) );
+        nrSequence->sqFrame  = ( long       * ) malloc( nrSequence->sqAhead * sizeof( long ) );
+        nrSequence->sqLoader = ( pthread_t  * ) malloc( nrSequence->sqLoaders * sizeof( pthread_t ) );
+
+        /* Verify allocations */
+        if ( ( nrSequence->sqSlot == NULL ) || ( nrSequence->sqFrame == NULL ) || ( nrSequence->sqLoader == NULL ) ) return( LC_FALSE );
+
+        /* Unassign read-ahead slots */
+        for ( nrParse = 0; nrParse < nrSequence->sqAhead; nrParse ++ ) nrSequence->sqFrame[nrParse] = -1;
+
+        /* Check video */
+        if ( nrSequence->sqCapture != NULL ) {
+
+            /* Decode first frame - capture frame copied */
+            if ( ( nrSequence->sqSlot[0] = cvQueryFrame( nrSequence->sqCapture ) ) != NULL ) nrSequence->sqSlot[0] = cvCloneImage( nrSequence->sqSlot[0] );
+
+        } else {
+
+            /* Decode first frame */
+            nrSequence->sqSlot[0] = lc_imread( nrSequence->sqPath[0], CV_LOAD_IMAGE_COLOR );
+
+        }
+
+        /* Verify first frame */
+        if ( nrSequence->sqSlot[0] == NULL ) return( LC_FALSE );
+
+        /* Assign first frame */
+        nrSequence->sqFrame[0] = 0;
+
+        /* Update decoding position */
+        nrSequence->sqNext = 1;
+
+        /* Start playback clock */
+        nrSequence->sqStart = nr_view_time();
+
+        /* Create loading threads */
+        for ( nrParse = 0; nrParse < nrSequence->sqLoaders; nrParse ++ ) {
+
+            /* Create loading thread */
+            if ( pthread_create( nrSequence->sqLoader + nrParse, NULL, & nr_view_sloader, nrSequence ) != 0 ) break;
+
+        }
+
+        /* Update loading threads count */
+        nrSequence->sqLoaders = nrParse;
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Sequence closing
+ */
+
+    void nr_view_sclose( nr_Sequence * const nrSequence ) {
+
+        /* Parsing variables */
+        long nrParse = 0;
+
+        /* Request loading threads termination */
+        pthread_mutex_lock( & nrSequence->sqMutex );
+        nrSequence->sqQuit = 1;
+        pthread_cond_broadcast( & nrSequence->sqCond );
+        pthread_mutex_unlock( & nrSequence->sqMutex );
+
+        /* Wait loading threads */
+        for ( nrParse = 0; nrParse < nrSequence->sqLoaders; nrParse ++ ) pthread_join( nrSequence->sqLoader[nrParse], NULL );
+
+        /* Release read-ahead slots images */
+        for ( nrParse = 0; ( nrSequence->sqSlot != NULL ) && ( nrParse < nrSequence->sqAhead ); nrParse ++ ) {
+
+            /* Release slot image */
+            if ( nrSequence->sqSlot[nrParse] != NULL ) lc_imrelease( & nrSequence->sqSlot[nrParse] );
+
+        }
+
+        /* Release frames paths */
+        for ( nrParse = 0; ( nrSequence->sqPath != NULL ) && ( nrParse < nrSequence->sqCount ); nrParse ++ ) free( nrSequence->sqPath[nrParse] );
+
+        /* Release video capture */
+        if ( nrSequence->sqCapture != NULL ) cvReleaseCapture( & nrSequence->sqCapture );
+
+        /* Release sequence arrays */
+        free( nrSequence->sqPath   );
+        free( nrSequence->sqSlot   );
+        free( nrSequence->sqFrame  );
+        free( nrSequence->sqLoader );
+
+        /* Release sequence synchronization */
+        pthread_cond_destroy ( & nrSequence->sqCond  );
+        pthread_mutex_destroy( & nrSequence->sqMutex );
+
+    }
+
+/*
+    Source - Sequence loading thread
+ */
+
+    void * nr_view_sloader( void * nrData ) {
+
+        /* Sequence variables */
+        nr_Sequence * nrSequence = ( nr_Sequence * ) nrData;
+
+        /* Frame variables */
+        long nrFrame = 0;
+        long nrLate  = 0;
+
+        /* Slot variables */
+        int nrSlot = 0;
+
+        /* Video end variables */
+        int nrEnd = 0;
+
+        /* Frame image variables */
+        IplImage * nrImage = NULL;
+        IplImage * nrDrop  = NULL;
+
+        /* Lock sequence */
+        pthread_mutex_lock( & nrSequence->sqMutex );
+
+        /* Loading loop */
+        while ( nrSequence->sqQuit == 0 ) {
+
+            /* Compute frame currently due - following frame while paused */
+            nrLate = ( nrSequence->sqPause > 0.0 ) ? nrSequence->sqShow + 1 : ( long ) ( ( nr_view_time() - nrSequence->sqStart ) * nrSequence->sqRate );
+
+            /* Skip frames already late - video frames still grabbed, drops counted on display */
+            if ( ( nrSequence->sqCapture == NULL ) && ( nrSequence->sqNext < nrLate ) && ( nrLate < nrSequence->sqCount ) ) {
+
+                /* Update decoding position */
+                nrSequence->sqNext = nrLate;
+
+            }
+
+            /* Wait for sequence end, read-ahead limit or displayed frame slot */
+            if ( ( nrSequence->sqNext >= nrSequence->sqCount ) || ( nrSequence->sqNext >= ( nrLate > nrSequence->sqShow ? nrLate : nrSequence->sqShow ) + nrSequence->sqAhead ) || ( nrSequence->sqFrame[nrSequence->sqNext % nrSequence->sqAhead] == nrSequence->sqShow ) ) {
+
+                /* Wait for sequence change */
+                pthread_cond_wait( & nrSequence->sqCond, & nrSequence->sqMutex );
+
+                /* Check conditions again */
+                continue;
+
+            }
+
+            /* Take next frame */
+            nrFrame = nrSequence->sqNext ++;
+
+            /* Compute frame slot */
+            nrSlot = nrFrame % nrSequence->sqAhead;
+
+            /* Detach previous slot image - frame already passed */
+            nrDrop = nrSequence->sqSlot[nrSlot];
+
+            /* Assign slot */
+            nrSequence->sqSlot [nrSlot] = NULL;
+            nrSequence->sqFrame[nrSlot] = nrFrame;
+
+            /* Unlock sequence */
+            pthread_mutex_unlock( & nrSequence->sqMutex );
+
+            /* Release previous slot image */
+            if ( nrDrop != NULL ) lc_imrelease( & nrDrop );
+
+            /* Reset frame image */
+            nrImage = NULL;
+
+            /* Check video */
+            if ( nrSequence->sqCapture != NULL ) {
+
+                /* Check late frame */
+                if ( nrFrame < nrLate ) {
+
+                    /* Grab frame without decoding */
+                    nrEnd = ( cvGrabFrame( nrSequence->sqCapture ) == 0 );
+
+                } else {
+
+                    /* Decode frame - capture frame copied */
+                    if ( ( nrImage = cvQueryFrame( nrSequence->sqCapture ) ) != NULL ) nrImage = cvCloneImage( nrImage );
+
+                    /* Check video end */
+                    nrEnd = ( nrImage == NULL );
+
+                }
+
+            } else {
+
+                /* Decode frame */
+                nrImage = lc_imread( nrSequence->sqPath[nrFrame], CV_LOAD_IMAGE_COLOR );
+
+            }
+
+            /* Lock sequence */
+            pthread_mutex_lock( & nrSequence->sqMutex );
+
+            /* Check video end */
+            if ( nrEnd != 0 ) {
+
+                /* Update frames count */
+                nrSequence->sqCount = nrFrame;
+
+            } else
+            if ( ( nrImage != NULL ) && ( nrSequence->sqFrame[nrSlot] == nrFrame ) ) {
+
+                /* Assign slot image */
+                nrSequence->sqSlot[nrSlot] = nrImage;
+
+            } else {
+
+                /* Release frame - slot reassigned after the frame was passed */
+                if ( nrImage != NULL ) lc_imrelease( & nrImage );
+
+            }
+
+            /* Unlock sequence */
+            pthread_mutex_unlock( & nrSequence->sqMutex );
+
+            /* Notify viewer */
+            pthread_mutex_lock( & nrSequence->sqView->vwMutex );
+            pthread_cond_signal( & nrSequence->sqView->vwCond );
+            pthread_mutex_unlock( & nrSequence->sqView->vwMutex );
+
+            /* Lock sequence */
+            pthread_mutex_lock( & nrSequence->sqMutex );
+
+        }
+
+        /* Unlock sequence */
+        pthread_mutex_unlock( & nrSequence->sqMutex );
+
+        /* Return thread result */
+        return( NULL );
+
+    }
+
+/*
+    Source - Sequence frame
+ */
+
+    IplImage * nr_view_sframe( nr_Sequence * const nrSequence ) {
+
+        /* Frame image variables */
+        IplImage * nrImage = NULL;
+
+        /* Frame variables */
+        long nrFrame = 0;
+        long nrDue   = 0;
+        long nrShow  = 0;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Lock sequence */
+        pthread_mutex_lock( & nrSequence->sqMutex );
+
+        /* Compute frame currently due - playback clock stopped while paused */
+        nrDue = ( long ) ( ( ( nrSequence->sqPause > 0.0 ? nrSequence->sqPause : nr_view_time() ) - nrSequence->sqStart ) * nrSequence->sqRate + 1e-6 );
+
+        /* Initialize displayed frame */
+        nrShow = nrSequence->sqShow;
+
+        /* Search latest decoded frame due */
+        for ( nrParse = 0; nrParse < nrSequence->sqAhead; nrParse ++ ) {
+
+            /* Retrieve slot frame */
+            nrFrame = nrSequence->sqFrame[nrParse];
+
+            /* Check slot frame */
+            if ( ( nrSequence->sqSlot[nrParse] != NULL ) && ( nrFrame > nrShow ) && ( nrFrame <= nrDue ) ) {
+
+                /* Assign frame */
+                nrImage = nrSequence->sqSlot[nrParse];
+
+                /* Update frame */
+                nrShow = nrFrame;
+
+            }
+
+        }
+
+        /* Check frame change */
+        if ( nrImage != NULL ) {
+
+            /* Update dropped frames count - frames skipped between displayed ones */
+            nrSequence->sqDrop += nrShow - nrSequence->sqShow - 1;
+
+            /* Update displayed frame */
+            nrSequence->sqShow = nrShow;
+
+            /* Wake loading threads - read-ahead slots freed */
+            pthread_cond_broadcast( & nrSequence->sqCond );
+
+        }
+
+        /* Unlock sequence */
+        pthread_mutex_unlock( & nrSequence->sqMutex );
+
+        /* Return displayed frame */
+        return( nrImage );
+
+    }
+
+/*
+    Source - Sequence due time
+ */
+
+    double nr_view_sdue( nr_Sequence * const nrSequence ) {
+
+        /* Due time variables */
+        double nrDue = HUGE_VAL;
+
+        /* Parsing variables */
+        int nrParse = 0;
+
+        /* Lock sequence */
+        pthread_mutex_lock( & nrSequence->sqMutex );
+
+        /* Check playback */
+        if ( nrSequence->sqPause == 0.0 ) {
+
+            /* Search earliest decoded frame following the displayed one */
+            for ( nrParse = 0; nrParse < nrSequence->sqAhead; nrParse ++ ) {
+
+                /* Check slot frame */
+                if ( ( nrSequence->sqSlot[nrParse] != NULL ) && ( nrSequence->sqFrame[nrParse] > nrSequence->sqShow ) ) {
+
+                    /* Update due time */
+                    nrDue = fmin( nrDue, nrSequence->sqStart + nrSequence->sqFrame[nrParse] / nrSequence->sqRate );
+
+                }
+
+            }
+
+        }
+
+        /* Unlock sequence */
+        pthread_mutex_unlock( & nrSequence->sqMutex );
+
+        /* Return due time */
+        return( nrDue );
+
+    }
+
+/*
+    Source - Sequence pause
+ */
+
+    void nr_view_spause( nr_Sequence * const nrSequence ) {
+
+        /* Lock sequence */
+        pthread_mutex_lock( & nrSequence->sqMutex );
+
+        /* Check playback state */
+        if ( nrSequence->sqPause > 0.0 ) {
+
+            /* Shift playback clock by pause duration */
+            nrSequence->sqStart += nr_view_time() - nrSequence->sqPause;
+
+            /* Resume playback */
+            nrSequence->sqPause = 0.0;
+
+        } else {
+
+            /* Stop playback clock */
+            nrSequence->sqPause = nr_view_time();
+
+        }
+
+        /* Wake loading threads */
+        pthread_cond_broadcast( & nrSequence->sqCond );
+
+        /* Unlock sequence */
+        pthread_mutex_unlock( & nrSequence->sqMutex );
+
+    }
+
+/*
+    Source - Images list reading
+ */
+
+    int nr_view_list( char const * const nrPath, char *** const nrList, long * const nrCount ) {
+
+        /* Path status variables */
+        struct stat nrStat;
+
+        /* Directory variables */
+        DIR * nrDirectory = NULL;
+
+        /* Entry variables */
+        struct dirent * nrEntry = NULL;
+
+        /* Extension variables */
+        char * nrExt = NULL;
+
+        /* List stream variables */
+        FILE * nrStream = NULL;
+
+        /* Line variables */
+        char nrLine[PATH_MAX];
+
+        /* Paths capacity variables */
+        long nrSize = 0;
+
+        /* Read path status */
+        if ( stat( nrPath, & nrStat ) != 0 ) return( LC_FALSE );
+
+        /* Check directory */
+        if ( S_ISDIR( nrStat.st_mode ) ) {
+
+            /* Open directory */
+            if ( ( nrDirectory = opendir( nrPath ) ) == NULL ) return( LC_FALSE );
+
+            /* Enumerate directory entries */
+            while ( ( nrEntry = readdir( nrDirectory ) ) != NULL ) {
+
+                /* Retrieve entry extension */
+                if ( ( nrEntry->d_name[0] == '.' ) || ( ( nrExt = strrchr( nrEntry->d_name, '.' ) ) == NULL ) ) continue;
+
+                /* Filter images entries */
+                if ( strcasecmp( nrExt, ".jpg" ) && strcasecmp( nrExt, ".jpeg" ) && strcasecmp( nrExt, ".png" ) && strcasecmp( nrExt, ".tif" ) && strcasecmp( nrExt, ".tiff" ) && strcasecmp( nrExt, ".bmp" ) ) continue;
+
+                /* Compose entry path */
+                snprintf( nrLine, PATH_MAX, "%s/%s", nrPath, nrEntry->d_name );
+
+                /* Append entry */
+                if ( nr_view_ladd( nrList, nrCount, & nrSize, nrLine ) == LC_FALSE ) break;
+
+            }
+
+            /* Close directory */
+            closedir( nrDirectory );
+
+            /* Sort entries by name */
+            if ( * nrCount > 0 ) qsort( * nrList, * nrCount, sizeof( char * ), & nr_view_lorder );
+
+        } else {
+
+            /* Open list */
+            if ( ( nrStream = fopen( nrPath, "r" ) ) == NULL ) return( LC_FALSE );
+
+            /* Read list lines */
+            while ( fgets( nrLine, PATH_MAX, nrStream ) != NULL ) {
+
+                /* Remove line termination */
+                nrLine[strcspn( nrLine, "\r\n" )] = '\0';
+
+                /* Skip empty and comment lines */
+                if ( ( nrLine[0] == '\0' ) || ( nrLine[0] == '#' ) ) continue;
+
+                /* Append entry */
+                if ( nr_view_ladd( nrList, nrCount, & nrSize, nrLine ) == LC_FALSE ) break;
+
+            }
+
+            /* Close list */
+            fclose( nrStream );
+
+        }
+
+        /* Send message */
+        return( * nrCount > 0 ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Images list entry
+ */
+
+    int nr_view_ladd( char *** const nrList, long * const nrCount, long * const nrSize, char const * const nrPath ) {
+
+        /* Reallocation variables */
+        char ** nrRealloc = NULL;
+
+        /* Check paths capacity */
+        if ( * nrCount == * nrSize ) {
+
+            /* Reallocate paths */
+            if ( ( nrRealloc = ( char ** ) realloc( * nrList, ( * nrSize ? * nrSize * 2 : 64 ) * sizeof( char * ) ) ) == NULL ) return( LC_FALSE );
+
+            /* Update paths capacity */
+            * nrSize = * nrSize ? * nrSize * 2 : 64;
+
+            /* Assign paths */
+            * nrList = nrRealloc;
+
+        }
+
+        /* Append path copy */
+        if ( ( ( * nrList )[* nrCount] = strdup( nrPath ) ) == NULL ) return( LC_FALSE );
+
+        /* Update paths count */
+        ( * nrCount ) ++;
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Images list ordering
+ */
+
+    int nr_view_lorder( void const * nrA, void const * nrB ) {
+
+        /* Compare paths */
+        return( strcmp( * ( char * const * ) nrA, * ( char * const * ) nrB ) );
+
+    }
+
+/*
+    Source - Benchmark replay
+ */
+
+    int nr_view_bench( nr_View * const nrView, char const * const nrPath ) {
+
+        /* Path stream variables */
+        FILE * nrStream = NULL;
+
+        /* Line variables */
+        char nrLine[1024];
+
+        /* Path variables */
+        double * nrPathway = NULL;
+        double * nrRealloc = NULL;
+        long     nrCount   = 0;
+        long     nrSize    = 0;
+
+        /* Frame times variables */
+        double * nrFrame = NULL;
+        double   nrTotal = 0.0;
+
+        /* Timing variables */
+        double nrTime = 0.0;
+        double nrWall = 0.0;
+        double nrCPU  = 0.0;
+
+        /* Process time variables */
+        struct timespec nrClock;
+
+        /* Threads times variables */
+        long   nrTaskA[NR_MAX_TASKS];
+        long   nrTaskB[NR_MAX_TASKS];
+        double nrTimeA[NR_MAX_TASKS];
+        double nrTimeB[NR_MAX_TASKS];
+        int    nrCountA = 0;
+        int    nrCountB = 0;
+        double nrUsed   = 0.0;
+
+        /* View variables */
+        nr_Mouse nrMouse = nrView->vwMouse;
+
+        /* Display buffer variables */
+        IplImage * nrBuffer = nrView->vwBuffer[0];
+
+        /* Parsing variables */
+        long nrParse = 0;
+        int  nrIndex = 0;
+
+        /* Open path file */
+        if ( ( nrStream = fopen( nrPath, "r" ) ) == NULL ) return( LC_FALSE );
+
+        /* Read path views */
+        while ( fgets( nrLine, sizeof( nrLine ), nrStream ) != NULL ) {
+
+            /* Skip comment lines */
+            if ( nrLine[0] == '#' ) continue;
+
+            /* Check path capacity */
+            if ( nrCount == nrSize ) {
+
+                /* Update path capacity */
+                nrSize = nrSize ? nrSize * 2 : 256;
+
+                /* Reallocate path */
+                if ( ( nrRealloc = ( double * ) realloc( nrPathway, nrSize * 4 * sizeof( double ) ) ) == NULL ) break;
+
+                /* Assign path */
+                nrPathway = nrRealloc;
+
+            }
+
+            /* Parse path view */
+            if ( sscanf( nrLine, "%lf %lf %lf %lf", nrPathway + nrCount * 4, nrPathway + nrCount * 4 + 1, nrPathway + nrCount * 4 + 2, nrPathway + nrCount * 4 + 3 ) == 4 ) nrCount ++;
+
+        }
+
+        /* Close path file */
+        fclose( nrStream );
+
+        /* Allocate frame times */
+        if ( ( nrCount == 0 ) || ( ( nrFrame = ( double * ) malloc( nrCount * sizeof( double ) ) ) == NULL ) ) {
+
+            /* Release path */
+            free( nrPathway );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Read threads times */
+        nrCountA = nr_view_btasks( nrTaskA, nrTimeA );
+
+        /* Read process time */
+        clock_gettime( CLOCK_PROCESS_CPUTIME_ID, & nrClock );
+
+        /* Memorize process time */
+        nrCPU = nrClock.tv_sec + nrClock.tv_nsec * 1e-9;
+
+        /* Memorize replay start */
+        nrWall = nr_view_time();
+
+        /* Replay path views */
+        for ( nrParse = 0; nrParse < nrCount; nrParse ++ ) {
+
+            /* Assign path view */
+            nrMouse.msAzim = nrPathway[nrParse * 4 + 1] * ( LG_PI / 180.0 );
+            nrMouse.msElev = nrPathway[nrParse * 4 + 2] * ( LG_PI / 180.0 );
+            nrMouse.msAppe = nrPathway[nrParse * 4 + 3] * ( LG_PI / 180.0 );
+
+            /* Memorize rendering start */
+            nrTime = nr_view_time();
+
+            /* Compute view in display buffer */
+            nr_view_render( nrView, ( inter_C8_t * ) nrBuffer->imageData, nrBuffer->width, nrBuffer->height, nrBuffer->nChannels, & nrMouse, li_bilinearf );
+
+            /* Compute frame time */
+            nrTotal += ( nrFrame[nrParse] = nr_view_time() - nrTime );
+
+        }
+
+        /* Compute replay duration */
+        nrWall = nr_view_time() - nrWall;
+
+        /* Read process time */
+        clock_gettime( CLOCK_PROCESS_CPUTIME_ID, & nrClock );
+
+        /* Compute process time */
+        nrCPU = nrClock.tv_sec + nrClock.tv_nsec * 1e-9 - nrCPU;
+
+        /* Read threads times */
+        nrCountB = nr_view_btasks( nrTaskB, nrTimeB );
+
+        /* Sort frame times */
+        qsort( nrFrame, nrCount, sizeof( double ), & nr_view_bsort );
+
+        /* Display benchmark report */
+        fprintf( LC_OUT, "norama-view benchmark : %li frames, %ix%ix%i, %i threads\n", nrCount, nrBuffer->width, nrBuffer->height, nrBuffer->nChannels, nrView->vwThread );
+        fprintf( LC_OUT, "    frame time (ms)  : mean %.2f p50 %.2f p90 %.2f p99 %.2f max %.2f\n", 
+
+            1e3 * nrTotal / nrCount, 
+            1e3 * nrFrame[( nrCount - 1 ) * 50 / 100], 
+            1e3 * nrFrame[( nrCount - 1 ) * 90 / 100], 
+            1e3 * nrFrame[( nrCount - 1 ) * 99 / 100], 
+            1e3 * nrFrame[nrCount - 1] 
+
+        );
+        fprintf( LC_OUT, "    throughput       : %.2f frames/s, %.2f Mpixels/s\n", nrCount / nrWall, 1e-6 * nrCount * nrBuffer->width * nrBuffer->height / nrWall );
+        fprintf( LC_OUT, "    path duration    : %.2f s, real-time factor %.2f\n", nrPathway[( nrCount - 1 ) * 4] - nrPathway[0], ( nrPathway[( nrCount - 1 ) * 4] - nrPathway[0] ) / nrWall );
+        fprintf( LC_OUT, "    cpu utilization  : %.1f %% of %i threads\n", 100.0 * nrCPU / ( nrWall * nrView->vwThread ), nrView->vwThread );
+
+        /* Display threads utilization */
+        for ( nrIndex = 0; nrIndex < nrCountB; nrIndex ++ ) {
+
+            /* Compute thread time - threads created during replay start from zero */
+            for ( nrParse = 0, nrUsed = nrTimeB[nrIndex]; nrParse < nrCountA; nrParse ++ ) if ( nrTaskA[nrParse] == nrTaskB[nrIndex] ) nrUsed -= nrTimeA[nrParse];
+
+            /* Display thread utilization */
+            if ( nrUsed > 0.0 ) fprintf( LC_OUT, "    thread %-9li : %.1f %%\n", nrTaskB[nrIndex], 100.0 * nrUsed / nrWall );
+
+        }
+
+        /* Release frame times */
+        free( nrFrame );
+
+        /* Release path */
+        free( nrPathway );
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Benchmark threads times
+ */
+
+    int nr_view_btasks( long * const nrTask, double * const nrTime ) {
+
+        /* Directory variables */
+        DIR * nrDirectory = NULL;
+
+        /* Entry variables */
+        struct dirent * nrEntry = NULL;
+
+        /* Stat stream variables */
+        FILE * nrStream = NULL;
+
+        /* Path variables */
+        char nrPath[PATH_MAX];
+
+        /* Line variables */
+        char   nrLine[1024];
+        char * nrField = NULL;
+
+        /* Times variables, in clock ticks */
+        unsigned long nrUser   = 0;
+        unsigned long nrSystem = 0;
+
+        /* Count variables */
+        int nrCount = 0;
+
+        /* Open process tasks directory */
+        if ( ( nrDirectory = opendir( "/proc/self/task" ) ) == NULL ) return( 0 );
+
+        /* Enumerate tasks */
+        while ( ( ( nrEntry = readdir( nrDirectory ) ) != NULL ) && ( nrCount < NR_MAX_TASKS ) ) {
+
+            /* Skip directory entries */
+            if ( nrEntry->d_name[0] == '.' ) continue;
+
+            /* Compose task stat path */
+            snprintf( nrPath, PATH_MAX, "/proc/self/task/%s/stat", nrEntry->d_name );
+
+            /* Open task stat */
+            if ( ( nrStream = fopen( nrPath, "r" ) ) == NULL ) continue;
+
+            /* Read task stat - fields following command name */
+            if ( ( fgets( nrLine, sizeof( nrLine ), nrStream ) != NULL ) && ( ( nrField = strrchr( nrLine, ')' ) ) != NULL ) ) {
+
+                /* Read user and system times */
+                if ( sscanf( nrField + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", & nrUser, & nrSystem ) == 2 ) {
+
+                    /* Assign task time */
+                    nrTask[nrCount  ] = atol( nrEntry->d_name );
+                    nrTime[nrCount ++] = ( double ) ( nrUser + nrSystem ) / sysconf( _SC_CLK_TCK );
+
+                }
+
+            }
+
+            /* Close task stat */
+            fclose( nrStream );
+
+        }
+
+        /* Close process tasks directory */
+        closedir( nrDirectory );
+
+        /* Return tasks count */
+        return( nrCount );
+
+    }
+
+/*
+    Source - Benchmark frame times ordering
+ */
+
+    int nr_view_bsort( void const * nrA, void const * nrB ) {
+
+        /* Compare frame times */
+        return( * ( double const * ) nrA > * ( double const * ) nrB ? 1 : ( * ( double const * ) nrA < * ( double const * ) nrB ? -1 : 0 ) );
+
+    }
+
+/*
+    Source - Monotonic time
+ */
+
+    double nr_view_time( void ) {
+
+        /* Time variables */
+        struct timespec nrTime;
+
+        /* Read monotonic clock */
+        clock_gettime( CLOCK_MONOTONIC, & nrTime );
+
+        /* Return time in seconds */
+        return( nrTime.tv_sec + nrTime.tv_nsec * 1e-9 );
+
     }
 
 /*
@@ -99,10 +99,28 @@
 
     # include <stdio.h>
     # include <stdlib.h>
+    # include <math.h>
+    # include <time.h>
+    # include <string.h>
+    # include <strings.h>
+    # include <errno.h>
+    # include <limits.h>
+    # include <sys/stat.h>
+    # include <unistd.h>
+    # include <fcntl.h>
+    # include <dirent.h>
+    # include <pthread.h>
+    # include <sys/ipc.h>
+    # include <sys/shm.h>
+    # include <sys/select.h>
     # include <X11/Xlib.h>
+    # include <X11/Xutil.h>
+    # include <X11/Xatom.h>
+    # include <X11/extensions/XShm.h>
     # include <opencv/cv.h>
     # include <opencv/highgui.h>
     # include <gnomonic-all.h>
+    # include <norama-all.h>
     # include <common-all.h>
 
 /* 
@@ -117,7 +135,18 @@
     "\t-s\tScale applied on display buffer\n"              \
     "\t-x\tScreen horizontal pixel count\n"                \
     "\t-y\tScreen vertical pixel count\n"                  \
-    "\t-t\tNumber of threads\n\n"                          \
+    "\t-t\tNumber of threads\n"                            \
+    "\t-c\tRender views through a cube map\n"              \
+    "\t-m\tPresent views through X11 shared memory\n"      \
+    "\t-d\tEquirectangular tiles pyramid directory\n"      \
+    "\t-e\tTiles pyramid images extension\n"               \
+    "\t-u\tTour panoramas list file or directory\n"        \
+    "\t-q\tSequence video, list file or directory\n"       \
+    "\t-r\tSequence playback rate, in frames per second\n" \
+    "\t-a\tSequence read-ahead frames count\n"             \
+    "\t-b\tTiles or tour memory budget, in MB\n"           \
+    "\t-l\tNumber of tiles or frames loading threads\n"    \
+    "\t-p\tBenchmark camera path, replayed headless\n\n"   \
     "norama-view - norama-suite\n"                         \
     "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
 
@@ -125,16 +154,65 @@
     # define NR_KEY_ESCAPE   27
     # define NR_KEY_F       102
     # define NR_KEY_R       114
+    # define NR_KEY_N       110
+    # define NR_KEY_P       112
+    # define NR_KEY_SPACE    32
 
     /* Define default values */
     # define NR_DFT_SCALE   1.0
     # define NR_DFT_THREAD    8
 
+    /* Define tiles default values */
+    # define NR_DFT_EXT     "jpg"
+    # define NR_DFT_BUDGET 1024
+    # define NR_DFT_LOADER    4
+
+    /* Define tiles pyramid constants */
+    # define NR_MAX_LEVEL    16
+    # define NR_EQUI_TAG    'e'
+    # define NR_TILE_BASE  4096
+
+    /* Define tiles states */
+    # define NR_TILE_NONE     0
+    # define NR_TILE_QUEUED   1
+    # define NR_TILE_LOADING  2
+    # define NR_TILE_READY    3
+    # define NR_TILE_FAILED   4
+
+    /* Define tiles frame usages */
+    # define NR_USE_NONE      0
+    # define NR_USE_MISS      1
+    # define NR_USE_HIT       2
+
+    /* Define tour panoramas states */
+    # define NR_TOUR_NONE     0
+    # define NR_TOUR_LOADING  1
+    # define NR_TOUR_READY    2
+    # define NR_TOUR_FAILED   3
+
+    /* Define sequence default values */
+    # define NR_DFT_RATE    25.0
+    # define NR_DFT_AHEAD     8
+
+    /* Define benchmark constants */
+    # define NR_MAX_TASKS  1024
+
+    /* Define highgui event waiting delays, in milliseconds */
+    # define NR_WAIT_BUSY     1
+    # define NR_WAIT_IDLE    20
+
+    /* Define adaptive resolution constants */
+    # define NR_FRAME_TIME  ( 1.0 / 30.0 )
+    # define NR_MIN_FACTOR  0.25
+
     /* Define mouse motion mode */
     # define NR_MS_NONE       0
     # define NR_MS_MOVE       1
     # define NR_MS_ZOOM       2  
 
+    /* Define libnorama frame azimuth offset - mapping center versus left edge */
+    # define NR_FRAME_AZIM  LG_PI
+
     /* Define FOV constants */
     # define NR_MIN_APPER   (  20.0 * ( LG_PI / 180.0 ) )
     # define NR_MAX_APPER   ( 120.0 * ( LG_PI / 180.0 ) )
@@ -166,6 +244,10 @@
      *  Display view gnomonic aperture, in radian
      *  \var nr_Mouse_struct::msWidth
      *  Mapping width broadcasting variable for motion weighting
+     *  \var nr_Mouse_struct::msDirty
+     *  Display view modification flag, cleared once the view is rendered
+     *  \var nr_Mouse_struct::msMotion
+     *  Display view motion flag, set while a mouse button drives the view
      */
 
     typedef struct nr_Mouse_struct {
@@ -174,9 +256,356 @@
         double msElev;
         double msAppe;
         double msWidth;
+        int    msDirty;
+        int    msMotion;
 
     } nr_Mouse;
 
+    /*! \struct nr_Tile_struct
+     *  \brief Pyramid tile structure
+     *
+     *  This structure describes a tile of the equirectangular tiles pyramid
+     *  produced by norama-tile. Loaded tiles are chained in the least recently
+     *  used list of the tiles cache.
+     *
+     *  \var nr_Tile_struct::tlImage
+     *  Tile image, NULL if not loaded
+     *  \var nr_Tile_struct::tlLevel
+     *  Tile pyramid level
+     *  \var nr_Tile_struct::tlRow
+     *  Tile row in level
+     *  \var nr_Tile_struct::tlCol
+     *  Tile column in level
+     *  \var nr_Tile_struct::tlState
+     *  Tile loading state
+     *  \var nr_Tile_struct::tlOrder
+     *  Tile loading priority, distance to the view center
+     *  \var nr_Tile_struct::tlPrev
+     *  Previous tile in least recently used list
+     *  \var nr_Tile_struct::tlNext
+     *  Next tile in least recently used list
+     */
+
+    typedef struct nr_Tile_struct {
+
+        IplImage *              tlImage;
+        int                     tlLevel;
+        int                     tlRow;
+        int                     tlCol;
+        int                     tlState;
+        long                    tlOrder;
+        struct nr_Tile_struct * tlPrev;
+        struct nr_Tile_struct * tlNext;
+
+    } nr_Tile;
+
+    /*! \struct nr_Tiles_struct
+     *  \brief Tiles cache structure
+     *
+     *  This structure holds the equirectangular tiles pyramid cache. A low
+     *  resolution level is assembled at opening and used where full resolution
+     *  tiles are missing. The full resolution tiles requested by the rendered
+     *  views are decoded by loading threads and kept in a least recently used
+     *  list bounded by the memory budget. Tiles are only released by the
+     *  render thread, between frames.
+     *
+     *  \var nr_Tiles_struct::tsPath
+     *  Pyramid directory path
+     *  \var nr_Tiles_struct::tsExt
+     *  Pyramid images extension
+     *  \var nr_Tiles_struct::tsTile
+     *  Tiles size, in pixels
+     *  \var nr_Tiles_struct::tsCount
+     *  Pyramid levels count
+     *  \var nr_Tiles_struct::tsBase
+     *  Low resolution level index
+     *  \var nr_Tiles_struct::tsLayers
+     *  Tiles layers count
+     *  \var nr_Tiles_struct::tsImage
+     *  Low resolution level image
+     *  \var nr_Tiles_struct::tsGrid
+     *  Levels tiles arrays
+     *  \var nr_Tiles_struct::tsFrame
+     *  Tiles images of the rendered level, captured at frame start
+     *  \var nr_Tiles_struct::tsUsage
+     *  Tiles usages of the rendered level during frame
+     *  \var nr_Tiles_struct::tsQueue
+     *  Tiles loading requests stack, most urgent on top
+     *  \var nr_Tiles_struct::tsPending
+     *  Tiles loading requests count
+     *  \var nr_Tiles_struct::tsHead
+     *  Most recently used loaded tile
+     *  \var nr_Tiles_struct::tsTail
+     *  Least recently used loaded tile
+     *  \var nr_Tiles_struct::tsMemory
+     *  Loaded tiles memory, in bytes
+     *  \var nr_Tiles_struct::tsBudget
+     *  Loaded tiles memory budget, in bytes
+     *  \var nr_Tiles_struct::tsQuit
+     *  Loading threads termination flag
+     *  \var nr_Tiles_struct::tsLoaders
+     *  Loading threads count
+     *  \var nr_Tiles_struct::tsLoader
+     *  Loading threads handles
+     *  \var nr_Tiles_struct::tsView
+     *  Viewer state notified on tiles loading
+     *  \var nr_Tiles_struct::tsMutex
+     *  Tiles cache mutex
+     *  \var nr_Tiles_struct::tsCond
+     *  Tiles requests condition
+     */
+
+    typedef struct nr_Tiles_struct {
+
+        char *                  tsPath;
+        char *                  tsExt;
+        int                     tsTile;
+        int                     tsCount;
+        int                     tsBase;
+        int                     tsLayers;
+        IplImage *              tsImage;
+        nr_Tile *               tsGrid[NR_MAX_LEVEL];
+        IplImage **             tsFrame;
+        unsigned char *         tsUsage;
+        nr_Tile **              tsQueue;
+        long                    tsPending;
+        nr_Tile *               tsHead;
+        nr_Tile *               tsTail;
+        size_t                  tsMemory;
+        size_t                  tsBudget;
+        int                     tsQuit;
+        int                     tsLoaders;
+        pthread_t *             tsLoader;
+        struct nr_View_struct * tsView;
+        pthread_mutex_t         tsMutex;
+        pthread_cond_t          tsCond;
+
+    } nr_Tiles;
+
+    /*! \struct nr_Tour_struct
+     *  \brief Tour structure
+     *
+     *  This structure holds the panoramas of a tour. The current panorama and
+     *  its next and previous neighbours are kept decoded, the neighbours being
+     *  preloaded by a background thread as long as the memory budget allows
+     *  it. The other panoramas are released.
+     *
+     *  \var nr_Tour_struct::trPath
+     *  Panoramas paths
+     *  \var nr_Tour_struct::trImage
+     *  Panoramas images, NULL if not decoded
+     *  \var nr_Tour_struct::trState
+     *  Panoramas loading states
+     *  \var nr_Tour_struct::trCount
+     *  Panoramas count
+     *  \var nr_Tour_struct::trIndex
+     *  Current panorama index
+     *  \var nr_Tour_struct::trMemory
+     *  Decoded panoramas memory, in bytes
+     *  \var nr_Tour_struct::trBudget
+     *  Decoded panoramas memory budget, in bytes
+     *  \var nr_Tour_struct::trQuit
+     *  Preloading thread termination flag
+     *  \var nr_Tour_struct::trActive
+     *  Preloading thread creation flag
+     *  \var nr_Tour_struct::trLoader
+     *  Preloading thread handle
+     *  \var nr_Tour_struct::trMutex
+     *  Tour mutex
+     *  \var nr_Tour_struct::trCond
+     *  Tour state change condition
+     */
+
+    typedef struct nr_Tour_struct {
+
+        char **         trPath;
+        IplImage **     trImage;
+        int *           trState;
+        long            trCount;
+        long            trIndex;
+        size_t          trMemory;
+        size_t          trBudget;
+        int             trQuit;
+        int             trActive;
+        pthread_t       trLoader;
+        pthread_mutex_t trMutex;
+        pthread_cond_t  trCond;
+
+    } nr_Tour;
+
+    /*! \struct nr_Sequence_struct
+     *  \brief Sequence structure
+     *
+     *  This structure holds the playback state of a panoramic sequence, read
+     *  from a video or from a list of frames images. Loading threads decode the
+     *  frames following the displayed one in a ring of read-ahead slots. The
+     *  frames whose display time is already elapsed are not decoded, or not
+     *  displayed, so that the playback keeps the target rate when decoding or
+     *  rendering falls behind. A video is decoded by a single loading thread,
+     *  late frames being only grabbed.
+     *
+     *  \var nr_Sequence_struct::sqPath
+     *  Frames paths, NULL for a video
+     *  \var nr_Sequence_struct::sqCapture
+     *  Video capture, NULL for frames images
+     *  \var nr_Sequence_struct::sqCount
+     *  Frames count, LONG_MAX while the end of a video is not reached
+     *  \var nr_Sequence_struct::sqRate
+     *  Playback rate, in frames per second
+     *  \var nr_Sequence_struct::sqSlot
+     *  Read-ahead slots images, NULL if not decoded
+     *  \var nr_Sequence_struct::sqFrame
+     *  Read-ahead slots frames indexes, negative if unassigned
+     *  \var nr_Sequence_struct::sqAhead
+     *  Read-ahead slots count
+     *  \var nr_Sequence_struct::sqShow
+     *  Displayed frame index
+     *  \var nr_Sequence_struct::sqNext
+     *  Next frame index to decode
+     *  \var nr_Sequence_struct::sqDrop
+     *  Dropped frames count, accumulated from displayed frames indexes gaps
+     *  \var nr_Sequence_struct::sqStart
+     *  Playback clock origin, in seconds
+     *  \var nr_Sequence_struct::sqPause
+     *  Playback pause time, zero while playing
+     *  \var nr_Sequence_struct::sqQuit
+     *  Loading threads termination flag
+     *  \var nr_Sequence_struct::sqLoaders
+     *  Loading threads count
+     *  \var nr_Sequence_struct::sqLoader
+     *  Loading threads handles
+     *  \var nr_Sequence_struct::sqView
+     *  Viewer state notified on frames decoding
+     *  \var nr_Sequence_struct::sqMutex
+     *  Sequence mutex
+     *  \var nr_Sequence_struct::sqCond
+     *  Sequence state change condition
+     */
+
+    typedef struct nr_Sequence_struct {
+
+        char **                 sqPath;
+        CvCapture *             sqCapture;
+        long                    sqCount;
+        double                  sqRate;
+        IplImage **             sqSlot;
+        long *                  sqFrame;
+        int                     sqAhead;
+        long                    sqShow;
+        long                    sqNext;
+        long                    sqDrop;
+        double                  sqStart;
+        double                  sqPause;
+        int                     sqQuit;
+        int                     sqLoaders;
+        pthread_t *             sqLoader;
+        struct nr_View_struct * sqView;
+        pthread_mutex_t         sqMutex;
+        pthread_cond_t          sqCond;
+
+    } nr_Sequence;
+
+    /*! \struct nr_View_struct
+     *  \brief Viewer state structure
+     *
+     *  This structure holds the state shared between the events thread and the
+     *  render thread. The render thread always renders the latest view in the
+     *  back buffer and swaps it with the front buffer, which the events thread
+     *  presents. The fields are protected by the structure mutex.
+     *
+     *  \var nr_View_struct::vwMouse
+     *  Latest view state, updated by the events
+     *  \var nr_View_struct::vwInput
+     *  Equirectangular mapping image
+     *  \var nr_View_struct::vwCube
+     *  Cube map, unused if not created
+     *  \var nr_View_struct::vwTiles
+     *  Tiles cache, NULL if not in tiled mode
+     *  \var nr_View_struct::vwTour
+     *  Tour, NULL if not in tour mode
+     *  \var nr_View_struct::vwSwitch
+     *  Pending tour panorama switch offset
+     *  \var nr_View_struct::vwSequence
+     *  Sequence, NULL if not in playback mode
+     *  \var nr_View_struct::vwBuffer
+     *  Front and back display buffers
+     *  \var nr_View_struct::vwReduced
+     *  Reduced resolution rendering buffer
+     *  \var nr_View_struct::vwFront
+     *  Index of the front display buffer
+     *  \var nr_View_struct::vwReady
+     *  Swapped frame flag, cleared once presented
+     *  \var nr_View_struct::vwBusy
+     *  Render thread activity flag
+     *  \var nr_View_struct::vwQuit
+     *  Render thread termination flag
+     *  \var nr_View_struct::vwShow
+     *  Index of the buffer being presented, negative if none
+     *  \var nr_View_struct::vwThread
+     *  Number of threads used by rendering
+     *  \var nr_View_struct::vwMutex
+     *  Viewer state mutex
+     *  \var nr_View_struct::vwCond
+     *  Viewer state change condition
+     *  \var nr_View_struct::vwWake
+     *  Events thread wake pipe, written by the render thread on buffers swap
+     */
+
+    typedef struct nr_View_struct {
+
+        nr_Mouse        vwMouse;
+        IplImage *      vwInput;
+        ln_Cube_t       vwCube;
+        nr_Tiles *      vwTiles;
+        nr_Tour *       vwTour;
+        long            vwSwitch;
+        nr_Sequence *   vwSequence;
+        IplImage *      vwBuffer[2];
+        inter_C8_t *    vwReduced;
+        int             vwFront;
+        int             vwReady;
+        int             vwBusy;
+        int             vwQuit;
+        int             vwShow;
+        int             vwThread;
+        pthread_mutex_t vwMutex;
+        pthread_cond_t  vwCond;
+        int             vwWake[2];
+
+    } nr_View;
+
+    /*! \struct nr_Present_struct
+     *  \brief X11 presentation structure
+     *
+     *  This structure holds the X11 window and image used to present the views
+     *  without highgui. The image lives in a shared memory segment when the
+     *  MIT-SHM extension is available, in client memory otherwise.
+     *
+     *  \var nr_Present_struct::psDisplay
+     *  X11 display connection, NULL if not created
+     *  \var nr_Present_struct::psWindow
+     *  Presentation window
+     *  \var nr_Present_struct::psGC
+     *  Presentation graphic context
+     *  \var nr_Present_struct::psImage
+     *  Presentation image
+     *  \var nr_Present_struct::psShm
+     *  Shared memory segment descriptor
+     *  \var nr_Present_struct::psShared
+     *  Shared memory image flag
+     */
+
+    typedef struct nr_Present_struct {
+
+        Display *       psDisplay;
+        Window          psWindow;
+        GC              psGC;
+        XImage *        psImage;
+        XShmSegmentInfo psShm;
+        int             psShared;
+
+    } nr_Present;
+
 /* 
     Header - Function prototypes
  */
@@ -185,8 +614,8 @@
      *  
      *  The main function is responsible for panoramic image loading and the
      *  management of the display. A pseudo-infinite loop is handled by the main
-     *  function in which mouse and keyboard events are managed. The computation
-     *  of the display buffer is also performed in this loop.
+     *  function in which mouse and keyboard events are managed and the frames
+     *  swapped by the render thread are presented.
      *  
      *  \param argc Standard main parameter
      *  \param argv Standard main parameter
@@ -194,6 +623,20 @@
 
     int main ( int argc, char ** argv );
 
+    /*! \brief Render thread
+     *
+     *  This function is the render thread main function. It waits for view
+     *  changes, renders the latest view state in the back buffer, at reduced
+     *  resolution while the view moves and at full resolution once it stops,
+     *  and swaps the display buffers.
+     *
+     *  \param nrData Viewer state structure
+     *
+     *  \return Returns NULL pointer
+     */
+
+    void * nr_view_worker ( void * nrData );
+
     /*! \brief Mouse callback
      *
      *  This function is the mouse event callback that is used throught OpenCV
@@ -203,11 +646,445 @@
      *  \param x        Mouse position x at event
      *  \param y        Mouse position y at event
      *  \param flag     Mouse event flag
-     *  \param userdata Userdata handle, used for motion management
+     *  \param userdata Viewer state structure, used for motion management
      */
 
     void nr_view_mouse ( int event, int x, int y, int flag, void * userdata );
 
+    /*! \brief X11 presentation creation
+     *
+     *  This function opens the X11 display and creates the full screen window
+     *  and the presentation image. The image is created in a shared memory
+     *  segment attached to the server when MIT-SHM is available and falls back
+     *  to a client side image otherwise. Only true color visuals with 32 bits
+     *  pixels are considered.
+     *
+     *  \param nrPresent Presentation structure
+     *  \param nrWidth   Presentation width, in pixels
+     *  \param nrHeight  Presentation height, in pixels
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_view_xcreate ( nr_Present * const nrPresent, int const nrWidth, int const nrHeight );
+
+    /*! \brief X11 presentation events
+     *
+     *  This function blocks until X11 events arrive or the render thread
+     *  writes in the wake pipe, and dispatches the pending events. Mouse
+     *  events are forwarded to the mouse callback and exposures request the
+     *  presentation of the front buffer. It behaves as the highgui key waiting
+     *  function, without waking up while the viewer is idle.
+     *
+     *  \param nrPresent Presentation structure
+     *  \param nrView    Viewer state structure
+     *
+     *  \return Returns pressed key code, -1 if none
+     */
+
+    int nr_view_xwait ( nr_Present * const nrPresent, nr_View * const nrView );
+
+    /*! \brief X11 presentation display
+     *
+     *  This function converts the provided display buffer in the presentation
+     *  image pixel format, in a single pass, and puts the image on the window.
+     *  The server completion is waited before return so that the image can be
+     *  overwritten safely.
+     *
+     *  \param nrPresent Presentation structure
+     *  \param nrImage   Display buffer
+     */
+
+    void nr_view_xshow ( nr_Present * const nrPresent, IplImage const * const nrImage );
+
+    /*! \brief X11 presentation deletion
+     *
+     *  This function releases the presentation image, its shared memory
+     *  segment, the window and the display connection.
+     *
+     *  \param nrPresent Presentation structure
+     */
+
+    void nr_view_xdelete ( nr_Present * const nrPresent );
+
+    /*! \brief X11 error handler
+     *
+     *  This function is the X11 error handler installed while the shared
+     *  memory segment is attached. It only records the error occurrence.
+     *
+     *  \param nrDisplay X11 display connection
+     *  \param nrError   X11 error event
+     *
+     *  \return Returns zero
+     */
+
+    int nr_view_xerror ( Display * nrDisplay, XErrorEvent * nrError );
+
+    /*! \brief View rendering
+     *
+     *  This function renders the rectilinear view described by the mouse
+     *  structure in the provided packed buffer. The view is computed from the
+     *  tiles pyramid in tiled mode, from the cube map when it is available and
+     *  from the equirectangular mapping through libgnomonic otherwise.
+     *
+     *  \param nrView   Viewer state structure
+     *  \param nrBytes  Output buffer bytes
+     *  \param nrWidth  Output buffer width, in pixels
+     *  \param nrHeight Output buffer height, in pixels
+     *  \param nrLayers Output buffer layers count
+     *  \param nrMouse  Mouse structure holding the view
+     *  \param nrMethod Interpolation method
+     */
+
+    void nr_view_render ( 
+
+        nr_View        const * const nrView, 
+        inter_C8_t           * const nrBytes, 
+        int                    const nrWidth, 
+        int                    const nrHeight, 
+        int                    const nrLayers, 
+        nr_Mouse       const * const nrMouse, 
+        li_Method_t            const nrMethod 
+
+    );
+
+    /*! \brief Tiles pyramid opening
+     *
+     *  This function opens an equirectangular tiles pyramid produced by
+     *  norama-tile. The levels count, the tiles size and layers are detected
+     *  from the pyramid directory. The low resolution level, the largest one
+     *  not wider than NR_TILE_BASE, is assembled in parallel and the loading
+     *  threads are started. On failure, the tiles cache is closed before the
+     *  function returns.
+     *
+     *  \param nrTiles   Tiles cache structure
+     *  \param nrPath    Pyramid directory path
+     *  \param nrExt     Pyramid images extension
+     *  \param nrBudget  Tiles memory budget, in MB
+     *  \param nrLoaders Loading threads count
+     *  \param nrThread  Number of threads
+     *  \param nrView    Viewer state notified on tiles loading
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_view_topen ( 
+
+        nr_Tiles       * const nrTiles, 
+        char           * const nrPath, 
+        char           * const nrExt, 
+        long             const nrBudget, 
+        int              const nrLoaders, 
+        int              const nrThread, 
+        nr_View        * const nrView 
+
+    );
+
+    /*! \brief Tiles pyramid closing
+     *
+     *  This function stops the loading threads and releases the tiles cache,
+     *  including the low resolution level image handed to the viewer as input
+     *  mapping. It is also used by the opening function to unwind a failed
+     *  opening.
+     *
+     *  \param nrTiles Tiles cache structure
+     */
+
+    void nr_view_tclose ( nr_Tiles * const nrTiles );
+
+    /*! \brief Tiles loading thread
+     *
+     *  This function is the loading threads main function. It pops the most
+     *  urgent tile request, decodes the tile, inserts it in the cache and
+     *  notifies the viewer so that the view gets refined.
+     *
+     *  \param nrData Tiles cache structure
+     *
+     *  \return Returns NULL pointer
+     */
+
+    void * nr_view_tloader ( void * nrData );
+
+    /*! \brief Tiles view rendering
+     *
+     *  This function renders a rectilinear view from the tiles cache. The
+     *  pyramid level matching the view resolution is selected and each view
+     *  pixel is bilinearly interpolated on the loaded tiles, falling back to
+     *  the low resolution level where tiles are missing. After the frame, the
+     *  missing tiles are requested, nearest to the view center first, and the
+     *  least recently used tiles exceeding the budget are released.
+     *
+     *  \param nrTiles  Tiles cache structure
+     *  \param nrBytes  Output buffer bytes
+     *  \param nrWidth  Output buffer width, in pixels
+     *  \param nrHeight Output buffer height, in pixels
+     *  \param nrLayers Output buffer layers count
+     *  \param nrMouse  Mouse structure holding the view
+     *  \param nrThread Number of threads
+     */
+
+    void nr_view_trender ( 
+
+        nr_Tiles             * const nrTiles, 
+        inter_C8_t           * const nrBytes, 
+        int                    const nrWidth, 
+        int                    const nrHeight, 
+        int                    const nrLayers, 
+        nr_Mouse       const * const nrMouse, 
+        int                    const nrThread 
+
+    );
+
+    /*! \brief Tiles requests ordering
+     *
+     *  This function is the comparison function used to sort the tiles
+     *  requests stack, the tiles nearest to the view center being on top.
+     *
+     *  \param nrA First tile pointer address
+     *  \param nrB Second tile pointer address
+     *
+     *  \return Returns comparison result
+     */
+
+    int nr_view_torder ( void const * nrA, void const * nrB );
+
+    /*! \brief Tour opening
+     *
+     *  This function reads the tour panoramas from a list file, one path per
+     *  line, or from a directory, whose images are taken in name order. The
+     *  first panorama is decoded and the preloading thread is started. The
+     *  panoramas are decoded in color so that they all share the display
+     *  buffers format.
+     *
+     *  \param nrTour   Tour structure
+     *  \param nrPath   Tour list file or directory
+     *  \param nrBudget Decoded panoramas memory budget, in MB
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_view_touropen ( nr_Tour * const nrTour, char const * const nrPath, long const nrBudget );
+
+    /*! \brief Tour closing
+     *
+     *  This function stops the preloading thread and releases the tour
+     *  panoramas.
+     *
+     *  \param nrTour Tour structure
+     */
+
+    void nr_view_tourclose ( nr_Tour * const nrTour );
+
+    /*! \brief Tour preloading thread
+     *
+     *  This function is the preloading thread main function. It releases the
+     *  panoramas away from the current one and decodes its next and previous
+     *  neighbours, in this order, as long as the memory budget allows it.
+     *
+     *  \param nrData Tour structure
+     *
+     *  \return Returns NULL pointer
+     */
+
+    void * nr_view_tourload ( void * nrData );
+
+    /*! \brief Tour switch
+     *
+     *  This function moves the current panorama of the tour by the provided
+     *  offset, skipping the panoramas that cannot be decoded. A preloaded
+     *  panorama is returned immediately, otherwise it is decoded or its
+     *  decoding by the preloading thread is waited.
+     *
+     *  \param nrTour   Tour structure
+     *  \param nrOffset Panorama index offset
+     *
+     *  \return Returns new current panorama image, NULL if none available
+     */
+
+    IplImage * nr_view_tourswitch ( nr_Tour * const nrTour, long const nrOffset );
+
+    /*! \brief Sequence opening
+     *
+     *  This function opens a sequence from a video, from a list file, one
+     *  frame path per line, or from a directory, whose images are taken in
+     *  name order. The first frame is decoded, the playback clock is started
+     *  and the loading threads are created. The frames are decoded in color
+     *  so that they all share the display buffers format.
+     *
+     *  \param nrSequence Sequence structure
+     *  \param nrPath     Video, list file or directory
+     *  \param nrRate     Playback rate, zero for the video rate
+     *  \param nrAhead    Read-ahead slots count
+     *  \param nrLoaders  Loading threads count
+     *  \param nrView     Viewer state notified on frames decoding
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_view_sopen ( 
+
+        nr_Sequence       * const nrSequence, 
+        char        const * const nrPath, 
+        double              const nrRate, 
+        int                 const nrAhead, 
+        int                 const nrLoaders, 
+        nr_View           * const nrView 
+
+    );
+
+    /*! \brief Sequence closing
+     *
+     *  This function stops the loading threads and releases the sequence
+     *  frames, including the displayed one.
+     *
+     *  \param nrSequence Sequence structure
+     */
+
+    void nr_view_sclose ( nr_Sequence * const nrSequence );
+
+    /*! \brief Sequence loading thread
+     *
+     *  This function is the loading threads main function. It takes the next
+     *  frame fitting in the read-ahead slots, skipping the frames already late,
+     *  decodes it and notifies the viewer.
+     *
+     *  \param nrData Sequence structure
+     *
+     *  \return Returns NULL pointer
+     */
+
+    void * nr_view_sloader ( void * nrData );
+
+    /*! \brief Sequence frame
+     *
+     *  This function advances the displayed frame to the latest decoded frame
+     *  whose display time is elapsed. The skipped frames are counted as
+     *  dropped.
+     *
+     *  \param nrSequence Sequence structure
+     *
+     *  \return Returns new displayed frame image, NULL if unchanged
+     */
+
+    IplImage * nr_view_sframe ( nr_Sequence * const nrSequence );
+
+    /*! \brief Sequence due time
+     *
+     *  This function returns the display time of the next decoded frame, used
+     *  by the render thread to wait for it.
+     *
+     *  \param nrSequence Sequence structure
+     *
+     *  \return Returns monotonic display time, in seconds, HUGE_VAL if none
+     */
+
+    double nr_view_sdue ( nr_Sequence * const nrSequence );
+
+    /*! \brief Sequence pause
+     *
+     *  This function toggles the sequence playback pause, the playback clock
+     *  being stopped while paused.
+     *
+     *  \param nrSequence Sequence structure
+     */
+
+    void nr_view_spause ( nr_Sequence * const nrSequence );
+
+    /*! \brief Images list reading
+     *
+     *  This function reads images paths from a list file, one path per line,
+     *  empty lines and lines starting with # being ignored, or from a
+     *  directory, whose images are taken in name order.
+     *
+     *  \param nrPath  List file or directory
+     *  \param nrList  Returned paths array
+     *  \param nrCount Returned paths count
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_view_list ( char const * const nrPath, char *** const nrList, long * const nrCount );
+
+    /*! \brief Images list entry
+     *
+     *  This function appends a copy of the provided path to a paths array.
+     *
+     *  \param nrList  Paths array, updated on reallocation
+     *  \param nrCount Paths count
+     *  \param nrSize  Paths array capacity, updated on reallocation
+     *  \param nrPath  Appended path
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_view_ladd ( char *** const nrList, long * const nrCount, long * const nrSize, char const * const nrPath );
+
+    /*! \brief Images list ordering
+     *
+     *  This function is the comparison function used to sort the images of
+     *  a directory by name.
+     *
+     *  \param nrA First path address
+     *  \param nrB Second path address
+     *
+     *  \return Returns comparison result
+     */
+
+    int nr_view_lorder ( void const * nrA, void const * nrB );
+
+    /*! \brief Benchmark replay
+     *
+     *  This function replays a camera path without opening any window. The
+     *  path file provides one view per line, as time, in seconds, azimuth,
+     *  elevation and aperture, in degrees, lines starting with # being
+     *  ignored. Each view is rendered in the display buffer through the
+     *  interactive rendering path and the frame times percentiles, the
+     *  throughput and the threads utilization are reported.
+     *
+     *  \param nrView Viewer state structure
+     *  \param nrPath Camera path file
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int nr_view_bench ( nr_View * const nrView, char const * const nrPath );
+
+    /*! \brief Benchmark threads times
+     *
+     *  This function reads the CPU time consumed by each thread of the process
+     *  from the proc filesystem.
+     *
+     *  \param nrTask Returned threads identifiers
+     *  \param nrTime Returned threads CPU times, in seconds
+     *
+     *  \return Returns threads count
+     */
+
+    int nr_view_btasks ( long * const nrTask, double * const nrTime );
+
+    /*! \brief Benchmark frame times ordering
+     *
+     *  This function is the comparison function used to sort the benchmark
+     *  frame times.
+     *
+     *  \param nrA First frame time address
+     *  \param nrB Second frame time address
+     *
+     *  \return Returns comparison result
+     */
+
+    int nr_view_bsort ( void const * nrA, void const * nrB );
+
+    /*! \brief Monotonic time
+     *
+     *  This function returns the current monotonic clock time, used to measure
+     *  the view rendering durations.
+     *
+     *  \return Returns monotonic time, in seconds
+     */
+
+    double nr_view_time ( void );
+
     /*! \brief Screen resolution
      *
      *  This function allows to obtain the current screen resolution. The width